@@ -32,7 +32,7 @@ let package = Package(
             name: "AAplus",
             dependencies: [],
             path: "Sources/AA+",
-            exclude: ["naughter.css", "CMakeLists.txt", "AA+.htm"]
+            exclude: ["naughter.css", "CMakeLists.txt", "AA+.htm", "AABenchmark.cpp", "AAAccuracy.cpp"]
         ),
         .target(
             name: "ObjCAA",
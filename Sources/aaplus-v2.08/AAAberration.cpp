@@ -40,6 +40,8 @@ to maintain a single distribution point for the source code.
 #include "AAFK5.h"
 #endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
 #include <cmath>
+#include <cstdlib>
+#include <cassert>
 using namespace std;
 
 
@@ -117,6 +119,10 @@ const AberrationCoefficient g_AberrationCoefficients[] =
   {  0,  0,   0,  0,  0,  0,  0,  1,    -2, 0,    0,  5,        0,    0,      0,    0,     0,    -5,      0,    0,     0,    -2,     0    },
 };
 
+//The largest multiple of each of the arguments L2 to F in the table above
+constexpr const int g_AberrationMaxMultiples[11] = { 8, 14, 8, 3, 2, 1, 1, 1, 2, 1, 1 };
+constexpr const int AABERRATION_MAX_MULTIPLE = 14;
+
 #ifndef UNREFERENCED_PARAMETER
 #define UNREFERENCED_PARAMETER(x) ((void)(x))
 #endif //#ifndef UNREFERENCED_PARAMETER
@@ -124,6 +130,24 @@ const AberrationCoefficient g_AberrationCoefficients[] =
 
 //////////////////////////////// Implementation ///////////////////////////////
 
+//The eccentricity and longitude of the perihelion of the Earth's orbit as used by the ecliptic aberration
+static void EarthOrbit(double JD, double& Eccentricity, double& Perihelion) noexcept
+{
+  const double T = (JD - 2451545) / 36525;
+  const double Tsquared = T*T;
+  Eccentricity = 0.016708634 - 0.000042037*T - 0.0000001267*Tsquared;
+  Perihelion = CAACoordinateTransformation::DegreesToRadians(102.93735 + 1.71946*T + 0.00046*Tsquared);
+}
+
+CAAAberrationEpoch::CAAAberrationEpoch(double jd, bool bHighPrecision) noexcept : JD(jd),
+                                                                                 EarthVelocity(CAAAberration::EarthVelocity(jd, bHighPrecision)),
+                                                                                 SunLongitude(CAACoordinateTransformation::DegreesToRadians(CAASun::GeometricEclipticLongitude(jd, bHighPrecision))),
+                                                                                 Eccentricity(0),
+                                                                                 Perihelion(0)
+{
+  EarthOrbit(jd, Eccentricity, Perihelion);
+}
+
 CAA3DCoordinate CAAAberration::EarthVelocity(double JD, bool bHighPrecision) noexcept
 {
   CAA3DCoordinate velocity;
@@ -131,9 +155,9 @@ CAA3DCoordinate CAAAberration::EarthVelocity(double JD, bool bHighPrecision) noe
 #ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
   if (bHighPrecision)
   {
-    velocity.X = CAAVSOP87A_Earth::X_DASH(JD);
-    velocity.Y = CAAVSOP87A_Earth::Y_DASH(JD);
-    velocity.Z = CAAVSOP87A_Earth::Z_DASH(JD);
+    //Each coordinate and its rate are summed in a single pass over its series
+    CAA3DCoordinate position;
+    CAAVSOP87A_Earth::PositionAndVelocity(JD, position, velocity);
     velocity = CAAFK5::ConvertVSOPToFK5J2000(velocity);
     velocity.X *= 100000000;
     velocity.Y *= 100000000;
@@ -145,41 +169,101 @@ CAA3DCoordinate CAAAberration::EarthVelocity(double JD, bool bHighPrecision) noe
 #endif
 
   const double T = (JD - 2451545) / 36525;
-  const double L2 = 3.1761467 + 1021.3285546 * T;
-  const double L3 = 1.7534703 + 628.3075849 * T;
-  const double L4 = 6.2034809 + 334.0612431 * T;
-  const double L5 = 0.5995465 + 52.9690965 * T;
-  const double L6 = 0.8740168 + 21.3299095 * T;
-  const double L7 = 5.4812939 + 7.4781599 * T;
-  const double L8 = 5.3118863 + 3.8133036 * T;
-  const double Ldash = 3.8103444 + 8399.6847337 * T;
-  const double D = 5.1984667 + 7771.3771486 * T;
-  const double Mdash = 2.3555559 + 8328.6914289 * T;
-  const double F = 1.6279052 + 8433.4661601 * T;
+  const double Arguments[11] = { 3.1761467 + 1021.3285546 * T,  //L2
+                                 1.7534703 + 628.3075849 * T,   //L3
+                                 6.2034809 + 334.0612431 * T,   //L4
+                                 0.5995465 + 52.9690965 * T,    //L5
+                                 0.8740168 + 21.3299095 * T,    //L6
+                                 5.4812939 + 7.4781599 * T,     //L7
+                                 5.3118863 + 3.8133036 * T,     //L8
+                                 3.8103444 + 8399.6847337 * T,  //Ldash
+                                 5.1984667 + 7771.3771486 * T,  //D
+                                 2.3555559 + 8328.6914289 * T,  //Mdash
+                                 1.6279052 + 8433.4661601 * T   //F
+                               };
+
+  //The arguments of the terms are all integer combinations of the 11 arguments above, so build up the sines and
+  //cosines of their multiples using the angle addition formulae rather than calling sin and cos for every term
+  double sinMultiples[11][(2 * AABERRATION_MAX_MULTIPLE) + 1];
+  double cosMultiples[11][(2 * AABERRATION_MAX_MULTIPLE) + 1];
+  for (int j=0; j<11; j++)
+  {
+    const double sinArgument = sin(Arguments[j]);
+    const double cosArgument = cos(Arguments[j]);
+    double* pSin = sinMultiples[j] + AABERRATION_MAX_MULTIPLE;
+    double* pCos = cosMultiples[j] + AABERRATION_MAX_MULTIPLE;
+    pSin[0] = 0;
+    pCos[0] = 1;
+    for (int k=1; k<=g_AberrationMaxMultiples[j]; k++)
+    {
+      pSin[k] = (pSin[k - 1] * cosArgument) + (pCos[k - 1] * sinArgument);
+      pCos[k] = (pCos[k - 1] * cosArgument) - (pSin[k - 1] * sinArgument);
+      pSin[-k] = -pSin[k];
+      pCos[-k] = pCos[k];
+    }
+  }
 
   constexpr const int nAberrationCoefficients = sizeof(g_AberrationCoefficients) / sizeof(AberrationCoefficient);
   for (int i=0; i<nAberrationCoefficients; i++)
   {
-    const double Argument = g_AberrationCoefficients[i].L2*L2 + g_AberrationCoefficients[i].L3*L3 +
-                            g_AberrationCoefficients[i].L4*L4 + g_AberrationCoefficients[i].L5*L5 +
-                            g_AberrationCoefficients[i].L6*L6 + g_AberrationCoefficients[i].L7*L7 +
-                            g_AberrationCoefficients[i].L8*L8 + g_AberrationCoefficients[i].Ldash*Ldash +
-                            g_AberrationCoefficients[i].D*D + g_AberrationCoefficients[i].Mdash*Mdash +
-                            g_AberrationCoefficients[i].F*F;
-    velocity.X += (g_AberrationCoefficients[i].xsin + g_AberrationCoefficients[i].xsint * T) * sin(Argument);
-    velocity.X += (g_AberrationCoefficients[i].xcos + g_AberrationCoefficients[i].xcost * T) * cos(Argument);
-
-    velocity.Y += (g_AberrationCoefficients[i].ysin + g_AberrationCoefficients[i].ysint * T) * sin(Argument);
-    velocity.Y += (g_AberrationCoefficients[i].ycos + g_AberrationCoefficients[i].ycost * T) * cos(Argument);
-
-    velocity.Z += (g_AberrationCoefficients[i].zsin + g_AberrationCoefficients[i].zsint * T) * sin(Argument);
-    velocity.Z += (g_AberrationCoefficients[i].zcos + g_AberrationCoefficients[i].zcost * T) * cos(Argument);
+    const AberrationCoefficient& coefficient = g_AberrationCoefficients[i];
+    const int Multiples[11] = { coefficient.L2, coefficient.L3, coefficient.L4, coefficient.L5, coefficient.L6, coefficient.L7,
+                                coefficient.L8, coefficient.Ldash, coefficient.D, coefficient.Mdash, coefficient.F };
+    double sinArgument = 0;
+    double cosArgument = 1;
+    for (int j=0; j<11; j++)
+    {
+      const int nMultiple = Multiples[j];
+      if (nMultiple)
+      {
+        assert(abs(nMultiple) <= g_AberrationMaxMultiples[j]);
+        const double sinMultiple = sinMultiples[j][AABERRATION_MAX_MULTIPLE + nMultiple];
+        const double cosMultiple = cosMultiples[j][AABERRATION_MAX_MULTIPLE + nMultiple];
+        const double sinTemp = (sinArgument * cosMultiple) + (cosArgument * sinMultiple);
+        cosArgument = (cosArgument * cosMultiple) - (sinArgument * sinMultiple);
+        sinArgument = sinTemp;
+      }
+    }
+    velocity.X += (coefficient.xsin + coefficient.xsint * T) * sinArgument;
+    velocity.X += (coefficient.xcos + coefficient.xcost * T) * cosArgument;
+
+    velocity.Y += (coefficient.ysin + coefficient.ysint * T) * sinArgument;
+    velocity.Y += (coefficient.ycos + coefficient.ycost * T) * cosArgument;
+
+    velocity.Z += (coefficient.zsin + coefficient.zsint * T) * sinArgument;
+    velocity.Z += (coefficient.zcos + coefficient.zcost * T) * cosArgument;
   }
 
   return velocity;
 }
 
 CAA2DCoordinate CAAAberration::EquatorialAberration(double Alpha, double Delta, double JD, bool bHighPrecision) noexcept
+{
+  return EquatorialAberration(Alpha, Delta, EarthVelocity(JD, bHighPrecision));
+}
+
+CAA2DCoordinate CAAAberration::EquatorialAberration(double Alpha, double Delta, const CAAAberrationEpoch& epoch) noexcept
+{
+  return EquatorialAberration(Alpha, Delta, epoch.EarthVelocity);
+}
+
+void CAAAberration::EquatorialAberration(const double* pAlpha, const double* pDelta, const CAAAberrationEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pAlpha);
+  assert(pDelta);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = EquatorialAberration(pAlpha[i], pDelta[i], epoch.EarthVelocity);
+  }
+}
+
+CAA2DCoordinate CAAAberration::EquatorialAberration(double Alpha, double Delta, const CAA3DCoordinate& EarthVelocity) noexcept
 {
   //Convert to radians
   Alpha = CAACoordinateTransformation::DegreesToRadians(Alpha*15);
@@ -190,37 +274,56 @@ CAA2DCoordinate CAAAberration::EquatorialAberration(double Alpha, double Delta,
   const double cosDelta = cos(Delta);
   const double sinDelta = sin(Delta);
 
-  const CAA3DCoordinate velocity = EarthVelocity(JD, bHighPrecision);
-
   //What is the return value
   CAA2DCoordinate aberration;
 
-  aberration.X = CAACoordinateTransformation::RadiansToHours((velocity.Y * cosAlpha - velocity.X * sinAlpha) / ( 17314463350.0 * cosDelta));
-  aberration.Y = CAACoordinateTransformation::RadiansToDegrees(- (((velocity.X * cosAlpha + velocity.Y * sinAlpha) * sinDelta - velocity.Z * cosDelta) / 17314463350.0));
+  aberration.X = CAACoordinateTransformation::RadiansToHours((EarthVelocity.Y * cosAlpha - EarthVelocity.X * sinAlpha) / ( 17314463350.0 * cosDelta));
+  aberration.Y = CAACoordinateTransformation::RadiansToDegrees(- (((EarthVelocity.X * cosAlpha + EarthVelocity.Y * sinAlpha) * sinDelta - EarthVelocity.Z * cosDelta) / 17314463350.0));
 
   return aberration;
 }
 
 CAA2DCoordinate CAAAberration::EclipticAberration(double Lambda, double Beta, double JD, bool bHighPrecision) noexcept
+{
+  CAAAberrationEpoch epoch;
+  epoch.JD = JD;
+  EarthOrbit(JD, epoch.Eccentricity, epoch.Perihelion);
+  epoch.SunLongitude = CAACoordinateTransformation::DegreesToRadians(CAASun::GeometricEclipticLongitude(JD, bHighPrecision));
+  return EclipticAberration(Lambda, Beta, epoch);
+}
+
+CAA2DCoordinate CAAAberration::EclipticAberration(double Lambda, double Beta, const CAAAberrationEpoch& epoch) noexcept
 {
   //What is the return value
   CAA2DCoordinate aberration;
 
-  const double T = (JD - 2451545) / 36525;
-  const double Tsquared = T*T;
-  const double e = 0.016708634 - 0.000042037*T - 0.0000001267*Tsquared;
-  double pi = 102.93735 + 1.71946*T + 0.00046*Tsquared;
   constexpr const double k = 20.49552;
-  double SunLongitude = CAASun::GeometricEclipticLongitude(JD, bHighPrecision);
+  const double e = epoch.Eccentricity;
+  const double pi = epoch.Perihelion;
+  const double SunLongitude = epoch.SunLongitude;
 
   //Convert to radians
-  pi = CAACoordinateTransformation::DegreesToRadians(pi);
   Lambda = CAACoordinateTransformation::DegreesToRadians(Lambda);
   Beta = CAACoordinateTransformation::DegreesToRadians(Beta);
-  SunLongitude = CAACoordinateTransformation::DegreesToRadians(SunLongitude);
 
   aberration.X = (-k*cos(SunLongitude - Lambda) + e*k*cos(pi - Lambda)) / cos(Beta) / 3600;
   aberration.Y = -k*sin(Beta)*(sin(SunLongitude - Lambda) - e*sin(pi - Lambda)) / 3600;
 
   return aberration;
 }
+
+void CAAAberration::EclipticAberration(const double* pLambda, const double* pBeta, const CAAAberrationEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pLambda);
+  assert(pBeta);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = EclipticAberration(pLambda[i], pBeta[i], epoch);
+  }
+}
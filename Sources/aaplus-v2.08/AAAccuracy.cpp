@@ -0,0 +1,734 @@
+/*
+Module : AAAccuracy.cpp
+Purpose: Accuracy versus speed regression harness for the fast paths of the AA+ framework
+Created: 18-10-2026
+History: None
+
+Usage: AAAccuracy [--accuracy_filter=<regex>] [--accuracy_samples=<n>] [--accuracy_seed=<n>]
+
+Each case compares a candidate implementation (a truncated series, a cached or interpolated fast path etc) against
+the reference theory it approximates, at dates swept across the validity range of that theory. The maximum and RMS
+error are reported (in arcseconds for angles) along with the measured throughput of both implementations, in results
+per second so that a batch candidate which calculates many results per call is compared fairly. If the maximum
+error of any case exceeds its tolerance the process exits with a non zero return code, which makes the harness
+suitable for use as a CTest test.
+
+The runtime loading of the CAADynamicalTime tables is also checked by loading small tables from temporary files and
+comparing the values returned inside and outside of the loaded range to their expected values.
+
+*/
+
+
+/////////////////////////////// Includes //////////////////////////////////////
+
+#include "stdafx.h"
+#include "AA_.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+
+/////////////////////////////// Macros / Defines //////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26485)
+#endif //#ifdef _MSC_VER
+
+typedef double (*AccuracyFunction)(double JD);
+
+enum class AccuracyUnit
+{
+  Degrees,     //Angles in degrees, errors are reported in arcseconds
+  Hours,       //Angles in hours, errors are reported in arcseconds of time
+  AU,          //Distances in astronomical units, errors are reported in kilometres
+  Kilometres,  //Distances in kilometres
+  Seconds      //Time intervals in seconds
+};
+
+struct AccuracyCase
+{
+  const char*      pszName;     //The name of the case as reported in the results
+  AccuracyFunction pCandidate;  //The fast path being checked
+  AccuracyFunction pReference;  //The reference theory
+  AccuracyUnit     unit;        //The units which both functions return
+  double           fStartYear;  //The validity range of the reference theory which is swept
+  double           fEndYear;
+  double           fTolerance;  //The maximum permitted error in the reporting units of "unit"
+  int              nResults = 1; //The number of results the candidate calculates per call, such as the size of a batch
+};
+
+struct AccuracyOptions
+{
+  string   sFilter;
+  int      nSamples;
+  uint64_t nSeed;
+};
+
+volatile double g_fSink = 0; //Prevents the optimizer from discarding the results of the calls being timed
+
+
+/////////////////////////////// Cases /////////////////////////////////////////
+
+double YearToJD(double Year) noexcept
+{
+  return 2451545.0 + ((Year - 2000) * 365.25);
+}
+
+double GeneralPrecessionInLongitude(double JD) noexcept
+{
+  //The IAU 1976 general precession in longitude, in degrees
+  const double T = (JD - 2451545.0) / 36525;
+  return ((5029.0966 + (1.11113 - 0.000006*T)*T)*T) / 3600;
+}
+
+double PrecessThetaPersei(double JD) noexcept
+{
+  //The right ascension of Theta Persei at the mean equinox of JD, found by rotating its J2000.0 unit vector
+  const double Alpha = CAACoordinateTransformation::HoursToRadians(CAACoordinateTransformation::DMSToDegrees(2, 44, 11.986));
+  const double Delta = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(49, 13, 42.48));
+  CAA3DCoordinate value;
+  value.X = cos(Delta) * cos(Alpha);
+  value.Y = cos(Delta) * sin(Alpha);
+  value.Z = sin(Delta);
+  const CAA3DCoordinate result = CAARotationMatrix::Precession(2451545, JD) * value;
+  return CAACoordinateTransformation::MapTo0To24Range(CAACoordinateTransformation::RadiansToHours(atan2(result.Y, result.X)));
+}
+
+//The series steppers are checked at the worst case, which is the last step before they are re-anchored. Their
+//throughput is reported per step, and so includes a share of the cost of anchoring the series
+constexpr int AAACCURACY_STEPS = 63;
+constexpr double AAACCURACY_STEP_INTERVAL = 0.5;
+
+double SteppedNutationInLongitude(double JD)
+{
+  const double StartJD = JD - (AAACCURACY_STEPS * AAACCURACY_STEP_INTERVAL);
+  CAANutationStepper nutation(StartJD, AAACCURACY_STEP_INTERVAL);
+  for (int i=1; i<AAACCURACY_STEPS; i++)
+    nutation.NutationInLongitude(StartJD + (i * AAACCURACY_STEP_INTERVAL));
+  return nutation.NutationInLongitude(JD) / 3600;
+}
+
+double SteppedSunApparentLongitude(double JD)
+{
+  const double StartJD = JD - (AAACCURACY_STEPS * AAACCURACY_STEP_INTERVAL);
+  CAASunStepper sun(StartJD, AAACCURACY_STEP_INTERVAL, true);
+  for (int i=1; i<AAACCURACY_STEPS; i++)
+    sun.Calculate(StartJD + (i * AAACCURACY_STEP_INTERVAL));
+  return sun.Calculate(JD).ApparentEclipticLongitude;
+}
+
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+double SteppedEarthLongitude(double JD)
+{
+  const double StartJD = JD - (AAACCURACY_STEPS * AAACCURACY_STEP_INTERVAL);
+  CVSOP87Stepper L(CAAVSOP87D_Earth::L_Stepper(StartJD, AAACCURACY_STEP_INTERVAL));
+  for (int i=1; i<AAACCURACY_STEPS; i++)
+    L.Step();
+  return CAACoordinateTransformation::RadiansToDegrees(L.Calculate(JD));
+}
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+
+#ifndef AAPLUS_ELP2000_NO_HIGH_PRECISION
+//One of the dates is skipped so that the stepper has to re-anchor itself on the grid and then step from there
+double SteppedMoonLongitude(double JD)
+{
+  const double StartJD = JD - (AAACCURACY_STEPS * AAACCURACY_STEP_INTERVAL);
+  CAAELP2000Stepper moon(StartJD, AAACCURACY_STEP_INTERVAL);
+  for (int i=1; i<AAACCURACY_STEPS; i++)
+  {
+    if (i != 2)
+      moon.EclipticLongitude(StartJD + (i * AAACCURACY_STEP_INTERVAL));
+  }
+  return moon.EclipticLongitude(JD);
+}
+#endif //#ifndef AAPLUS_ELP2000_NO_HIGH_PRECISION
+
+//The batch lunation event evaluators are checked at the last of a batch of equally spaced k values, with the times
+//of the events returned in seconds from J2000.0
+double LunationK(double JD, double kPerYear, double Epoch, double Spacing) noexcept
+{
+  return floor((kPerYear * (((JD - 2451545.0) / 365.25) + 2000 - Epoch)) / Spacing) * Spacing;
+}
+
+double BatchTruePhase(double JD) noexcept
+{
+  const double k = LunationK(JD, 12.3685, 2000, 0.25);
+  double K[AAACCURACY_STEPS + 1];
+  double Results[AAACCURACY_STEPS + 1];
+  for (int i=0; i<=AAACCURACY_STEPS; i++)
+    K[i] = k - ((AAACCURACY_STEPS - i) * 0.25);
+  CAAMoonPhases::TruePhase(K, Results, AAACCURACY_STEPS + 1);
+  return (Results[AAACCURACY_STEPS] - 2451545.0) * 86400;
+}
+
+double BatchTruePerigee(double JD) noexcept
+{
+  const double k = LunationK(JD, 13.2555, 1999.97, 1);
+  double Result = 0;
+  CAAMoonPerigeeApogee::TruePerigee(&k, &Result, 1);
+  return (Result - 2451545.0) * 86400;
+}
+
+//The batch evaluators are also checked with a repeated value of k (checking the second result) and with unequally
+//spaced values of k, which are built backwards from the last k value using these increments in units of the spacing
+//of the events
+constexpr double AAACCURACY_K_INCREMENTS[8] = { 0, 1, 2, 1, 0, 3, 1, 1 };
+
+void IrregularK(double k, double Spacing, double* pK) noexcept
+{
+  pK[AAACCURACY_STEPS] = k;
+  for (int i=AAACCURACY_STEPS - 1; i>=0; i--)
+    pK[i] = pK[i + 1] - (AAACCURACY_K_INCREMENTS[i % 8] * Spacing);
+}
+
+double RepeatedBatchTruePhase(double JD) noexcept
+{
+  const double k = LunationK(JD, 12.3685, 2000, 0.25);
+  const double K[2] = { k, k };
+  double Results[2];
+  CAAMoonPhases::TruePhase(K, Results, 2);
+  return (Results[1] - 2451545.0) * 86400;
+}
+
+double RepeatedBatchTruePerigee(double JD) noexcept
+{
+  const double k = LunationK(JD, 13.2555, 1999.97, 1);
+  const double K[2] = { k, k };
+  double Results[2];
+  CAAMoonPerigeeApogee::TruePerigee(K, Results, 2);
+  return (Results[1] - 2451545.0) * 86400;
+}
+
+double IrregularBatchTruePhase(double JD) noexcept
+{
+  double K[AAACCURACY_STEPS + 1];
+  double Results[AAACCURACY_STEPS + 1];
+  IrregularK(LunationK(JD, 12.3685, 2000, 0.25), 0.25, K);
+  CAAMoonPhases::TruePhase(K, Results, AAACCURACY_STEPS + 1);
+  return (Results[AAACCURACY_STEPS] - 2451545.0) * 86400;
+}
+
+double IrregularBatchTruePerigee(double JD) noexcept
+{
+  double K[AAACCURACY_STEPS + 1];
+  double Results[AAACCURACY_STEPS + 1];
+  IrregularK(LunationK(JD, 13.2555, 1999.97, 1), 1, K);
+  CAAMoonPerigeeApogee::TruePerigee(K, Results, AAACCURACY_STEPS + 1);
+  return (Results[AAACCURACY_STEPS] - 2451545.0) * 86400;
+}
+
+double BatchPassageThroNode(double JD) noexcept
+{
+  const double k = LunationK(JD, 13.4223, 2000.05, 0.5);
+  double Result = 0;
+  CAAMoonNodes::PassageThroNode(&k, &Result, 1);
+  return (Result - 2451545.0) * 86400;
+}
+
+double BatchPhysicalMars(double JD) noexcept
+{
+  //The last of a run of dates one minute apart, where the light time iteration starts from the previous date
+  double JDs[AAACCURACY_STEPS + 1];
+  CAAPhysicalMarsDetails Results[AAACCURACY_STEPS + 1];
+  for (int i=0; i<=AAACCURACY_STEPS; i++)
+    JDs[i] = JD - ((AAACCURACY_STEPS - i) / 1440.0);
+  CAAPhysicalMars::Calculate(JDs, Results, AAACCURACY_STEPS + 1, false);
+  return Results[AAACCURACY_STEPS].w;
+}
+
+double BatchSaturnRings(double JD) noexcept
+{
+  double JDs[AAACCURACY_STEPS + 1];
+  CAASaturnRingDetails Results[AAACCURACY_STEPS + 1];
+  for (int i=0; i<=AAACCURACY_STEPS; i++)
+    JDs[i] = JD - ((AAACCURACY_STEPS - i) / 1440.0);
+  CAASaturnRings::Calculate(JDs, Results, AAACCURACY_STEPS + 1, false);
+  return Results[AAACCURACY_STEPS].B;
+}
+
+double BatchSaturnMoons(double JD) noexcept
+{
+  //The apparent X coordinate of Titan, converted from Saturn's equatorial radius to kilometres
+  double JDs[AAACCURACY_STEPS + 1];
+  CAASaturnMoonsDetails Results[AAACCURACY_STEPS + 1];
+  for (int i=0; i<=AAACCURACY_STEPS; i++)
+    JDs[i] = JD - ((AAACCURACY_STEPS - i) / 1440.0);
+  CAASaturnMoons::Calculate(JDs, Results, AAACCURACY_STEPS + 1, false);
+  return Results[AAACCURACY_STEPS].Satellite6.ApparentRectangularCoordinates.X * 60268;
+}
+
+//The indexed DeltaT lookups are checked by a batch of consecutive days, which steps through the cached segments,
+//against a lookup from a cold cache. Outside the table the fractional year computed directly from the JD is checked
+//against CAADate::FractionalYear using the long term parabola of Espenak & Meeus, which applies before -500 and
+//after 2150
+double BatchDeltaT(double JD) noexcept
+{
+  double JDs[AAACCURACY_STEPS + 1];
+  double Results[AAACCURACY_STEPS + 1];
+  for (int i=0; i<=AAACCURACY_STEPS; i++)
+    JDs[i] = JD - (AAACCURACY_STEPS - i);
+  CAADynamicalTime::DeltaT(JDs, Results, AAACCURACY_STEPS + 1);
+  return Results[AAACCURACY_STEPS];
+}
+
+double ColdDeltaT(double JD) noexcept
+{
+  CAADynamicalTime::DeltaT(JD - 3652.5);
+  return CAADynamicalTime::DeltaT(JD);
+}
+
+double LongTermDeltaT(double JD) noexcept
+{
+  const CAADate date(JD, CAADate::AfterPapalReform(JD));
+  const double u = (date.FractionalYear() - 1820) / 100;
+  return -20 + (32*u*u);
+}
+
+//The batch geodesic functions are checked for a pair of sites which wander over the globe as the date changes
+double GlobeLatitude(double JD, int nSite) noexcept
+{
+  return 89 * sin(JD / (7.1 + nSite));
+}
+
+double GlobeLongitude(double JD, int nSite) noexcept
+{
+  return 180 * cos(JD / (13.3 - nSite));
+}
+
+double BatchDistanceMatrix(double JD)
+{
+  const double Latitude[2] = { GlobeLatitude(JD, 0), GlobeLatitude(JD, 1) };
+  const double Longitude[2] = { GlobeLongitude(JD, 0), GlobeLongitude(JD, 1) };
+  double Results[4];
+  CAAGlobe::DistanceMatrix(Latitude, Longitude, Results, 2, 1);
+  return Results[1];
+}
+
+double BatchObservers(double JD) noexcept
+{
+  const double Longitude = GlobeLongitude(JD, 0);
+  const double Latitude = GlobeLatitude(JD, 0);
+  const double Height = 4000 * fabs(sin(JD));
+  CAAObserver observer;
+  CAAGlobe::Observers(&Longitude, &Latitude, &Height, &observer, 1);
+  return observer.RhoCosThetaPrime * 6378.14;
+}
+
+//The batch frame transformation is checked for a run of stars which wander over the sky as the date changes, as seen
+//from a site whose local sidereal time also follows the date
+double FrameStarAlpha(double JD) noexcept
+{
+  return CAACoordinateTransformation::MapTo0To24Range(JD * 7.3);
+}
+
+double FrameStarDelta(double JD) noexcept
+{
+  return 89 * sin(JD / 3.1);
+}
+
+double FrameLocalSiderealTime(double JD) noexcept
+{
+  return CAACoordinateTransformation::MapTo0To24Range(JD * 24.0657098);
+}
+
+double FrameHorizontal(double JD, bool bAltitude) noexcept
+{
+  double Alpha[AAACCURACY_STEPS + 1];
+  double Delta[AAACCURACY_STEPS + 1];
+  for (int i=0; i<=AAACCURACY_STEPS; i++)
+  {
+    const double StarJD = JD - ((AAACCURACY_STEPS - i) * AAACCURACY_STEP_INTERVAL);
+    Alpha[i] = CAACoordinateTransformation::HoursToRadians(FrameStarAlpha(StarJD));
+    Delta[i] = CAACoordinateTransformation::DegreesToRadians(FrameStarDelta(StarJD));
+  }
+  double Azimuth[AAACCURACY_STEPS + 1];
+  double Altitude[AAACCURACY_STEPS + 1];
+  CAAFrameTransformation::Equatorial2Horizontal(CAACoordinateTransformation::HoursToRadians(FrameLocalSiderealTime(JD)), CAACoordinateTransformation::DegreesToRadians(42.3)).Transform(Alpha, Delta, Azimuth, Altitude, AAACCURACY_STEPS + 1);
+  return CAACoordinateTransformation::RadiansToDegrees(bAltitude ? Altitude[AAACCURACY_STEPS] : Azimuth[AAACCURACY_STEPS]);
+}
+
+CAA2DCoordinate ScalarFrameHorizontal(double JD) noexcept
+{
+  return CAACoordinateTransformation::Equatorial2Horizontal(CAACoordinateTransformation::MapTo0To24Range(FrameLocalSiderealTime(JD) - FrameStarAlpha(JD)), FrameStarDelta(JD), 42.3);
+}
+
+//The refraction tables are checked at an altitude which sweeps repeatedly from below the horizon to the zenith as the
+//date changes, under conditions which are far from those used for the documented error
+double RefractionAltitude(double JD) noexcept
+{
+  return fmod(JD * 0.37, 93) - 3;
+}
+
+double TabulatedRefractionFromApparent(double JD)
+{
+  static const CAARefractionTable table(1100, -50);
+  return table.RefractionFromApparent(RefractionAltitude(JD));
+}
+
+double TabulatedRefractionFromTrue(double JD)
+{
+  static const CAARefractionTable table(1100, -50);
+  return table.RefractionFromTrue(RefractionAltitude(JD));
+}
+
+double TabulatedInverseRefractionFromTrue(double JD)
+{
+  static const CAARefractionTable table(1100, -50);
+  return RefractionAltitude(JD) - table.InverseRefractionFromTrue(RefractionAltitude(JD));
+}
+
+#define AAACCURACY_PLANET(CLASS, START, END, LTOL, BTOL, RTOL) \
+  { #CLASS "::EclipticLongitude", [](double JD) noexcept { return CLASS::EclipticLongitude(JD, false); }, [](double JD) noexcept { return CLASS::EclipticLongitude(JD, true); }, AccuracyUnit::Degrees, START, END, LTOL }, \
+  { #CLASS "::EclipticLatitude",  [](double JD) noexcept { return CLASS::EclipticLatitude(JD, false); },  [](double JD) noexcept { return CLASS::EclipticLatitude(JD, true); },  AccuracyUnit::Degrees, START, END, BTOL }, \
+  { #CLASS "::RadiusVector",      [](double JD) noexcept { return CLASS::RadiusVector(JD, false); },      [](double JD) noexcept { return CLASS::RadiusVector(JD, true); },      AccuracyUnit::AU, START, END, RTOL }
+
+#ifdef _MSC_VER
+#pragma warning(suppress : 26426)
+#endif //#ifdef _MSC_VER
+const AccuracyCase g_Cases[] =
+{
+  //Apparent sidereal time using the compensated mean sidereal time and the cached equation of the equinoxes
+  //against the full calculation
+  { "CAASiderealTime::ApparentGreenwichSiderealTime", [](double JD) { static const CAASiderealTime sidereal(YearToJD(1900), YearToJD(2100)); return sidereal.ApparentGreenwichSiderealTime(JD); },
+                                                      [](double JD) noexcept { return CAASidereal::ApparentGreenwichSiderealTime(JD); }, AccuracyUnit::Hours, 1900, 2100, 0.0001 },
+
+  //Precession of the position of Theta Persei from J2000.0 using CAARotationMatrix against Meeus's formulae
+  { "CAARotationMatrix::Precession", [](double JD) noexcept { return PrecessThetaPersei(JD); }, [](double JD) noexcept { return CAAPrecession::PrecessEquatorial(CAACoordinateTransformation::DMSToDegrees(2, 44, 11.986), CAACoordinateTransformation::DMSToDegrees(49, 13, 42.48), 2451545, JD).X; }, AccuracyUnit::Hours, -1000, 3000, 0.00001 },
+
+  //The fused Pluto series using harmonic recurrences against the separate series of Meeus's chapter 37
+  { "CAAPluto::Position/EclipticLongitude", [](double JD) noexcept { return CAAPluto::Position(JD).EclipticLongitude; }, [](double JD) noexcept { return CAAPluto::EclipticLongitude(JD); }, AccuracyUnit::Degrees, 1885, 2099, 0.000001 },
+  { "CAAPluto::Position/EclipticLatitude",  [](double JD) noexcept { return CAAPluto::Position(JD).EclipticLatitude; },  [](double JD) noexcept { return CAAPluto::EclipticLatitude(JD); },  AccuracyUnit::Degrees, 1885, 2099, 0.000001 },
+  { "CAAPluto::Position/RadiusVector",      [](double JD) noexcept { return CAAPluto::Position(JD).RadiusVector; },      [](double JD) noexcept { return CAAPluto::RadiusVector(JD); },      AccuracyUnit::AU, 1885, 2099, 0.00001 },
+
+  //The stepped series after the maximum number of steps between anchors against the direct evaluation
+  { "CAANutationStepper::NutationInLongitude", SteppedNutationInLongitude, [](double JD) noexcept { return CAANutation::NutationInLongitude(JD) / 3600; }, AccuracyUnit::Degrees, -2000, 6000, 0.000001, AAACCURACY_STEPS },
+  { "CAASunStepper::Calculate/ApparentLongitude", SteppedSunApparentLongitude, [](double JD) noexcept { return CAASun::ApparentEclipticLongitude(JD, true); }, AccuracyUnit::Degrees, -2000, 6000, 0.000001, AAACCURACY_STEPS },
+
+  //The batch lunation event evaluators using harmonic recurrences against Meeus's chapters 49, 50 & 51
+  { "CAAMoonPhases::TruePhase/Batch", BatchTruePhase, [](double JD) noexcept { return (CAAMoonPhases::TruePhase(LunationK(JD, 12.3685, 2000, 0.25)) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, -2000, 6000, 0.001, AAACCURACY_STEPS + 1 },
+  { "CAAMoonPerigeeApogee::TruePerigee/Batch", BatchTruePerigee, [](double JD) noexcept { return (CAAMoonPerigeeApogee::TruePerigee(LunationK(JD, 13.2555, 1999.97, 1)) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, -2000, 6000, 0.001 },
+  { "CAAMoonPhases::TruePhase/BatchRepeated", RepeatedBatchTruePhase, [](double JD) noexcept { return (CAAMoonPhases::TruePhase(LunationK(JD, 12.3685, 2000, 0.25)) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, -2000, 6000, 0.001, AAACCURACY_STEPS + 1 },
+  { "CAAMoonPerigeeApogee::TruePerigee/BatchRepeated", RepeatedBatchTruePerigee, [](double JD) noexcept { return (CAAMoonPerigeeApogee::TruePerigee(LunationK(JD, 13.2555, 1999.97, 1)) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, -2000, 6000, 0.001, 2 },
+  { "CAAMoonPhases::TruePhase/BatchIrregular", IrregularBatchTruePhase, [](double JD) noexcept { return (CAAMoonPhases::TruePhase(LunationK(JD, 12.3685, 2000, 0.25)) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, -2000, 6000, 0.001, AAACCURACY_STEPS + 1 },
+  { "CAAMoonPerigeeApogee::TruePerigee/BatchIrregular", IrregularBatchTruePerigee, [](double JD) noexcept { return (CAAMoonPerigeeApogee::TruePerigee(LunationK(JD, 13.2555, 1999.97, 1)) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, -2000, 6000, 0.001, AAACCURACY_STEPS + 1 },
+  { "CAAMoonNodes::PassageThroNode/Batch", BatchPassageThroNode, [](double JD) noexcept { return (CAAMoonNodes::PassageThroNode(LunationK(JD, 13.4223, 2000.05, 0.5)) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, -2000, 6000, 0.001 },
+
+  //The batch physical ephemerides, which seed each light time iteration from the previous date
+  { "CAAPhysicalMars::Calculate/Batch", BatchPhysicalMars, [](double JD) noexcept { return CAAPhysicalMars::Calculate(JD, false).w; }, AccuracyUnit::Degrees, -2000, 6000, 0.0036, AAACCURACY_STEPS + 1 },
+  { "CAASaturnRings::Calculate/Batch", BatchSaturnRings, [](double JD) noexcept { return CAASaturnRings::Calculate(JD, false).B; }, AccuracyUnit::Degrees, -2000, 6000, 0.0001, AAACCURACY_STEPS + 1 },
+  { "CAASaturnMoons::Calculate/Batch", BatchSaturnMoons, [](double JD) noexcept { return CAASaturnMoons::Calculate(JD, false).Satellite6.ApparentRectangularCoordinates.X * 60268; }, AccuracyUnit::Kilometres, -2000, 6000, 0.001, AAACCURACY_STEPS + 1 },
+
+  //The indexed DeltaT lookups and the direct fractional year against a cold lookup and CAADate
+  { "CAADynamicalTime::DeltaT/Batch", BatchDeltaT, ColdDeltaT, AccuracyUnit::Seconds, 1700, 2020, 0.000000001, AAACCURACY_STEPS + 1 },
+  { "CAADynamicalTime::DeltaT/Before-500", [](double JD) noexcept { return CAADynamicalTime::DeltaT(JD); }, LongTermDeltaT, AccuracyUnit::Seconds, -2000, -600, 0.000001 },
+  { "CAADynamicalTime::DeltaT/After2150", [](double JD) noexcept { return CAADynamicalTime::DeltaT(JD); }, LongTermDeltaT, AccuracyUnit::Seconds, 2200, 6000, 0.000001 },
+
+  //The distance matrix built from the half angles of each site and the observers built from the reduced latitude
+  //without trigonometric functions against Meeus's chapter 11
+  { "CAAGlobe::DistanceMatrix", BatchDistanceMatrix, [](double JD) noexcept { return CAAGlobe::DistanceBetweenPoints(GlobeLatitude(JD, 0), GlobeLongitude(JD, 0), GlobeLatitude(JD, 1), GlobeLongitude(JD, 1)); }, AccuracyUnit::Kilometres, 1900, 2100, 0.000001 },
+  { "CAAGlobe::Observers/RhoCosThetaPrime", BatchObservers, [](double JD) noexcept { return CAAGlobe::RhoCosThetaPrime(GlobeLatitude(JD, 0), 4000 * fabs(sin(JD))) * 6378.14; }, AccuracyUnit::Kilometres, 1900, 2100, 0.000001 },
+
+  //The batch frame transformation using the vectorizable sine, cosine and arc tangent kernels against the scalar conversion
+  { "CAAFrameTransformation::Transform/Azimuth", [](double JD) noexcept { return FrameHorizontal(JD, false); }, [](double JD) noexcept { return ScalarFrameHorizontal(JD).X; }, AccuracyUnit::Degrees, 1900, 2100, 0.000001, AAACCURACY_STEPS + 1 },
+  { "CAAFrameTransformation::Transform/Altitude", [](double JD) noexcept { return FrameHorizontal(JD, true); }, [](double JD) noexcept { return ScalarFrameHorizontal(JD).Y; }, AccuracyUnit::Degrees, 1900, 2100, 0.000001, AAACCURACY_STEPS + 1 },
+
+  //The refraction tables against the formulae of CAARefraction. The inverse is checked by refracting the true
+  //altitude it returns with CAARefraction::RefractionFromTrue, which should give back the apparent altitude
+  { "CAARefractionTable::RefractionFromApparent", TabulatedRefractionFromApparent, [](double JD) noexcept { return CAARefraction::RefractionFromApparent(RefractionAltitude(JD), 1100, -50); }, AccuracyUnit::Degrees, 1900, 2100, 0.0002 },
+  { "CAARefractionTable::RefractionFromTrue", TabulatedRefractionFromTrue, [](double JD) noexcept { return CAARefraction::RefractionFromTrue(RefractionAltitude(JD), 1100, -50); }, AccuracyUnit::Degrees, 1900, 2100, 0.0002 },
+  { "CAARefractionTable::InverseRefractionFromTrue", TabulatedInverseRefractionFromTrue, [](double JD) { return RefractionAltitude(JD) - CAARefraction::RefractionFromTrue(TabulatedInverseRefractionFromTrue(JD), 1100, -50); }, AccuracyUnit::Degrees, 1900, 2100, 0.0002 },
+
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  //Meeus's periodic terms for the phases and apsides against the dates refined using ELP2000 and VSOP87. Meeus
+  //quotes maximum errors of 17.4 seconds for the phases and 31 minutes for the perigees
+  { "CAAMoonPhases::TruePhase/Meeus", [](double JD) noexcept { return (CAAMoonPhases::TruePhase(LunationK(JD, 12.3685, 2000, 0.25)) - 2451545.0) * 86400; }, [](double JD) noexcept { return (CAAMoonPhases::TruePhase(LunationK(JD, 12.3685, 2000, 0.25), true) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, 1900, 2100, 25 },
+  { "CAAMoonPerigeeApogee::TruePerigee/Meeus", [](double JD) noexcept { return (CAAMoonPerigeeApogee::TruePerigee(LunationK(JD, 13.2555, 1999.97, 1)) - 2451545.0) * 86400; }, [](double JD) noexcept { return (CAAMoonPerigeeApogee::TruePerigee(LunationK(JD, 13.2555, 1999.97, 1), true) - 2451545.0) * 86400; }, AccuracyUnit::Seconds, 1900, 2100, 2000 },
+
+  //The truncated VSOP87 series as presented in Meeus's book against the full VSOP87 theory (series D). The
+  //validity ranges are those quoted by Bretagnon & Francou for a precision of 1" with the full theory
+  AAACCURACY_PLANET(CAAMercury, -2000, 6000,  5,  4,   2000),
+  AAACCURACY_PLANET(CAAVenus,   -2000, 6000,  4,  2,   1500),
+  AAACCURACY_PLANET(CAAEarth,   -2000, 6000,  2,  1,   1000),
+  AAACCURACY_PLANET(CAAMars,    -2000, 6000,  6,  4,   4000),
+  AAACCURACY_PLANET(CAAJupiter,     0, 4000,  4,  2,  10000),
+  AAACCURACY_PLANET(CAASaturn,      0, 4000,  4,  3,  35000),
+  AAACCURACY_PLANET(CAAUranus,  -4000, 8000, 25,  5, 100000),
+  AAACCURACY_PLANET(CAANeptune, -4000, 8000, 25,  4,  75000),
+
+  //Cubic Hermite interpolation of the full VSOP87 theory sampled every 2 days together with its analytic rate
+  { "CAACubicHermiteInterpolator/CAAVSOP87D_Earth::L", [](double JD) { static const CAACubicHermiteInterpolator interpolator(CAACubicHermiteInterpolator::Sample(YearToJD(1950), YearToJD(2050), 2, CAAVSOP87D_Earth::L, CAAVSOP87D_Earth::L_DASH, true)); return CAACoordinateTransformation::RadiansToDegrees(interpolator.Evaluate(JD)); },
+                                                        [](double JD) noexcept { return CAACoordinateTransformation::RadiansToDegrees(CAAVSOP87D_Earth::L(JD)); }, AccuracyUnit::Degrees, 1950, 2050, 0.005 },
+
+  //The stepped VSOP87 series for the Earth against the direct evaluation
+  { "CVSOP87Stepper/CAAVSOP87D_Earth::L", SteppedEarthLongitude, [](double JD) noexcept { return CAACoordinateTransformation::RadiansToDegrees(CAAVSOP87D_Earth::L(JD)); }, AccuracyUnit::Degrees, -2000, 6000, 0.000001, AAACCURACY_STEPS },
+
+  //Apparent geocentric positions using the truncated series against the full VSOP87 theory
+  { "CAAElliptical::Calculate/MARS/ApparentGeocentricLongitude",    [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::MARS, false).ApparentGeocentricLongitude; }, [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::MARS, true).ApparentGeocentricLongitude; }, AccuracyUnit::Degrees, -2000, 6000, 12 },
+  { "CAAElliptical::Calculate/JUPITER/ApparentGeocentricLongitude", [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::JUPITER, false).ApparentGeocentricLongitude; }, [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::JUPITER, true).ApparentGeocentricLongitude; }, AccuracyUnit::Degrees, 0, 4000, 4 },
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+
+#ifndef AAPLUS_ELP2000_NO_HIGH_PRECISION
+  //The truncated ELP2000-82 series as presented in Meeus's book against the full ELP2000-82 theory. Note that the
+  //longitude from CAAELP2000 is measured from the fixed departure point of J2000.0, so the general precession in
+  //longitude is added to it first
+  { "CAAMoon::EclipticLongitude", [](double JD) noexcept { return CAAMoon::EclipticLongitude(JD); }, [](double JD) noexcept { return CAAELP2000::EclipticLongitude(JD) + GeneralPrecessionInLongitude(JD); }, AccuracyUnit::Degrees, 1500, 2500, 60 },
+  { "CAAMoon::EclipticLatitude",  [](double JD) noexcept { return CAAMoon::EclipticLatitude(JD); },  [](double JD) noexcept { return CAAELP2000::EclipticLatitude(JD); },  AccuracyUnit::Degrees, 1500, 2500, 10 },
+  { "CAAMoon::RadiusVector",      [](double JD) noexcept { return CAAMoon::RadiusVector(JD); },      [](double JD) noexcept { return CAAELP2000::RadiusVector(JD); },      AccuracyUnit::Kilometres, 1500, 2500, 15 },
+  { "CAAELP2000Stepper::EclipticLongitude", SteppedMoonLongitude, [](double JD) noexcept { return CAAELP2000::EclipticLongitude(JD); }, AccuracyUnit::Degrees, -2000, 6000, 0.0001, AAACCURACY_STEPS },
+#endif //#ifndef AAPLUS_ELP2000_NO_HIGH_PRECISION
+};
+
+
+/////////////////////////////// Implementation ////////////////////////////////
+
+double ErrorInReportingUnits(double fCandidate, double fReference, AccuracyUnit unit) noexcept
+{
+  double fError = fCandidate - fReference;
+  switch (unit)
+  {
+    case AccuracyUnit::Degrees:
+    {
+      fError = remainder(fError, 360) * 3600;
+      break;
+    }
+    case AccuracyUnit::Hours:
+    {
+      fError = remainder(fError, 24) * 3600;
+      break;
+    }
+    case AccuracyUnit::AU:
+    {
+      fError *= 149597870.7;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+  return fabs(fError);
+}
+
+const char* ReportingUnits(AccuracyUnit unit) noexcept
+{
+  switch (unit)
+  {
+    case AccuracyUnit::Degrees:
+    {
+      return "arcsec";
+    }
+    case AccuracyUnit::Hours:
+    {
+      return "s";
+    }
+    case AccuracyUnit::Seconds:
+    {
+      return "s";
+    }
+    default:
+    {
+      return "km";
+    }
+  }
+}
+
+double CallsPerSecond(AccuracyFunction pFunction, const vector<double>& dates)
+{
+  double fSum = 0;
+  const auto start = chrono::steady_clock::now();
+  for (const auto JD : dates)
+    fSum += pFunction(JD);
+  const auto finish = chrono::steady_clock::now();
+  g_fSink = fSum;
+
+  const double fElapsed = chrono::duration<double>(finish - start).count();
+  return (fElapsed > 0) ? (dates.size() / fElapsed) : 0;
+}
+
+bool RunCase(const AccuracyCase& accuracyCase, const AccuracyOptions& options)
+{
+  //Sweep the validity range in equal steps with a random offset within each step drawn from the fixed seed, so that
+  //the dates sampled are reproducible from run to run but are not locked to any periodicity of the theories
+  mt19937_64 generator(options.nSeed);
+  uniform_real_distribution<double> distribution(0, 1);
+  const double StartJD = YearToJD(accuracyCase.fStartYear);
+  const double fStep = (YearToJD(accuracyCase.fEndYear) - StartJD) / options.nSamples;
+  vector<double> dates(options.nSamples);
+  for (int i=0; i<options.nSamples; i++)
+    dates[i] = StartJD + ((i + distribution(generator)) * fStep);
+
+  double fMaxError = 0;
+  double fMaxErrorJD = StartJD;
+  double fSumSquares = 0;
+  for (const auto JD : dates)
+  {
+    const double fError = ErrorInReportingUnits(accuracyCase.pCandidate(JD), accuracyCase.pReference(JD), accuracyCase.unit);
+    fSumSquares += (fError * fError);
+    if (fError > fMaxError)
+    {
+      fMaxError = fError;
+      fMaxErrorJD = JD;
+    }
+  }
+  const double fRMSError = sqrt(fSumSquares / options.nSamples);
+
+  //The throughput is compared per result, as a batch candidate calculates many results for each call of the reference
+  const double fCandidateResultsPerSecond = CallsPerSecond(accuracyCase.pCandidate, dates) * accuracyCase.nResults;
+  const double fReferenceResultsPerSecond = CallsPerSecond(accuracyCase.pReference, dates);
+
+  const bool bPass = (fMaxError <= accuracyCase.fTolerance);
+  printf("%-60s %6s %12.4f %12.4f %12.1f %14.0f %14.0f %8.1fx %s\n", accuracyCase.pszName, ReportingUnits(accuracyCase.unit), fMaxError, fRMSError, fMaxErrorJD,
+         fCandidateResultsPerSecond, fReferenceResultsPerSecond, (fReferenceResultsPerSecond > 0) ? (fCandidateResultsPerSecond / fReferenceResultsPerSecond) : 0, bPass ? "OK" : "FAIL");
+  if (!bPass)
+    printf("  ***FAIL*** maximum error exceeds the tolerance of %g %s\n", accuracyCase.fTolerance, ReportingUnits(accuracyCase.unit));
+  fflush(stdout);
+
+  return bPass;
+}
+
+bool CheckValue(const char* pszName, double fValue, double fExpected, double fTolerance)
+{
+  const double fError = fabs(fValue - fExpected);
+  const bool bPass = (fError <= fTolerance);
+  printf("%-60s %6s %12.4f %12s %12s %14s %14s %9s %s\n", pszName, "s", fError, "", "", "", "", "", bPass ? "OK" : "FAIL");
+  if (!bPass)
+    printf("  ***FAIL*** value of %.6f differs from the expected value of %.6f\n", fValue, fExpected);
+  fflush(stdout);
+
+  return bPass;
+}
+
+bool WriteTextFile(const char* pszFilename, const char* pszText)
+{
+  FILE* pFile = fopen(pszFilename, "w");
+  if (pFile == nullptr)
+    return false;
+  const bool bSuccess = (fputs(pszText, pFile) >= 0);
+  return (fclose(pFile) == 0) && bSuccess;
+}
+
+//Formats a line of an IERS finals.all file, with the MJD in columns 8 to 15, the "I" flag in column 58 and UT1-UTC in
+//columns 59 to 68
+string FinalsLine(double MJD, double UT1MinusUTC)
+{
+  char szLine[128];
+  snprintf(szLine, sizeof(szLine), "%-7s%8.2f%42s%c%10.7f\n", "200101", MJD, "", 'I', UT1MinusUTC);
+  return szLine;
+}
+
+//Checks the runtime loading of the CAADynamicalTime tables by writing small tables to temporary files and then
+//comparing the values returned inside and outside of the loaded range, and after a reload, to their expected values.
+//Returns the number of checks which failed
+int RunTableLoadingChecks()
+{
+  const char* pszFilename = "AAAccuracy-EarthOrientation.tmp";
+  int nFailures = 0;
+
+  //Values from the compiled tables which are expected outside of the loaded ranges
+  const double JD1965 = CAADate::DateToJD(1965, 6, 1, true);
+  const double JD1990 = CAADate::DateToJD(1990, 6, 1, true);
+  const double JD2000 = CAADate::DateToJD(2000, 1, 16, true);
+  const double JD2020 = CAADate::DateToJD(2020, 1, 1.5, true);
+  const double CompiledDeltaT1990 = CAADynamicalTime::DeltaT(JD1990);
+  const double CompiledDeltaT2000 = CAADynamicalTime::DeltaT(JD2000);
+  const double CompiledLeapSeconds1965 = CAADynamicalTime::CumulativeLeapSeconds(JD1965);
+  const double CompiledLeapSeconds1990 = CAADynamicalTime::CumulativeLeapSeconds(JD1990);
+
+  //LoadDeltaTValues, where 16 January 2000 is half way between the two values
+  bool bLoaded = WriteTextFile(pszFilename, "2000 1 1 100.0\n2000 1 31 130.0\n") && CAADynamicalTime::LoadDeltaTValues(pszFilename);
+  nFailures += !CheckValue("CAADynamicalTime::LoadDeltaTValues/Load", bLoaded, true, 0);
+  nFailures += !CheckValue("CAADynamicalTime::LoadDeltaTValues/Inside", CAADynamicalTime::DeltaT(JD2000), 115, 1e-9);
+  nFailures += !CheckValue("CAADynamicalTime::LoadDeltaTValues/Outside", CAADynamicalTime::DeltaT(JD1990), CompiledDeltaT1990, 0);
+  bLoaded = WriteTextFile(pszFilename, "2000 1 1 200.0\n2000 1 31 260.0\n") && CAADynamicalTime::LoadDeltaTValues(pszFilename);
+  nFailures += !CheckValue("CAADynamicalTime::LoadDeltaTValues/Reload", CAADynamicalTime::DeltaT(JD2000), 230, 1e-9);
+  CAADynamicalTime::ResetToCompiledTables();
+  nFailures += !CheckValue("CAADynamicalTime::LoadDeltaTValues/Reset", CAADynamicalTime::DeltaT(JD2000), CompiledDeltaT2000, 0);
+
+  //LoadLeapSeconds using the layout of the IERS Leap_Second.dat file, which starts in 1972. Before then the 1961 - 1971
+  //drift rates of the compiled table should still be used
+  bLoaded = WriteTextFile(pszFilename, "#  MJD        Date        TAI-UTC (s)\n    41317.0    1  1 1972       10\n    51544.0    1  1 2000       50\n") &&
+            CAADynamicalTime::LoadLeapSeconds(pszFilename);
+  nFailures += !CheckValue("CAADynamicalTime::LoadLeapSeconds/Load", bLoaded, true, 0);
+  nFailures += !CheckValue("CAADynamicalTime::LoadLeapSeconds/Inside", CAADynamicalTime::CumulativeLeapSeconds(JD1990), 10, 0);
+  nFailures += !CheckValue("CAADynamicalTime::LoadLeapSeconds/Inside2", CAADynamicalTime::CumulativeLeapSeconds(JD2020), 50, 0);
+  nFailures += !CheckValue("CAADynamicalTime::LoadLeapSeconds/Outside", CAADynamicalTime::CumulativeLeapSeconds(JD1965), CompiledLeapSeconds1965, 0);
+  bLoaded = WriteTextFile(pszFilename, " 1972 JAN  1 =JD 2441317.5  TAI-UTC=  10.0       S + (MJD - 41317.) X 0.0      S\n"
+                                       " 1980 JAN  1 =JD 2444239.5  TAI-UTC=  20.0       S + (MJD - 41317.) X 0.0      S\n") &&
+            CAADynamicalTime::LoadLeapSeconds(pszFilename);
+  nFailures += !CheckValue("CAADynamicalTime::LoadLeapSeconds/Reload", CAADynamicalTime::CumulativeLeapSeconds(JD1990), 20, 0);
+  nFailures += !CheckValue("CAADynamicalTime::LoadLeapSeconds/ReloadOutside", CAADynamicalTime::CumulativeLeapSeconds(JD1965), CompiledLeapSeconds1965, 0);
+
+  //LoadFinals, which converts UT1-UTC to DeltaT using the leap seconds loaded above (20 seconds in 2020)
+  string sFinals = FinalsLine(58849, -0.2) + FinalsLine(58850, -0.3);
+  bLoaded = WriteTextFile(pszFilename, sFinals.c_str()) && CAADynamicalTime::LoadFinals(pszFilename);
+  nFailures += !CheckValue("CAADynamicalTime::LoadFinals/Load", bLoaded, true, 0);
+  nFailures += !CheckValue("CAADynamicalTime::LoadFinals/Inside", CAADynamicalTime::DeltaT(JD2020), 32.184 + 20 + 0.25, 1e-9);
+  nFailures += !CheckValue("CAADynamicalTime::LoadFinals/Outside", CAADynamicalTime::DeltaT(JD1990), CompiledDeltaT1990, 0);
+  CAADynamicalTime::ResetToCompiledTables();
+  sFinals = FinalsLine(58849, 0.2) + FinalsLine(58850, 0.1);
+  bLoaded = WriteTextFile(pszFilename, sFinals.c_str()) && CAADynamicalTime::LoadFinals(pszFilename);
+  nFailures += !CheckValue("CAADynamicalTime::LoadFinals/Reload", CAADynamicalTime::DeltaT(JD2020), 32.184 + 37 - 0.15, 1e-9);
+  CAADynamicalTime::ResetToCompiledTables();
+  nFailures += !CheckValue("CAADynamicalTime::LoadFinals/Reset", CAADynamicalTime::CumulativeLeapSeconds(JD1990), CompiledLeapSeconds1990, 0);
+
+  remove(pszFilename);
+  return nFailures;
+}
+
+bool ParseOption(const char* pszArg, const char* pszName, const char*& pszValue) noexcept
+{
+  const size_t nLength = strlen(pszName);
+  if ((strncmp(pszArg, pszName, nLength) != 0) || (pszArg[nLength] != '='))
+    return false;
+  pszValue = pszArg + nLength + 1;
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  AccuracyOptions options;
+  options.nSamples = 1000;
+  options.nSeed = 20260101;
+  for (int i=1; i<argc; i++)
+  {
+    const char* pszValue = nullptr;
+    if (ParseOption(argv[i], "--accuracy_filter", pszValue))
+      options.sFilter = pszValue;
+    else if (ParseOption(argv[i], "--accuracy_samples", pszValue))
+      options.nSamples = max(1, atoi(pszValue));
+    else if (ParseOption(argv[i], "--accuracy_seed", pszValue))
+      options.nSeed = strtoull(pszValue, nullptr, 10);
+    else
+    {
+      fprintf(stderr, "Unrecognized option: %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+  printf("%-60s %6s %12s %12s %12s %14s %14s %9s\n", "Case", "Units", "Max error", "RMS error", "At JD", "Candidate/sec", "Reference/sec", "Speedup");
+  const regex filter(options.sFilter.empty() ? string(".*") : options.sFilter);
+  int nFailures = 0;
+  for (const auto& accuracyCase : g_Cases)
+  {
+    if (regex_search(accuracyCase.pszName, filter) && !RunCase(accuracyCase, options))
+      ++nFailures;
+  }
+  if (regex_search("CAADynamicalTime::Load", filter))
+    nFailures += RunTableLoadingChecks();
+  if (nFailures)
+  {
+    printf("\n%d case(s) exceeded their tolerance\n", nFailures);
+    return 1;
+  }
+
+  return 0;
+}
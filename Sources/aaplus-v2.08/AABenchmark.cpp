@@ -0,0 +1,574 @@
+/*
+Module : AABenchmark.cpp
+Purpose: Performance benchmarks for the hot entry points of the AA+ framework
+Created: 18-10-2026
+History: None
+
+Usage: AABenchmark [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>] [--benchmark_repetitions=<n>]
+                   [--benchmark_seed=<n>] [--benchmark_out=<file.json>] [--benchmark_baseline=<file.json>]
+                   [--benchmark_threshold=<percent>] [--benchmark_list]
+
+Each benchmark is run against a fixed set of pseudo random inputs which are generated from the seed, so that two
+runs (or two builds) with the same seed measure exactly the same work. The results can be written out as JSON in
+the same layout as used by Google Benchmark. When a baseline JSON file is specified, the results are compared
+against it and the process exits with a non zero return code if any benchmark is slower than the baseline by more
+than the threshold percentage.
+
+*/
+
+
+/////////////////////////////// Includes //////////////////////////////////////
+
+#include "stdafx.h"
+#include "AA_.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <ctime>
+#include <chrono>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <thread>
+using namespace std;
+
+
+/////////////////////////////// Macros / Defines //////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26485)
+#endif //#ifdef _MSC_VER
+
+typedef double (*BenchmarkFunction)(double X);
+
+struct Benchmark
+{
+  const char*       pszName;   //The name of the benchmark as reported in the results
+  BenchmarkFunction pFunction; //The code to time, called once per iteration
+  double            fMinX;     //The range from which the inputs to the function are drawn
+  double            fMaxX;
+};
+
+struct BenchmarkResult
+{
+  string   sName;
+  uint64_t nIterations;
+  double   fNanosecondsPerCall;
+  double   fCallsPerSecond;
+};
+
+struct BenchmarkOptions
+{
+  string   sFilter;
+  double   fMinTime;
+  int      nRepetitions;
+  uint64_t nSeed;
+  string   sOutFile;
+  string   sBaselineFile;
+  double   fThreshold;
+  bool     bList;
+};
+
+constexpr const double JD1900 = 2415020.5;
+constexpr const double JD2100 = 2488069.5;
+constexpr const size_t nInputs = 1024; //A power of 2 so that the input index can be masked rather than divided
+constexpr const double BostonLongitude = 71.0833;
+constexpr const double BostonLatitude = 42.3333;
+
+volatile double g_fSink = 0; //Prevents the optimizer from discarding the results of the calls being timed
+
+
+/////////////////////////////// Benchmarks ////////////////////////////////////
+
+//A random star catalogue uniformly distributed over the sky, held both as spherical coordinates and as unit vectors
+struct StarCatalogue
+{
+  StarCatalogue() : Alpha(nInputs), Delta(nInputs), X(nInputs), Y(nInputs), Z(nInputs)
+  {
+    mt19937_64 generator(1);
+    uniform_real_distribution<double> distribution(0, 1);
+    for (size_t i=0; i<nInputs; i++)
+    {
+      Alpha[i] = 2 * CAACoordinateTransformation::PI() * distribution(generator);
+      Delta[i] = asin((2 * distribution(generator)) - 1);
+    }
+    CAAFrameTransformation::SphericalToUnitVector(Alpha.data(), Delta.data(), X.data(), Y.data(), Z.data(), nInputs);
+  }
+
+  vector<double> Alpha;
+  vector<double> Delta;
+  vector<double> X;
+  vector<double> Y;
+  vector<double> Z;
+};
+
+//The altitudes in degrees of the stars of the random catalogue above the horizon, reflecting those below it
+struct AltitudeCatalogue
+{
+  AltitudeCatalogue() : Altitudes(nInputs)
+  {
+    const StarCatalogue catalogue;
+    for (size_t i=0; i<nInputs; i++)
+      Altitudes[i] = fabs(CAACoordinateTransformation::RadiansToDegrees(catalogue.Delta[i]));
+  }
+
+  vector<double> Altitudes;
+};
+
+//A network of observers spread over the Earth's surface
+struct ObserverNetwork
+{
+  ObserverNetwork() : Longitude(nInputs),
+                      Latitude(nInputs),
+                      Height(nInputs),
+                      Observers(nInputs)
+  {
+    for (size_t i=0; i<nInputs; i++)
+    {
+      Longitude[i] = -180 + (360.0 * i / nInputs);
+      Latitude[i] = -60 + (120.0 * i / nInputs);
+      Height[i] = 100.0 * (i % 30);
+    }
+    CAAGlobe::Observers(Longitude.data(), Latitude.data(), Height.data(), Observers.data(), nInputs);
+    ReversedLongitude.assign(Longitude.rbegin(), Longitude.rend());
+    ReversedLatitude.assign(Latitude.rbegin(), Latitude.rend());
+  }
+
+  vector<double> Longitude;
+  vector<double> Latitude;
+  vector<double> Height;
+  vector<CAAObserver> Observers;
+  vector<double> ReversedLongitude;
+  vector<double> ReversedLatitude;
+};
+
+//The Sun, Moon and major planets, optionally followed by the stars of the random catalogue
+struct ConjunctionBodies
+{
+  ConjunctionBodies(bool bStars)
+  {
+    for (int i=static_cast<int>(CAAConjunctionBody::Object::SUN); i<=static_cast<int>(CAAConjunctionBody::Object::MOON); i++)
+      Bodies.emplace_back(static_cast<CAAConjunctionBody::Object>(i));
+    if (bStars)
+    {
+      const StarCatalogue catalogue;
+      for (size_t i=0; i<nInputs; i++)
+        Bodies.emplace_back(CAACoordinateTransformation::RadiansToHours(catalogue.Alpha[i]), CAACoordinateTransformation::RadiansToDegrees(catalogue.Delta[i]));
+    }
+  }
+
+  vector<CAAConjunctionBody> Bodies;
+};
+
+//The random catalogue held in a CAAStarIndex
+struct StarIndex
+{
+  StarIndex()
+  {
+    const StarCatalogue catalogue;
+    vector<double> Alpha(nInputs);
+    vector<double> Delta(nInputs);
+    for (size_t i=0; i<nInputs; i++)
+    {
+      Alpha[i] = CAACoordinateTransformation::RadiansToHours(catalogue.Alpha[i]);
+      Delta[i] = CAACoordinateTransformation::RadiansToDegrees(catalogue.Delta[i]);
+    }
+    Index = CAAStarIndex(Alpha.data(), Delta.data(), nInputs);
+  }
+
+  CAAStarIndex Index;
+};
+
+vector<CAA2DCoordinate> g_Topocentric(nInputs);
+vector<double> g_Azimuths(nInputs);
+vector<double> g_Altitudes(nInputs);
+vector<double> g_Z(nInputs);
+vector<double> g_DistanceMatrix(nInputs * nInputs);
+vector<CAAObserver> g_Observers(nInputs);
+
+#define AABENCHMARK_VSOP87(CLASS, METHOD) { "CVSOP87::Calculate/" #CLASS "::" #METHOD, [](double JD) noexcept { return CLASS::METHOD(JD); }, JD1900, JD2100 }
+
+#define AABENCHMARK_VSOP87D(CLASS) AABENCHMARK_VSOP87(CLASS, L), AABENCHMARK_VSOP87(CLASS, B), AABENCHMARK_VSOP87(CLASS, R)
+#define AABENCHMARK_VSOP87A(CLASS) AABENCHMARK_VSOP87(CLASS, X), AABENCHMARK_VSOP87(CLASS, Y), AABENCHMARK_VSOP87(CLASS, Z)
+
+#ifdef _MSC_VER
+#pragma warning(suppress : 26426)
+#endif //#ifdef _MSC_VER
+const Benchmark g_Benchmarks[] =
+{
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  //The full VSOP87 theory, one benchmark per table
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Mercury),
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Venus),
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Earth),
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Mars),
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Jupiter),
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Saturn),
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Uranus),
+  AABENCHMARK_VSOP87D(CAAVSOP87D_Neptune),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Mercury),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Venus),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Earth),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_EMB),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Mars),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Jupiter),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Saturn),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Uranus),
+  AABENCHMARK_VSOP87A(CAAVSOP87A_Neptune),
+  { "CVSOP87::Calculate_Dash/CAAVSOP87D_Earth::L_DASH", [](double JD) noexcept { return CAAVSOP87D_Earth::L_DASH(JD); }, JD1900, JD2100 },
+  { "CVSOP87::Calculate_Dash/CAAVSOP87A_Earth::X_DASH", [](double JD) noexcept { return CAAVSOP87A_Earth::X_DASH(JD); }, JD1900, JD2100 },
+  { "CAAVSOP87A_Earth::PositionAndVelocity", [](double JD) noexcept { CAA3DCoordinate Position; CAA3DCoordinate Velocity; CAAVSOP87A_Earth::PositionAndVelocity(JD, Position, Velocity); return Position.X + Velocity.X; }, JD1900, JD2100 },
+  { "CVSOP87Stepper::Step/CAAVSOP87D_Earth::L", [](double /*JD*/) { static CVSOP87Stepper L(CAAVSOP87D_Earth::L_Stepper(2451545, 0.5)); L.Step(); return L.Value(); }, JD1900, JD2100 },
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+
+  //Apparent planetary positions
+  { "CAAElliptical::Calculate/SUN/LowPrecision",      [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::SUN, false).ApparentGeocentricRA; }, JD1900, JD2100 },
+  { "CAAElliptical::Calculate/MARS/LowPrecision",     [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::MARS, false).ApparentGeocentricRA; }, JD1900, JD2100 },
+  { "CAAElliptical::Calculate/JUPITER/LowPrecision",  [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::JUPITER, false).ApparentGeocentricRA; }, JD1900, JD2100 },
+  { "CAAElliptical::Calculate/PLUTO/LowPrecision",    [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::PLUTO, false).ApparentGeocentricRA; }, JD1900, JD2100 },
+  { "CAASun::ApparentPosition/LowPrecision",        [](double JD) noexcept { return CAASun::ApparentPosition(JD, false).ApparentDeclination; }, JD1900, JD2100 },
+  { "CAAPluto::EclipticLongitude",  [](double JD) noexcept { return CAAPluto::EclipticLongitude(JD); }, JD1900, JD2100 },
+  { "CAAPluto::Position",           [](double JD) noexcept { return CAAPluto::Position(JD).EclipticLongitude; }, JD1900, JD2100 },
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  { "CAASun::ApparentPosition/HighPrecision",       [](double JD) noexcept { return CAASun::ApparentPosition(JD, true).ApparentDeclination; }, JD1900, JD2100 },
+  { "CAASun::ApparentEclipticLongitude+Latitude/HighPrecision", [](double JD) noexcept { return CAACoordinateTransformation::Ecliptic2Equatorial(CAASun::ApparentEclipticLongitude(JD, true), CAASun::ApparentEclipticLatitude(JD, true), CAANutation::TrueObliquityOfEcliptic(JD)).Y; }, JD1900, JD2100 },
+  { "CAAElliptical::Calculate/SUN/HighPrecision",     [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::SUN, true).ApparentGeocentricRA; }, JD1900, JD2100 },
+  { "CAAElliptical::Calculate/MARS/HighPrecision",    [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::MARS, true).ApparentGeocentricRA; }, JD1900, JD2100 },
+  { "CAAElliptical::Calculate/JUPITER/HighPrecision", [](double JD) noexcept { return CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::JUPITER, true).ApparentGeocentricRA; }, JD1900, JD2100 },
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+
+  //Physical ephemerides, the batch versions calculate 1024 dates one minute apart per call
+  { "CAAPhysicalMars::Calculate/LowPrecision/1024", [](double JD) { vector<CAAPhysicalMarsDetails> Results(nInputs); for (size_t i=0; i<nInputs; i++) Results[i] = CAAPhysicalMars::Calculate(JD + (i / 1440.0), false); return Results[0].w; }, JD1900, JD2100 },
+  { "CAAPhysicalMars::Calculate/Batch/1024", [](double JD) { vector<double> JDs(nInputs); for (size_t i=0; i<nInputs; i++) JDs[i] = JD + (i / 1440.0); vector<CAAPhysicalMarsDetails> Results(nInputs); CAAPhysicalMars::Calculate(JDs.data(), Results.data(), nInputs, false); return Results[0].w; }, JD1900, JD2100 },
+  { "CAAPhysicalMars+Jupiter+Sun::Calculate/LowPrecision/1024", [](double JD) { double Sum = 0; for (size_t i=0; i<nInputs; i++) { const double JD2 = JD + (i / 1440.0); Sum += CAAPhysicalMars::Calculate(JD2, false).w + CAAPhysicalJupiter::Calculate(JD2, false).Apparentw1 + CAAPhysicalSun::Calculate(JD2, false).L0; } return Sum; }, JD1900, JD2100 },
+  { "CAAPhysicalMars+Jupiter+Sun::Calculate/Epoch/1024", [](double JD) { vector<CAAEarthEpoch> Epochs(nInputs); for (size_t i=0; i<nInputs; i++) Epochs[i] = CAAEarthEpoch(JD + (i / 1440.0), false); vector<CAAPhysicalMarsDetails> Mars(nInputs); vector<CAAPhysicalJupiterDetails> Jupiter(nInputs); vector<CAAPhysicalSunDetails> Sun(nInputs); CAAPhysicalMars::Calculate(Epochs.data(), Mars.data(), nInputs); CAAPhysicalJupiter::Calculate(Epochs.data(), Jupiter.data(), nInputs); CAAPhysicalSun::Calculate(Epochs.data(), Sun.data(), nInputs); return Mars[0].w + Jupiter[0].Apparentw1 + Sun[0].L0; }, JD1900, JD2100 },
+  { "CAASaturnRings::Calculate/LowPrecision/1024", [](double JD) { vector<CAASaturnRingDetails> Results(nInputs); for (size_t i=0; i<nInputs; i++) Results[i] = CAASaturnRings::Calculate(JD + (i / 1440.0), false); return Results[0].B; }, JD1900, JD2100 },
+  { "CAASaturnRings::Calculate/Batch/1024", [](double JD) { vector<double> JDs(nInputs); for (size_t i=0; i<nInputs; i++) JDs[i] = JD + (i / 1440.0); vector<CAASaturnRingDetails> Results(nInputs); CAASaturnRings::Calculate(JDs.data(), Results.data(), nInputs, false); return Results[0].B; }, JD1900, JD2100 },
+  { "CAASaturnMoons::Calculate/LowPrecision/1024", [](double JD) { vector<CAASaturnMoonsDetails> Results(nInputs); for (size_t i=0; i<nInputs; i++) Results[i] = CAASaturnMoons::Calculate(JD + (i / 1440.0), false); return Results[0].Satellite6.ApparentRectangularCoordinates.X; }, JD1900, JD2100 },
+  { "CAASaturnMoons::Calculate/Batch/1024", [](double JD) { vector<double> JDs(nInputs); for (size_t i=0; i<nInputs; i++) JDs[i] = JD + (i / 1440.0); vector<CAASaturnMoonsDetails> Results(nInputs); CAASaturnMoons::Calculate(JDs.data(), Results.data(), nInputs, false); return Results[0].Satellite6.ApparentRectangularCoordinates.X; }, JD1900, JD2100 },
+  { "CAASaturnEpoch/Rings+Moons/1024", [](double JD) { vector<CAASaturnEpoch> Epochs(nInputs); double PreviousLightTravelTime = 0; for (size_t i=0; i<nInputs; i++) { Epochs[i] = CAASaturnEpoch(CAAEarthEpoch(JD + (i / 1440.0), false), PreviousLightTravelTime); PreviousLightTravelTime = Epochs[i].LightTravelTime; } vector<CAASaturnRingDetails> Rings(nInputs); CAASaturnRings::Calculate(Epochs.data(), Rings.data(), nInputs); vector<CAASaturnMoonsDetails> Moons(nInputs); CAASaturnMoons::Calculate(Epochs.data(), Moons.data(), nInputs); return Rings[0].B + Moons[0].Satellite6.ApparentRectangularCoordinates.X; }, JD1900, JD2100 },
+
+  //The Moon
+#ifndef AAPLUS_ELP2000_NO_HIGH_PRECISION
+  { "CAAELP2000::EclipticLongitude", [](double JD) noexcept { return CAAELP2000::EclipticLongitude(JD); }, JD1900, JD2100 },
+  { "CAAELP2000::EclipticLatitude",  [](double JD) noexcept { return CAAELP2000::EclipticLatitude(JD); }, JD1900, JD2100 },
+  { "CAAELP2000::RadiusVector",      [](double JD) noexcept { return CAAELP2000::RadiusVector(JD); }, JD1900, JD2100 },
+  { "CAAELP2000Stepper::EclipticLongitude/Stepped", [](double /*JD*/) { static CAAELP2000Stepper moon(2451545, 0.01); static long nStep = 0; return moon.EclipticLongitude(2451545 + (++nStep * 0.01)); }, JD1900, JD2100 },
+#endif //#ifndef AAPLUS_ELP2000_NO_HIGH_PRECISION
+  { "CAAMoonPhases::TruePhase",       [](double JD) noexcept { return CAAMoonPhases::TruePhase(floor(CAAMoonPhases::K(2000 + ((JD - 2451545) / 365.25)))); }, JD1900, JD2100 },
+  { "CAAMoonPhases::TruePhase/Batch/1024", [](double JD) { vector<double> K(nInputs); const double k = floor(CAAMoonPhases::K(2000 + ((JD - 2451545) / 365.25))); for (size_t i=0; i<nInputs; i++) K[i] = k + (i * 0.25); vector<double> Results(nInputs); CAAMoonPhases::TruePhase(K.data(), Results.data(), nInputs); return Results[0]; }, JD1900, JD2100 },
+  { "CAAMoonPhases::TruePhase/HighPrecision", [](double JD) noexcept { return CAAMoonPhases::TruePhase(floor(CAAMoonPhases::K(2000 + ((JD - 2451545) / 365.25))), true); }, JD1900, JD2100 },
+  { "CAAMoonPerigeeApogee::TruePerigee", [](double JD) noexcept { return CAAMoonPerigeeApogee::TruePerigee(floor(CAAMoonPerigeeApogee::K(2000 + ((JD - 2451545) / 365.25)))); }, JD1900, JD2100 },
+  { "CAAMoonPerigeeApogee::TruePerigee/Batch/1024", [](double JD) { vector<double> K(nInputs); const double k = floor(CAAMoonPerigeeApogee::K(2000 + ((JD - 2451545) / 365.25))); for (size_t i=0; i<nInputs; i++) K[i] = k + i; vector<double> Results(nInputs); CAAMoonPerigeeApogee::TruePerigee(K.data(), Results.data(), nInputs); return Results[0]; }, JD1900, JD2100 },
+  { "CAAMoonPerigeeApogee::TruePerigee/HighPrecision", [](double JD) noexcept { return CAAMoonPerigeeApogee::TruePerigee(floor(CAAMoonPerigeeApogee::K(2000 + ((JD - 2451545) / 365.25))), true); }, JD1900, JD2100 },
+  { "CAAMoonNodes::PassageThroNode",   [](double JD) noexcept { return CAAMoonNodes::PassageThroNode(floor(CAAMoonNodes::K(2000 + ((JD - 2451545) / 365.25)))); }, JD1900, JD2100 },
+  { "CAAMoonNodes::PassageThroNode/Batch/1024", [](double JD) { vector<double> K(nInputs); const double k = floor(CAAMoonNodes::K(2000 + ((JD - 2451545) / 365.25))); for (size_t i=0; i<nInputs; i++) K[i] = k + (i * 0.5); vector<double> Results(nInputs); CAAMoonNodes::PassageThroNode(K.data(), Results.data(), nInputs); return Results[0]; }, JD1900, JD2100 },
+  { "CAAMoon::EclipticLongitude",    [](double JD) noexcept { return CAAMoon::EclipticLongitude(JD); }, JD1900, JD2100 },
+  { "CAAMoon::EclipticLatitude",     [](double JD) noexcept { return CAAMoon::EclipticLatitude(JD); }, JD1900, JD2100 },
+  { "CAAMoon::RadiusVector",         [](double JD) noexcept { return CAAMoon::RadiusVector(JD); }, JD1900, JD2100 },
+
+  //Aberration
+  { "CAAAberration::EarthVelocity/LowPrecision",  [](double JD) noexcept { return CAAAberration::EarthVelocity(JD, false).X; }, JD1900, JD2100 },
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  { "CAAAberration::EarthVelocity/HighPrecision", [](double JD) noexcept { return CAAAberration::EarthVelocity(JD, true).X; }, JD1900, JD2100 },
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  { "CAAAberration::EquatorialAberration/LowPrecision/1024", [](double JD) { static const StarCatalogue catalogue; for (size_t i=0; i<nInputs; i++) g_Topocentric[i] = CAAAberration::EquatorialAberration(catalogue.Alpha[i], catalogue.Delta[i], JD, false); return g_Topocentric[0].X; }, JD1900, JD2100 },
+  { "CAAAberration::EquatorialAberration/Epoch/1024", [](double JD) { static const StarCatalogue catalogue; CAAAberration::EquatorialAberration(catalogue.Alpha.data(), catalogue.Delta.data(), CAAAberrationEpoch(JD, false), g_Topocentric.data(), nInputs); return g_Topocentric[0].X; }, JD1900, JD2100 },
+
+  //Nutation, sidereal time and time scales
+  { "CAANutation::NutationInLongitude",          [](double JD) noexcept { return CAANutation::NutationInLongitude(JD); }, JD1900, JD2100 },
+  { "CAANutation::NutationInObliquity",          [](double JD) noexcept { return CAANutation::NutationInObliquity(JD); }, JD1900, JD2100 },
+  { "CAANutation::TrueObliquityOfEcliptic",      [](double JD) noexcept { return CAANutation::TrueObliquityOfEcliptic(JD); }, JD1900, JD2100 },
+  { "CAANutationStepper::NutationInLongitude/Stepped", [](double /*JD*/) { static CAANutationStepper nutation(2451545, 0.5); static long nStep = 0; return nutation.NutationInLongitude(2451545 + (++nStep * 0.5)); }, JD1900, JD2100 },
+  { "CAASidereal::ApparentGreenwichSiderealTime", [](double JD) noexcept { return CAASidereal::ApparentGreenwichSiderealTime(JD); }, JD1900, JD2100 },
+  { "CAADynamicalTime::DeltaT",                  [](double JD) noexcept { return CAADynamicalTime::DeltaT(JD); }, JD1900, JD2100 },
+  { "CAADynamicalTime::UTC2TT",                  [](double JD) noexcept { return CAADynamicalTime::UTC2TT(JD); }, JD1900, JD2100 },
+  { "CAADynamicalTime::DeltaT/Polynomial",       [](double JD) noexcept { return CAADynamicalTime::DeltaT(JD); }, 1000000, 2400000 },
+  { "CAADynamicalTime::CumulativeLeapSeconds",   [](double JD) noexcept { return CAADynamicalTime::CumulativeLeapSeconds(JD); }, JD1900, JD2100 },
+
+  //Coordinate transformations, X is the local sidereal time in hours and the batch versions convert a catalogue of 1024 stars per call
+  { "CAACoordinateTransformation::Equatorial2Horizontal", [](double LST) noexcept { return CAACoordinateTransformation::Equatorial2Horizontal(LST - 6.7525, -16.7161, BostonLatitude).Y; }, 0, 24 },
+  { "CAAFrameTransformation::Transform/Spherical/1024", [](double LST) { static const StarCatalogue catalogue; CAAFrameTransformation::Equatorial2Horizontal(CAACoordinateTransformation::HoursToRadians(LST), CAACoordinateTransformation::DegreesToRadians(BostonLatitude)).Transform(catalogue.Alpha.data(), catalogue.Delta.data(), g_Azimuths.data(), g_Altitudes.data(), nInputs); return g_Altitudes[0]; }, 0, 24 },
+  { "CAAFrameTransformation::Transform/UnitVector/1024", [](double LST) { static const StarCatalogue catalogue; CAAFrameTransformation::Equatorial2Horizontal(CAACoordinateTransformation::HoursToRadians(LST), CAACoordinateTransformation::DegreesToRadians(BostonLatitude)).Transform(catalogue.X.data(), catalogue.Y.data(), catalogue.Z.data(), g_Azimuths.data(), g_Altitudes.data(), g_Z.data(), nInputs); return g_Z[0]; }, 0, 24 },
+
+  //Atmospheric refraction, X is the true altitude in degrees and the batch versions refract a catalogue of 1024 altitudes per call
+  { "CAARefraction::RefractionFromTrue", [](double Altitude) noexcept { return CAARefraction::RefractionFromTrue(Altitude); }, -2, 90 },
+  { "CAARefraction::RefractionFromTrue/1024", [](double /*Altitude*/) { static const AltitudeCatalogue catalogue; CAARefraction::RefractionFromTrue(catalogue.Altitudes.data(), g_Z.data(), nInputs); return g_Z[0]; }, -2, 90 },
+  { "CAARefractionTable::RefractionFromTrue", [](double Altitude) { static const CAARefractionTable table; return table.RefractionFromTrue(Altitude); }, -2, 90 },
+  { "CAARefractionTable::RefractionFromTrue/1024", [](double /*Altitude*/) { static const AltitudeCatalogue catalogue; static const CAARefractionTable table; table.RefractionFromTrue(catalogue.Altitudes.data(), g_Z.data(), nInputs); return g_Z[0]; }, -2, 90 },
+  { "CAARefractionTable::InverseRefractionFromTrue", [](double Altitude) { static const CAARefractionTable table; return table.InverseRefractionFromTrue(Altitude); }, -2, 90 },
+
+  //Topocentric parallax of the Moon, the batch version converts for 1024 observers per call
+  { "CAAParallax::Equatorial2Topocentric", [](double JD) noexcept { return CAAParallax::Equatorial2Topocentric(10.5, 12.3, 0.0025, BostonLongitude, BostonLatitude, 0, JD).X; }, JD1900, JD2100 },
+  { "CAAParallax::Equatorial2Topocentric/Observers/1024", [](double JD) { static const ObserverNetwork network; CAAParallax::Equatorial2Topocentric(10.5, 12.3, 0.0025, network.Observers.data(), CAATopocentricEpoch(JD), g_Topocentric.data(), nInputs); return g_Topocentric[0].X; }, JD1900, JD2100 },
+
+  //The Earth's globe, X is a latitude in degrees and the batch versions calculate for a network of 1024 sites per call
+  { "CAAGlobe::RhoSinThetaPrime", [](double Latitude) noexcept { return CAAGlobe::RhoSinThetaPrime(Latitude, 100); }, -90, 90 },
+  { "CAAGlobe::RhoSinThetaPrime/1024", [](double /*Latitude*/) { static const ObserverNetwork network; CAAGlobe::RhoSinThetaPrime(network.Latitude.data(), network.Height.data(), g_Z.data(), nInputs); return g_Z[0]; }, -90, 90 },
+  { "CAAGlobe::RadiusOfCurvature", [](double Latitude) noexcept { return CAAGlobe::RadiusOfCurvature(Latitude); }, -90, 90 },
+  { "CAAGlobe::RadiusOfCurvature/1024", [](double /*Latitude*/) { static const ObserverNetwork network; CAAGlobe::RadiusOfCurvature(network.Latitude.data(), g_Z.data(), nInputs); return g_Z[0]; }, -90, 90 },
+  { "CAAGlobe::DistanceBetweenPoints", [](double Latitude) noexcept { return CAAGlobe::DistanceBetweenPoints(Latitude, 0, BostonLatitude, BostonLongitude); }, -90, 90 },
+  { "CAAGlobe::DistanceBetweenPoints/1024", [](double /*Latitude*/) { static const ObserverNetwork network; CAAGlobe::DistanceBetweenPoints(network.Latitude.data(), network.Longitude.data(), network.ReversedLatitude.data(), network.ReversedLongitude.data(), g_Z.data(), nInputs); return g_Z[0]; }, -90, 90 },
+  { "CAAGlobe::DistanceMatrix/1024", [](double /*Latitude*/) { static const ObserverNetwork network; CAAGlobe::DistanceMatrix(network.Latitude.data(), network.Longitude.data(), g_DistanceMatrix.data(), nInputs); return g_DistanceMatrix[1]; }, -90, 90 },
+  { "CAAGlobe::DistanceMatrix/1024/SingleThread", [](double /*Latitude*/) { static const ObserverNetwork network; CAAGlobe::DistanceMatrix(network.Latitude.data(), network.Longitude.data(), g_DistanceMatrix.data(), nInputs, 1); return g_DistanceMatrix[1]; }, -90, 90 },
+  { "CAAGlobe::Observers/1024", [](double /*Latitude*/) { static const ObserverNetwork network; CAAGlobe::Observers(network.Longitude.data(), network.Latitude.data(), network.Height.data(), g_Observers.data(), nInputs); return g_Observers[0].RhoCosThetaPrime; }, -90, 90 },
+
+  //Kepler's equation, X is the mean anomaly in degrees
+  { "CAAKepler::Calculate/e=0.1", [](double M) noexcept { return CAAKepler::Calculate(M, 0.1); }, 0, 360 },
+  { "CAAKepler::Calculate/e=0.9", [](double M) noexcept { return CAAKepler::Calculate(M, 0.9); }, 0, 360 },
+
+  //The range scanners, each call scans one simulated day starting at X
+  { "CAARiseTransitSet2::Calculate/SUN/PerDay",  [](double JD) { return static_cast<double>(CAARiseTransitSet2::Calculate(JD, JD + 1, CAARiseTransitSet2::Object::SUN, BostonLongitude, BostonLatitude, -0.8333).size()); }, JD1900, JD2100 },
+  { "CAARiseTransitSet2::Calculate/MARS/PerDay", [](double JD) { return static_cast<double>(CAARiseTransitSet2::Calculate(JD, JD + 1, CAARiseTransitSet2::Object::MARS, BostonLongitude, BostonLatitude, -0.5667).size()); }, JD1900, JD2100 },
+  { "CAARiseTransitSet2::CalculateMoon/PerDay",  [](double JD) { return static_cast<double>(CAARiseTransitSet2::CalculateMoon(JD, JD + 1, BostonLongitude, BostonLatitude).size()); }, JD1900, JD2100 },
+  { "CAARiseTransitSet2::CalculateStationary/PerDay", [](double JD) { return static_cast<double>(CAARiseTransitSet2::CalculateStationary(JD, JD + 1, 6.7525, -16.7161, BostonLongitude, BostonLatitude).size()); }, JD1900, JD2100 },
+  { "CAAEquinoxesAndSolstices2::Calculate/PerDay", [](double JD) { return static_cast<double>(CAAEquinoxesAndSolstices2::Calculate(JD, JD + 1).size()); }, JD1900, JD2100 },
+  { "CAASaturnRings::CalculateEvents/PerDecade", [](double JD) { return static_cast<double>(CAASaturnRings::CalculateEvents(JD, JD + 3652.5).size()); }, JD1900, JD2100 },
+  { "CAAConjunctions::Calculate/Planets/PerYear", [](double JD) { static const ConjunctionBodies bodies(false); return static_cast<double>(CAAConjunctions::Calculate(JD, JD + 365.25, bodies.Bodies, 1).size()); }, JD1900, JD2100 },
+  { "CAAConjunctions::Calculate/Planets+Stars/1024/PerMonth", [](double JD) { static const ConjunctionBodies bodies(true); return static_cast<double>(CAAConjunctions::Calculate(JD, JD + 30, bodies.Bodies, 1).size()); }, JD1900, JD2100 },
+  { "CAAOccultations::Calculate/1024/PerYear", [](double JD) { static const StarIndex stars; static const vector<CAAObserver> observers(1, CAAObserver(BostonLongitude, BostonLatitude, 0)); return static_cast<double>(CAAOccultations::Calculate(JD, JD + 365.25, stars.Index, observers).size()); }, JD1900, JD2100 },
+  { "CAALunations::Calculate/PerYear", [](double JD) { return static_cast<double>(CAALunations::Calculate(JD, JD + 365.25).size()); }, JD1900, JD2100 },
+  { "CAAMoonMaxDeclinations2::Calculate/MeeusTruncated/PerDay", [](double JD) { return static_cast<double>(CAAMoonMaxDeclinations2::Calculate(JD, JD + 1, 0.007, CAAMoonMaxDeclinations2::Algorithm::MeeusTruncated).size()); }, JD1900, JD2100 },
+};
+
+
+/////////////////////////////// Implementation ////////////////////////////////
+
+double TimeIterations(const Benchmark& benchmark, const vector<double>& inputs, uint64_t nIterations)
+{
+  const auto start = chrono::steady_clock::now();
+  double fSum = 0;
+  for (uint64_t i=0; i<nIterations; i++)
+    fSum += benchmark.pFunction(inputs[i & (nInputs - 1)]);
+  const auto finish = chrono::steady_clock::now();
+  g_fSink = fSum;
+
+  return chrono::duration<double>(finish - start).count();
+}
+
+BenchmarkResult RunBenchmark(const Benchmark& benchmark, const BenchmarkOptions& options)
+{
+  //Generate the inputs from the fixed seed, so that every run sees the same values
+  mt19937_64 generator(options.nSeed);
+  uniform_real_distribution<double> distribution(benchmark.fMinX, benchmark.fMaxX);
+  vector<double> inputs(nInputs);
+  for (auto& input : inputs)
+    input = distribution(generator);
+
+  //Find the number of iterations which takes at least the minimum time, growing the count by at most
+  //a factor of 10 each time as Google Benchmark does
+  uint64_t nIterations = 1;
+  for (;;)
+  {
+    const double fElapsed = TimeIterations(benchmark, inputs, nIterations);
+    if ((fElapsed >= options.fMinTime) || (nIterations >= 1000000000))
+      break;
+    double fMultiplier = (fElapsed > 0) ? (options.fMinTime * 1.4 / fElapsed) : 10;
+    if (fMultiplier > 10)
+      fMultiplier = 10;
+    nIterations = max(nIterations + 1, static_cast<uint64_t>(nIterations * fMultiplier));
+  }
+
+  //Then time the repetitions and report the median
+  vector<double> timings;
+  for (int i=0; i<options.nRepetitions; i++)
+    timings.push_back(TimeIterations(benchmark, inputs, nIterations) * 1e9 / nIterations);
+  sort(timings.begin(), timings.end());
+
+  BenchmarkResult result;
+  result.sName = benchmark.pszName;
+  result.nIterations = nIterations;
+  result.fNanosecondsPerCall = timings[timings.size() / 2];
+  result.fCallsPerSecond = 1e9 / result.fNanosecondsPerCall;
+  return result;
+}
+
+bool WriteJSON(const string& sFile, const vector<BenchmarkResult>& results, const BenchmarkOptions& options)
+{
+  FILE* pFile = fopen(sFile.c_str(), "w");
+  if (pFile == nullptr)
+    return false;
+
+  char szDate[64];
+  const time_t now = time(nullptr);
+  strftime(szDate, sizeof(szDate), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+  fprintf(pFile, "{\n");
+  fprintf(pFile, "  \"context\": {\n");
+  fprintf(pFile, "    \"date\": \"%s\",\n", szDate);
+  fprintf(pFile, "    \"num_cpus\": %u,\n", thread::hardware_concurrency());
+#ifdef NDEBUG
+  fprintf(pFile, "    \"library_build_type\": \"release\",\n");
+#else
+  fprintf(pFile, "    \"library_build_type\": \"debug\",\n");
+#endif //#ifdef NDEBUG
+  fprintf(pFile, "    \"seed\": %llu,\n", static_cast<unsigned long long>(options.nSeed));
+  fprintf(pFile, "    \"min_time\": %g,\n", options.fMinTime);
+  fprintf(pFile, "    \"repetitions\": %d\n", options.nRepetitions);
+  fprintf(pFile, "  },\n");
+  fprintf(pFile, "  \"benchmarks\": [\n");
+  for (size_t i=0; i<results.size(); i++)
+  {
+    fprintf(pFile, "    {\n");
+    fprintf(pFile, "      \"name\": \"%s\",\n", results[i].sName.c_str());
+    fprintf(pFile, "      \"iterations\": %llu,\n", static_cast<unsigned long long>(results[i].nIterations));
+    fprintf(pFile, "      \"real_time\": %.6f,\n", results[i].fNanosecondsPerCall);
+    fprintf(pFile, "      \"time_unit\": \"ns\",\n");
+    fprintf(pFile, "      \"items_per_second\": %.3f\n", results[i].fCallsPerSecond);
+    fprintf(pFile, "    }%s\n", (i + 1 < results.size()) ? "," : "");
+  }
+  fprintf(pFile, "  ]\n");
+  fprintf(pFile, "}\n");
+  fclose(pFile);
+
+  return true;
+}
+
+//A minimal reader for the JSON written by WriteJSON (or by Google Benchmark), which only picks out the
+//"name" and "real_time" values of each benchmark
+bool ReadBaseline(const string& sFile, map<string, double>& baseline)
+{
+  FILE* pFile = fopen(sFile.c_str(), "r");
+  if (pFile == nullptr)
+    return false;
+  string sJSON;
+  char szBuffer[4096];
+  size_t nRead = 0;
+  while ((nRead = fread(szBuffer, 1, sizeof(szBuffer), pFile)) > 0)
+    sJSON.append(szBuffer, nRead);
+  fclose(pFile);
+
+  size_t nPos = 0;
+  while ((nPos = sJSON.find("\"name\"", nPos)) != string::npos)
+  {
+    const size_t nStart = sJSON.find('"', sJSON.find(':', nPos));
+    const size_t nEnd = sJSON.find('"', nStart + 1);
+    const size_t nTime = sJSON.find("\"real_time\"", nEnd);
+    if ((nStart == string::npos) || (nEnd == string::npos) || (nTime == string::npos))
+      break;
+    const string sName = sJSON.substr(nStart + 1, nEnd - nStart - 1);
+    baseline[sName] = strtod(sJSON.c_str() + sJSON.find(':', nTime) + 1, nullptr);
+    nPos = nTime;
+  }
+
+  return true;
+}
+
+int CompareWithBaseline(const vector<BenchmarkResult>& results, const map<string, double>& baseline, double fThreshold)
+{
+  int nRegressions = 0;
+  printf("\n%-72s %14s %14s %9s\n", "Comparison against baseline", "Baseline ns", "Current ns", "Change");
+  for (const auto& result : results)
+  {
+    const auto iter = baseline.find(result.sName);
+    if (iter == baseline.end())
+    {
+      printf("%-72s %14s %14.1f %9s\n", result.sName.c_str(), "-", result.fNanosecondsPerCall, "new");
+      continue;
+    }
+    const double fChange = (result.fNanosecondsPerCall - iter->second) * 100 / iter->second;
+    const bool bRegression = (fChange > fThreshold);
+    if (bRegression)
+      ++nRegressions;
+    printf("%-72s %14.1f %14.1f %+8.1f%%%s\n", result.sName.c_str(), iter->second, result.fNanosecondsPerCall, fChange, bRegression ? " REGRESSION" : "");
+  }
+  if (nRegressions)
+    printf("\n%d benchmark(s) regressed by more than %g%%\n", nRegressions, fThreshold);
+
+  return nRegressions;
+}
+
+bool ParseOption(const char* pszArg, const char* pszName, const char*& pszValue) noexcept
+{
+  const size_t nLength = strlen(pszName);
+  if ((strncmp(pszArg, pszName, nLength) != 0) || (pszArg[nLength] != '='))
+    return false;
+  pszValue = pszArg + nLength + 1;
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  BenchmarkOptions options;
+  options.fMinTime = 0.5;
+  options.nRepetitions = 3;
+  options.nSeed = 20260101;
+  options.fThreshold = 10;
+  options.bList = false;
+  for (int i=1; i<argc; i++)
+  {
+    const char* pszValue = nullptr;
+    if (ParseOption(argv[i], "--benchmark_filter", pszValue))
+      options.sFilter = pszValue;
+    else if (ParseOption(argv[i], "--benchmark_min_time", pszValue))
+      options.fMinTime = atof(pszValue);
+    else if (ParseOption(argv[i], "--benchmark_repetitions", pszValue))
+      options.nRepetitions = max(1, atoi(pszValue));
+    else if (ParseOption(argv[i], "--benchmark_seed", pszValue))
+      options.nSeed = strtoull(pszValue, nullptr, 10);
+    else if (ParseOption(argv[i], "--benchmark_out", pszValue))
+      options.sOutFile = pszValue;
+    else if (ParseOption(argv[i], "--benchmark_baseline", pszValue))
+      options.sBaselineFile = pszValue;
+    else if (ParseOption(argv[i], "--benchmark_threshold", pszValue))
+      options.fThreshold = atof(pszValue);
+    else if (strcmp(argv[i], "--benchmark_list") == 0)
+      options.bList = true;
+    else
+    {
+      fprintf(stderr, "Unrecognized option: %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+#ifndef NDEBUG
+  printf("***WARNING*** AA+ was built without NDEBUG defined, timings will not be representative\n");
+#endif //#ifndef NDEBUG
+
+  const regex filter(options.sFilter.empty() ? string(".*") : options.sFilter);
+  vector<BenchmarkResult> results;
+  if (!options.bList)
+    printf("%-72s %14s %16s %12s\n", "Benchmark", "ns/call", "calls/sec", "Iterations");
+  for (const auto& benchmark : g_Benchmarks)
+  {
+    if (!regex_search(benchmark.pszName, filter))
+      continue;
+    if (options.bList)
+    {
+      printf("%s\n", benchmark.pszName);
+      continue;
+    }
+
+    const BenchmarkResult result = RunBenchmark(benchmark, options);
+    printf("%-72s %14.1f %16.1f %12llu\n", result.sName.c_str(), result.fNanosecondsPerCall, result.fCallsPerSecond, static_cast<unsigned long long>(result.nIterations));
+    fflush(stdout);
+    results.push_back(result);
+  }
+  if (options.bList)
+    return 0;
+
+  if (!options.sOutFile.empty() && !WriteJSON(options.sOutFile, results, options))
+  {
+    fprintf(stderr, "Failed to write results to %s\n", options.sOutFile.c_str());
+    return 2;
+  }
+
+  if (!options.sBaselineFile.empty())
+  {
+    map<string, double> baseline;
+    if (!ReadBaseline(options.sBaselineFile, baseline))
+    {
+      fprintf(stderr, "Failed to read baseline from %s\n", options.sBaselineFile.c_str());
+      return 2;
+    }
+    if (CompareWithBaseline(results, baseline, options.fThreshold))
+      return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,283 @@
+/*
+Module : AAConjunctions.cpp
+Purpose: Implementation for a search for the conjunctions and close approaches between any number of bodies
+Created: 18-10-2026
+History: None
+
+*/
+
+
+////////////////////// Includes ///////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AAConjunctions.h"
+#include "AAAngularSeparation.h"
+#include "AAAberration.h"
+#include "AACoordinateTransformation.h"
+#include "AAElliptical.h"
+#include "AAEventFinder.h"
+#include "AAMoon.h"
+#include "AANutation.h"
+#include "AARotation.h"
+#include "AASun.h"
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+using namespace std;
+
+
+////////////////////// Macros / Defines ///////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26482)
+#endif //#ifdef _MSC_VER
+
+constexpr size_t AACONJUNCTIONS_BLOCK_SIZE = 256; //The number of nodes tabulated at a time
+
+constexpr double AACONJUNCTIONS_SPEED_OF_LIGHT = 17314463350.0; //In the units of CAAAberration::EarthVelocity
+
+//An allowance for the difference between the truncated theories used for the tabulation and the full theories
+//used for the refinement, in degrees
+constexpr double AACONJUNCTIONS_TABULATION_TOLERANCE = 0.01;
+
+constexpr double AACONJUNCTIONS_TOLERANCE = 1e-5; //The tolerance to which each close approach is refined in days
+
+
+////////////////////// Implementation /////////////////////////////////////////
+
+//The apparent place of a star as a unit vector for the true equator and equinox of date. The aberration is applied
+//to first order as a vector in the frame of J2000.0 in which the velocity of the Earth is given, and the result
+//is then rotated by the precession and nutation from J2000.0 to the date
+static void StarUnitVector(double X, double Y, double Z, const CAA3DCoordinate& Beta, const CAARotationMatrix& Frame, double& XResult, double& YResult, double& ZResult) noexcept
+{
+  const double Dot = (X*Beta.X) + (Y*Beta.Y) + (Z*Beta.Z);
+  double AberratedX = X + Beta.X - (Dot*X);
+  double AberratedY = Y + Beta.Y - (Dot*Y);
+  double AberratedZ = Z + Beta.Z - (Dot*Z);
+  const double Length = sqrt((AberratedX*AberratedX) + (AberratedY*AberratedY) + (AberratedZ*AberratedZ));
+  AberratedX /= Length;
+  AberratedY /= Length;
+  AberratedZ /= Length;
+  XResult = (Frame.M[0][0]*AberratedX) + (Frame.M[0][1]*AberratedY) + (Frame.M[0][2]*AberratedZ);
+  YResult = (Frame.M[1][0]*AberratedX) + (Frame.M[1][1]*AberratedY) + (Frame.M[1][2]*AberratedZ);
+  ZResult = (Frame.M[2][0]*AberratedX) + (Frame.M[2][1]*AberratedY) + (Frame.M[2][2]*AberratedZ);
+}
+
+static CAA3DCoordinate AberrationVelocity(double JD, bool bHighPrecision) noexcept
+{
+  CAA3DCoordinate Beta = CAAAberration::EarthVelocity(JD, bHighPrecision);
+  Beta.X /= AACONJUNCTIONS_SPEED_OF_LIGHT;
+  Beta.Y /= AACONJUNCTIONS_SPEED_OF_LIGHT;
+  Beta.Z /= AACONJUNCTIONS_SPEED_OF_LIGHT;
+  return Beta;
+}
+
+static CAARotationMatrix StarFrame(double JD) noexcept
+{
+  return CAARotationMatrix::Nutation(JD) * CAARotationMatrix::Precession(2451545, JD);
+}
+
+CAA2DCoordinate CAAConjunctions::ApparentPosition(const CAAConjunctionBody& body, double JD, bool bHighPrecision) noexcept
+{
+  //What will be the return value
+  CAA2DCoordinate Position;
+
+  switch (body.object)
+  {
+    case CAAConjunctionBody::Object::SUN:
+    {
+      const CAASunApparentPositionDetails details = CAASun::ApparentPosition(JD, bHighPrecision);
+      Position.X = details.ApparentRightAscension;
+      Position.Y = details.ApparentDeclination;
+      break;
+    }
+    case CAAConjunctionBody::Object::MOON:
+    {
+      const double Longitude = CAAMoon::EclipticLongitude(JD) + (CAANutation::NutationInLongitude(JD) / 3600);
+      Position = CAACoordinateTransformation::Ecliptic2Equatorial(Longitude, CAAMoon::EclipticLatitude(JD), CAANutation::TrueObliquityOfEcliptic(JD));
+      break;
+    }
+    case CAAConjunctionBody::Object::STAR:
+    {
+      const double Alpha = CAACoordinateTransformation::HoursToRadians(body.Alpha);
+      const double Delta = CAACoordinateTransformation::DegreesToRadians(body.Delta);
+      double X = 0;
+      double Y = 0;
+      double Z = 0;
+      StarUnitVector(cos(Delta)*cos(Alpha), cos(Delta)*sin(Alpha), sin(Delta), AberrationVelocity(JD, bHighPrecision), StarFrame(JD), X, Y, Z);
+      Position.X = CAACoordinateTransformation::MapTo0To24Range(CAACoordinateTransformation::RadiansToHours(atan2(Y, X)));
+      Position.Y = CAACoordinateTransformation::RadiansToDegrees(atan2(Z, sqrt((X*X) + (Y*Y))));
+      break;
+    }
+    default:
+    {
+      //The planets are in the same order as CAAElliptical::EllipticalObject
+      const CAAEllipticalPlanetaryDetails details = CAAElliptical::Calculate(JD, static_cast<CAAElliptical::EllipticalObject>(body.object), bHighPrecision);
+      Position.X = details.ApparentGeocentricRA;
+      Position.Y = details.ApparentGeocentricDeclination;
+      break;
+    }
+  }
+
+  return Position;
+}
+
+vector<CAAConjunctionDetails> CAAConjunctions::Calculate(double StartJD, double EndJD, const vector<CAAConjunctionBody>& bodies, double MaxSeparation, double StepInterval, bool bHighPrecision)
+{
+  //Validate our parameters
+  assert(StepInterval > 0);
+
+  //What will be the return value
+  vector<CAAConjunctionDetails> events;
+
+  const size_t nBodies = bodies.size();
+  if ((nBodies < 2) || (EndJD <= StartJD))
+    return events;
+  const size_t nNodes = static_cast<size_t>(floor((EndJD - StartJD) / StepInterval)) + 1;
+
+  //The J2000.0 unit vectors of the stars
+  vector<double> StarX(nBodies);
+  vector<double> StarY(nBodies);
+  vector<double> StarZ(nBodies);
+  for (size_t i=0; i<nBodies; i++)
+  {
+    if (bodies[i].object == CAAConjunctionBody::Object::STAR)
+    {
+      const double Alpha = CAACoordinateTransformation::HoursToRadians(bodies[i].Alpha);
+      const double Delta = CAACoordinateTransformation::DegreesToRadians(bodies[i].Delta);
+      StarX[i] = cos(Delta)*cos(Alpha);
+      StarY[i] = cos(Delta)*sin(Alpha);
+      StarZ[i] = sin(Delta);
+    }
+  }
+
+  //The unit vectors of each body at each node of a block are held body by body, along with the angle through which
+  //each body moves from one node to the next
+  vector<double> X(nBodies * AACONJUNCTIONS_BLOCK_SIZE);
+  vector<double> Y(nBodies * AACONJUNCTIONS_BLOCK_SIZE);
+  vector<double> Z(nBodies * AACONJUNCTIONS_BLOCK_SIZE);
+  vector<double> Motion(nBodies * AACONJUNCTIONS_BLOCK_SIZE);
+  vector<double> Alpha(AACONJUNCTIONS_BLOCK_SIZE);
+  vector<double> Delta(AACONJUNCTIONS_BLOCK_SIZE);
+  vector<double> Dot(AACONJUNCTIONS_BLOCK_SIZE);
+
+  //Each block overlaps the previous one by two nodes, so that every interior node is checked exactly once
+  for (size_t nBlockStart=0; nBlockStart<nNodes; nBlockStart+=(AACONJUNCTIONS_BLOCK_SIZE - 2))
+  {
+    const size_t nBlockEnd = min(nNodes, nBlockStart + AACONJUNCTIONS_BLOCK_SIZE);
+    const size_t n = nBlockEnd - nBlockStart;
+    if (n < 3)
+      break;
+
+    //Tabulate the positions of the bodies which move, one body at a time
+    for (size_t i=0; i<nBodies; i++)
+    {
+      if (bodies[i].object == CAAConjunctionBody::Object::STAR)
+        continue;
+      for (size_t k=0; k<n; k++)
+      {
+        const CAA2DCoordinate Position = ApparentPosition(bodies[i], StartJD + ((nBlockStart + k) * StepInterval), false);
+        Alpha[k] = CAACoordinateTransformation::HoursToRadians(Position.X);
+        Delta[k] = CAACoordinateTransformation::DegreesToRadians(Position.Y);
+      }
+      CAAFrameTransformation::SphericalToUnitVector(Alpha.data(), Delta.data(), &X[i * AACONJUNCTIONS_BLOCK_SIZE], &Y[i * AACONJUNCTIONS_BLOCK_SIZE], &Z[i * AACONJUNCTIONS_BLOCK_SIZE], n);
+    }
+
+    //The stars share the frame and aberration of each node
+    for (size_t k=0; k<n; k++)
+    {
+      const double JD = StartJD + ((nBlockStart + k) * StepInterval);
+      const CAARotationMatrix Frame = StarFrame(JD);
+      const CAA3DCoordinate Beta = AberrationVelocity(JD, false);
+      for (size_t i=0; i<nBodies; i++)
+      {
+        if (bodies[i].object == CAAConjunctionBody::Object::STAR)
+        {
+          const size_t nIndex = (i * AACONJUNCTIONS_BLOCK_SIZE) + k;
+          StarUnitVector(StarX[i], StarY[i], StarZ[i], Beta, Frame, X[nIndex], Y[nIndex], Z[nIndex]);
+        }
+      }
+    }
+
+    //The angle moved through between nodes, from the chord between the unit vectors
+    for (size_t i=0; i<nBodies; i++)
+    {
+      const size_t nOffset = i * AACONJUNCTIONS_BLOCK_SIZE;
+      for (size_t k=0; (k + 1)<n; k++)
+      {
+        const double dX = X[nOffset + k + 1] - X[nOffset + k];
+        const double dY = Y[nOffset + k + 1] - Y[nOffset + k];
+        const double dZ = Z[nOffset + k + 1] - Z[nOffset + k];
+        Motion[nOffset + k] = CAACoordinateTransformation::RadiansToDegrees(2 * asin(min(1.0, sqrt((dX*dX) + (dY*dY) + (dZ*dZ)) / 2)));
+      }
+    }
+
+    //Then look for the local minima of the separation of each pair, which are the local maxima of the dot product
+    //of their unit vectors. Pairs of stars are skipped since their separation does not change
+    for (size_t i=0; i<nBodies; i++)
+    {
+      const size_t nOffset1 = i * AACONJUNCTIONS_BLOCK_SIZE;
+      for (size_t j=i+1; j<nBodies; j++)
+      {
+        if ((bodies[i].object == CAAConjunctionBody::Object::STAR) && (bodies[j].object == CAAConjunctionBody::Object::STAR))
+          continue;
+        const size_t nOffset2 = j * AACONJUNCTIONS_BLOCK_SIZE;
+        for (size_t k=0; k<n; k++)
+          Dot[k] = (X[nOffset1 + k]*X[nOffset2 + k]) + (Y[nOffset1 + k]*Y[nOffset2 + k]) + (Z[nOffset1 + k]*Z[nOffset2 + k]);
+        for (size_t k=1; (k + 1)<n; k++)
+        {
+          if ((Dot[k] <= Dot[k - 1]) || (Dot[k] < Dot[k + 1]))
+            continue;
+
+          //The separation between two nodes can be no less than the separation at the node less the angles
+          //through which the two bodies move, so only refine the minima which could be close enough
+          const double dX = X[nOffset1 + k] - X[nOffset2 + k];
+          const double dY = Y[nOffset1 + k] - Y[nOffset2 + k];
+          const double dZ = Z[nOffset1 + k] - Z[nOffset2 + k];
+          const double Separation = CAACoordinateTransformation::RadiansToDegrees(2 * asin(min(1.0, sqrt((dX*dX) + (dY*dY) + (dZ*dZ)) / 2)));
+          const double Movement = max(Motion[nOffset1 + k - 1], Motion[nOffset1 + k]) + max(Motion[nOffset2 + k - 1], Motion[nOffset2 + k]);
+          if ((Separation - Movement) > (MaxSeparation + AACONJUNCTIONS_TABULATION_TOLERANCE))
+            continue;
+
+          //Refine the minimum using the full positions
+          const CAAConjunctionBody& Body1 = bodies[i];
+          const CAAConjunctionBody& Body2 = bodies[j];
+          auto SeparationFunction = [&Body1, &Body2, bHighPrecision](double JD)
+          {
+            const CAA2DCoordinate Position1 = ApparentPosition(Body1, JD, bHighPrecision);
+            const CAA2DCoordinate Position2 = ApparentPosition(Body2, JD, bHighPrecision);
+            return CAAAngularSeparation::Separation(Position1.X, Position1.Y, Position2.X, Position2.Y);
+          };
+          const double JD = StartJD + ((nBlockStart + k) * StepInterval);
+          double MinimumSeparation = 0;
+          const double MinimumJD = CAAEventFinder::Extremum(SeparationFunction, JD - StepInterval, JD, JD + StepInterval, SeparationFunction(JD), false, MinimumSeparation, AACONJUNCTIONS_TOLERANCE);
+          if (MinimumSeparation > MaxSeparation)
+            continue;
+
+          CAAConjunctionDetails event;
+          event.Body1 = i;
+          event.Body2 = j;
+          event.JD = MinimumJD;
+          event.Separation = MinimumSeparation;
+          const CAA2DCoordinate Position1 = ApparentPosition(Body1, MinimumJD, bHighPrecision);
+          const CAA2DCoordinate Position2 = ApparentPosition(Body2, MinimumJD, bHighPrecision);
+
+          //CAAAngularSeparation::PositionAngle folds its result into 0 - 180 degrees, so the full position angle is
+          //calculated here to distinguish a first body to the north of the second from one to the south
+          const double DeltaAlpha = CAACoordinateTransformation::HoursToRadians(Position1.X - Position2.X);
+          const double Delta2 = CAACoordinateTransformation::DegreesToRadians(Position2.Y);
+          event.PositionAngle = CAACoordinateTransformation::MapTo0To360Range(CAACoordinateTransformation::RadiansToDegrees(atan2(sin(DeltaAlpha), (cos(Delta2) * tan(CAACoordinateTransformation::DegreesToRadians(Position1.Y))) - (sin(Delta2) * cos(DeltaAlpha)))));
+          events.push_back(event);
+        }
+      }
+    }
+
+    if (nBlockEnd == nNodes)
+      break;
+  }
+
+  //Put the events into time order
+  stable_sort(events.begin(), events.end(), [](const CAAConjunctionDetails& a, const CAAConjunctionDetails& b) noexcept { return a.JD < b.JD; });
+
+  return events;
+}
@@ -36,6 +36,7 @@ to maintain a single distribution point for the source code.
 #include "AACoordinateTransformation.h"
 #include <cmath>
 #include <cassert>
+#include <algorithm>
 using namespace std;
 
 
@@ -150,3 +151,279 @@ double CAACoordinateTransformation::DMSToDegrees(double Degrees, double Minutes,
   else
     return -Degrees - Minutes/60 - Seconds/3600;
 }
+
+//The batched conversions between spherical coordinates and unit vectors use the following sine, cosine and arc
+//tangent kernels rather than the C runtime functions, so that their loops can be vectorized by the compiler. The
+//kernels are the fdlibm polynomials (with a Cody-Waite reduction of the argument for the sine and cosine) written
+//without any branches: the octant and quadrant corrections are applied using rounding, copysign and multiplications
+//by 0 or 1 rather than conditional expressions, as compilers will not if-convert floating point operations which
+//could trap. They agree with the C runtime functions to within 1E-15 radians (about 2E-10 arcseconds) for any
+//angle up to 1E5 radians in magnitude
+constexpr double AAFRAMETRANSFORMATION_ROUND = 6755399441055744.0; //1.5 * 2^52, adding and subtracting which rounds to the nearest integer
+
+static inline void FrameTransformationSinCos(double X, double& Sin, double& Cos) noexcept
+{
+  //Reduce the argument to the range -PI/4 to PI/4 using a three part representation of PI/2
+  const double q = ((X * 0.63661977236758134308) + AAFRAMETRANSFORMATION_ROUND) - AAFRAMETRANSFORMATION_ROUND;
+  const double r = ((X - (q * 1.57079632673412561417)) - (q * 6.07710050630396597660E-11)) - (q * 2.02226624871116645580E-21);
+  const double z = r * r;
+  const double SinR = r + (r * z * (-1.66666666666666324348E-1 + (z * (8.33333333332248946124E-3 + (z * (-1.98412698298579493134E-4 + (z * (2.75573137070700676789E-6 + (z * (-2.50507602534068634195E-8 + (z * 1.58969099521155010221E-10)))))))))));
+  const double CosR = 1 - (0.5 * z) + (z * z * (4.16666666666666019037E-2 + (z * (-1.38888888888741095749E-3 + (z * (2.48015872894767294178E-5 + (z * (-2.75573143513906633035E-7 + (z * (2.08757232129817482790E-9 + (z * -1.13596475577881948265E-11)))))))))));
+
+  //Then select and negate the results for the quadrant, where Quadrant is q modulo 4 in the range -2 to 2
+  const double Quadrant = q - (4 * (((q * 0.25) + AAFRAMETRANSFORMATION_ROUND) - AAFRAMETRANSFORMATION_ROUND));
+  const bool bOddQuadrant = (fabs(Quadrant) == 1);
+  const double Sin1 = bOddQuadrant ? CosR : SinR;
+  const double Cos1 = bOddQuadrant ? SinR : CosR;
+  Sin = (fabs(Quadrant - 0.5) > 1) ? -Sin1 : Sin1;
+  Cos = (fabs(Quadrant + 0.5) > 1) ? -Cos1 : Cos1;
+}
+
+static inline double FrameTransformationATan2(double Y, double X) noexcept
+{
+  //Reduce to the arc tangent of t in the range 0 to 1, and then to the range -tan(PI/8) to tan(PI/8) using
+  //atan(t) = PI/4 + atan((t - 1)/(t + 1)), where k is 1 if this second reduction is used and 0 otherwise
+  const double AbsX = fabs(X);
+  const double AbsY = fabs(Y);
+  const double t = min(AbsX, AbsY) / max(max(AbsX, AbsY), 2.2250738585072014E-308);
+  const double Octant = (((t * 2.41421356237309504880) - 0.5) + AAFRAMETRANSFORMATION_ROUND) - AAFRAMETRANSFORMATION_ROUND; //0, 1 or 2
+  const double k = Octant - ((Octant * (Octant - 1)) / 2);
+  const double u = (t - k) / ((k * t) + 1);
+  const double z = u * u;
+  const double w = z * z;
+  const double s1 = z * (3.33333333333329318027E-1 + (w * (1.42857142725034663711E-1 + (w * (9.09088713343650656196E-2 + (w * (6.66107313738753120669E-2 + (w * (4.97687799461593236017E-2 + (w * 1.62858201153657823623E-2))))))))));
+  const double s2 = w * (-1.99999999998764832476E-1 + (w * (-1.11111104054623557880E-1 + (w * (-7.69187620504482999495E-2 + (w * (-5.83357013379057348645E-2 + (w * -3.65315727442169155270E-2))))))));
+  double Angle = (u - (u * (s1 + s2))) + (k * 0.78539816339744830962);
+
+  //Then undo the reductions: PI/2 - Angle if |Y| > |X|, PI - Angle if X is negative and finally the sign of Y
+  const double SignSwap = copysign(1.0, AbsX - AbsY);
+  Angle = (SignSwap * Angle) + ((1 - SignSwap) * 0.78539816339744830962);
+  const double SignX = copysign(1.0, X);
+  Angle = (SignX * Angle) + ((1 - SignX) * 1.57079632679489661923);
+  return copysign(Angle, Y);
+}
+
+CAAFrameTransformation::CAAFrameTransformation() noexcept
+{
+}
+
+CAAFrameTransformation::CAAFrameTransformation(const double Matrix[3][3]) noexcept : m_Matrix(Matrix[0][0], Matrix[0][1], Matrix[0][2], Matrix[1][0], Matrix[1][1], Matrix[1][2], Matrix[2][0], Matrix[2][1], Matrix[2][2])
+{
+}
+
+CAAFrameTransformation::CAAFrameTransformation(const CAARotationMatrix& Matrix) noexcept : m_Matrix(Matrix)
+{
+}
+
+CAAFrameTransformation CAAFrameTransformation::Ecliptic2Equatorial(double Epsilon) noexcept
+{
+  //A rotation about the direction of the equinox by the obliquity
+  return CAAFrameTransformation(CAARotationMatrix::RotationX(-Epsilon));
+}
+
+CAAFrameTransformation CAAFrameTransformation::Equatorial2Ecliptic(double Epsilon) noexcept
+{
+  return CAAFrameTransformation(CAARotationMatrix::RotationX(Epsilon));
+}
+
+CAAFrameTransformation CAAFrameTransformation::Equatorial2Horizontal(double LocalSiderealTime, double Latitude) noexcept
+{
+  //The rows give cos(h)cos(A), cos(h)sin(A) & sin(h) in terms of the equatorial unit vector, using the hour
+  //angle H = LocalSiderealTime - Alpha and the relations of Meeus's formulae 13.5 & 13.6
+  const double sinTheta = sin(LocalSiderealTime);
+  const double cosTheta = cos(LocalSiderealTime);
+  const double sinPhi = sin(Latitude);
+  const double cosPhi = cos(Latitude);
+  return CAAFrameTransformation(CAARotationMatrix(sinPhi*cosTheta, sinPhi*sinTheta, -cosPhi, sinTheta, -cosTheta, 0, cosPhi*cosTheta, cosPhi*sinTheta, sinPhi));
+}
+
+CAAFrameTransformation CAAFrameTransformation::Horizontal2Equatorial(double LocalSiderealTime, double Latitude) noexcept
+{
+  return Equatorial2Horizontal(LocalSiderealTime, Latitude).Inverse();
+}
+
+CAAFrameTransformation CAAFrameTransformation::Equatorial2Galactic() noexcept
+{
+  //Meeus's formulae 13.7 & 13.8 are the horizontal transformation for a sidereal time of 192.25 degrees and a
+  //latitude of 27.4 degrees (the B1950.0 galactic pole), followed by l = 303 - x
+  const CAAFrameTransformation pole = Equatorial2Horizontal(CAACoordinateTransformation::DegreesToRadians(192.25), CAACoordinateTransformation::DegreesToRadians(27.4));
+  const double l0 = CAACoordinateTransformation::DegreesToRadians(303);
+  const double sinl0 = sin(l0);
+  const double cosl0 = cos(l0);
+  return CAAFrameTransformation(CAARotationMatrix(cosl0, sinl0, 0, sinl0, -cosl0, 0, 0, 0, 1) * pole.m_Matrix);
+}
+
+CAAFrameTransformation CAAFrameTransformation::Galactic2Equatorial() noexcept
+{
+  return Equatorial2Galactic().Inverse();
+}
+
+CAAFrameTransformation CAAFrameTransformation::Inverse() const noexcept
+{
+  //All of the frame changes are orthogonal, so the inverse is the transpose
+  return CAAFrameTransformation(m_Matrix.Transpose());
+}
+
+double CAAFrameTransformation::Element(int nRow, int nColumn) const noexcept
+{
+  //Validate our parameters
+  assert((nRow >= 0) && (nRow < 3));
+  assert((nColumn >= 0) && (nColumn < 3));
+
+#ifdef _MSC_VER
+  #pragma warning(suppress : 26446 26482)
+#endif //#ifdef _MSC_VER
+  return m_Matrix.M[nRow][nColumn];
+}
+
+void CAAFrameTransformation::SphericalToUnitVector(const double* pLongitude, const double* pLatitude, double* pX, double* pY, double* pZ, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pLongitude);
+  assert(pLatitude);
+  assert(pX);
+  assert(pY);
+  assert(pZ);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+    double sinLongitude = 0;
+    double cosLongitude = 0;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    FrameTransformationSinCos(pLongitude[i], sinLongitude, cosLongitude);
+    double sinLatitude = 0;
+    double cosLatitude = 0;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    FrameTransformationSinCos(pLatitude[i], sinLatitude, cosLatitude);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pX[i] = cosLatitude * cosLongitude;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pY[i] = cosLatitude * sinLongitude;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pZ[i] = sinLatitude;
+  }
+}
+
+void CAAFrameTransformation::UnitVectorToSpherical(const double* pX, const double* pY, const double* pZ, double* pLongitude, double* pLatitude, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pX);
+  assert(pY);
+  assert(pZ);
+  assert(pLongitude);
+  assert(pLatitude);
+
+  //Work through the positions in blocks, as the square roots are taken in a loop of their own. Because sqrt can set
+  //errno it stops any loop which it is in from being vectorized. Each output is still only written after all of the
+  //inputs at the same index have been read, so the outputs may alias the inputs
+  constexpr size_t nBlockSize = 256;
+  double R[nBlockSize];
+  for (size_t i=0; i<nCount; i+=nBlockSize)
+  {
+    const size_t nBlock = ((nCount - i) < nBlockSize) ? (nCount - i) : nBlockSize;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double* pBlockX = pX + i;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double* pBlockY = pY + i;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double* pBlockZ = pZ + i;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    double* pBlockLongitude = pLongitude + i;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    double* pBlockLatitude = pLatitude + i;
+    for (size_t j=0; j<nBlock; j++)
+    {
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26446 26481 26482)
+    #endif //#ifdef _MSC_VER
+      R[j] = (pBlockX[j] * pBlockX[j]) + (pBlockY[j] * pBlockY[j]);
+    }
+    for (size_t j=0; j<nBlock; j++)
+    {
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26446 26482)
+    #endif //#ifdef _MSC_VER
+      R[j] = sqrt(R[j]);
+    }
+
+    for (size_t j=0; j<nBlock; j++)
+    {
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      const double Longitude = FrameTransformationATan2(pBlockY[j], pBlockX[j]);
+
+      //Use atan2 rather than asin for the latitude so that precision is retained close to the poles
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26446 26481 26482)
+    #endif //#ifdef _MSC_VER
+      const double Latitude = FrameTransformationATan2(pBlockZ[j], R[j]);
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      pBlockLongitude[j] = Longitude + ((Longitude < 0) ? (2 * CAACoordinateTransformation::PI()) : 0);
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      pBlockLatitude[j] = Latitude;
+    }
+  }
+}
+
+void CAAFrameTransformation::Transform(const double* pX, const double* pY, const double* pZ, double* pXResult, double* pYResult, double* pZResult, size_t nCount) const noexcept
+{
+  m_Matrix.Apply(pX, pY, pZ, pXResult, pYResult, pZResult, nCount);
+}
+
+void CAAFrameTransformation::Transform(const double* pLongitude, const double* pLatitude, double* pX, double* pY, double* pZ, size_t nCount) const noexcept
+{
+  SphericalToUnitVector(pLongitude, pLatitude, pX, pY, pZ, nCount);
+  Transform(pX, pY, pZ, pX, pY, pZ, nCount);
+}
+
+void CAAFrameTransformation::Transform(const double* pLongitude, const double* pLatitude, double* pLongitudeResult, double* pLatitudeResult, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert(pLongitude);
+  assert(pLatitude);
+  assert(pLongitudeResult);
+  assert(pLatitudeResult);
+
+  //Work through the positions in blocks so that the intermediate unit vectors stay in the cache
+  constexpr size_t nBlockSize = 256;
+  double X[nBlockSize];
+  double Y[nBlockSize];
+  double Z[nBlockSize];
+  for (size_t i=0; i<nCount; i+=nBlockSize)
+  {
+    const size_t nBlock = ((nCount - i) < nBlockSize) ? (nCount - i) : nBlockSize;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    Transform(pLongitude + i, pLatitude + i, X, Y, Z, nBlock);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    UnitVectorToSpherical(X, Y, Z, pLongitudeResult + i, pLatitudeResult + i, nBlock);
+  }
+}
@@ -114,6 +114,15 @@ to maintain a single distribution point for the source code.
 #include "AADate.h"
 #include <cassert>
 #include <cstddef>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <vector>
 using namespace std;
 
 
@@ -2125,40 +2134,134 @@ const LeapSecondCoefficient g_LeapSecondCoefficients[] = //Cumulative leap secon
   { 2457754.5, 37.0,      41317, 0.0       }
 };
 
+//The tables which have been loaded at runtime using the CAADynamicalTime::Load* methods. A set of tables is never
+//modified once it has been published via g_pLoadedTables, so readers only need a single atomic load to get a
+//consistent view without taking any locks. Sets which have been replaced are retired rather than deleted, as there is
+//no way to know when the last reader has finished with them. Given that the tables are small and are only refreshed
+//when new IERS data is published, this costs very little memory over the life time of a process
+struct EarthOrientationTables
+{
+  vector<DeltaTValue> DeltaTValues;
+  vector<LeapSecondCoefficient> LeapSecondCoefficients;
+};
+
+static atomic<const EarthOrientationTables*> g_pLoadedTables{nullptr};
+static mutex g_LoadedTablesMutex; //Serializes the writers
+static vector<unique_ptr<const EarthOrientationTables>> g_RetiredTables;
+
 
 ////////////////////////////////// Implementation /////////////////////////////
 
-double CAADynamicalTime::DeltaT(double JD) noexcept
+//Returns the index of the first element in a lookup table whose JD is greater than the JD input parameter. Callers
+//usually step through time, so the segment found on the previous call on this thread (and the one following it)
+//are checked first before falling back to a binary search
+template <typename T>
+static size_t FindUpperIndex(const T* pValues, size_t nValues, double JD, size_t& nCachedIndex) noexcept
 {
-  //What will be the return value from the method
-  double Delta = 0;
+  if ((nCachedIndex > 0) && (nCachedIndex < nValues) && (JD >= pValues[nCachedIndex - 1].JD))
+  {
+    if (JD < pValues[nCachedIndex].JD)
+      return nCachedIndex;
+    if (((nCachedIndex + 1) < nValues) && (JD < pValues[nCachedIndex + 1].JD))
+      return ++nCachedIndex;
+  }
 
-  //Determine if we can use the lookup table
-  constexpr const size_t nLookupElements = sizeof(g_DeltaTValues) / sizeof(DeltaTValue);
-  if ((JD >= g_DeltaTValues[0].JD) && (JD < g_DeltaTValues[nLookupElements - 1].JD))
+  nCachedIndex = upper_bound(pValues, pValues + nValues, JD, [](double JD2, const T& value) noexcept { return JD2 < value.JD; }) - pValues;
+  return nCachedIndex;
+}
+
+//A cut down version of CAADate::FractionalYear which avoids constructing a CAADate and computing the month, day and time
+static double FractionalYear(double JD) noexcept
+{
+  const bool bGregorianCalendar = CAADate::AfterPapalReform(JD);
+  double tempZ = 0;
+  modf(JD + 0.5, &tempZ);
+  const long Z = static_cast<long>(tempZ);
+  long A = Z;
+  if (bGregorianCalendar)
   {
-    //Find the index in the lookup table which contains the JD value closest to the JD input parameter
-    bool bFound = false;
-    size_t nFoundIndex = 0;
-    while (!bFound)
-    {
-      assert(nFoundIndex < nLookupElements);
-      bFound = (g_DeltaTValues[nFoundIndex].JD > JD);
+    const long alpha = CAADate::INT((Z - 1867216.25) / 36524.25);
+    A = Z + 1 + alpha - CAADate::INT(CAADate::INT(alpha)/4.0);
+  }
+  const long B = A + 1524;
+  const long C = CAADate::INT((B - 122.1) / 365.25);
+  const long D = CAADate::INT(365.25 * C);
+  const long E = CAADate::INT((0.0 + B - D) / 30.6001);
+  const long Month = (E < 14) ? (E - 1) : (E - 13);
+  const long Year = (Month > 2) ? (C - 4716) : (C - 4715);
 
-      //Prepare for the next loop
-      if (!bFound)
-        ++nFoundIndex;
-      else
-      {
-        //Now do a simple linear interpolation of the DeltaT values from the lookup table
-        Delta = (JD - g_DeltaTValues[nFoundIndex - 1].JD) / (g_DeltaTValues[nFoundIndex].JD - g_DeltaTValues[nFoundIndex - 1].JD) * (g_DeltaTValues[nFoundIndex].DeltaT - g_DeltaTValues[nFoundIndex - 1].DeltaT) + g_DeltaTValues[nFoundIndex - 1].DeltaT;
-      }
-    }
+  const long DaysInYear = CAADate::IsLeap(Year, bGregorianCalendar) ? 366 : 365;
+  return Year + ((JD - CAADate::DateToJD(Year, 1, 1, CAADate::AfterPapalReform(Year, 1, 1))) / DaysInYear);
+}
+
+//Linearly interpolates a DeltaT value from a lookup table, returning false if the JD is outside of the table
+static bool InterpolateDeltaT(const DeltaTValue* pValues, size_t nValues, double JD, size_t& nCachedIndex, double& Delta) noexcept
+{
+  if ((nValues < 2) || (JD < pValues[0].JD) || (JD >= pValues[nValues - 1].JD))
+    return false;
+
+  //Find the index in the lookup table which contains the JD value closest to the JD input parameter
+  const size_t nFoundIndex = FindUpperIndex(pValues, nValues, JD, nCachedIndex);
+  assert((nFoundIndex > 0) && (nFoundIndex < nValues));
+
+  //Now do a simple linear interpolation of the DeltaT values from the lookup table
+  Delta = (JD - pValues[nFoundIndex - 1].JD) / (pValues[nFoundIndex].JD - pValues[nFoundIndex - 1].JD) * (pValues[nFoundIndex].DeltaT - pValues[nFoundIndex - 1].DeltaT) + pValues[nFoundIndex - 1].DeltaT;
+  return true;
+}
+
+//Evaluates TAI - UTC from a table of leap second coefficients, which must contain the JD
+static double EvaluateLeapSeconds(const LeapSecondCoefficient* pCoefficients, size_t nCoefficients, double JD, size_t& nCachedIndex) noexcept
+{
+  assert(JD >= pCoefficients[0].JD);
+
+  //Find the index in the lookup table which contains the JD value closest to the JD input parameter
+  const size_t nIndex = FindUpperIndex(pCoefficients, nCoefficients, JD, nCachedIndex) - 1;
+  return pCoefficients[nIndex].LeapSeconds + (JD - 2400000.5 - pCoefficients[nIndex].BaseMJD) * pCoefficients[nIndex].Coefficient;
+}
+
+static double CumulativeLeapSeconds(const EarthOrientationTables* pTables, double JD) noexcept
+{
+  //What will be the return value from the method
+  double LeapSeconds = 0;
+
+  //Use any loaded table from its first entry onwards. Before that (for example the 1961 - 1971 drift rates which are
+  //not included in the IERS Leap_Second.dat file) fall back to the compiled table
+  thread_local size_t nLoadedCachedIndex = 0;
+  thread_local size_t nCompiledCachedIndex = 0;
+  if ((pTables != nullptr) && !pTables->LeapSecondCoefficients.empty() && (JD >= pTables->LeapSecondCoefficients[0].JD))
+    LeapSeconds = EvaluateLeapSeconds(pTables->LeapSecondCoefficients.data(), pTables->LeapSecondCoefficients.size(), JD, nLoadedCachedIndex);
+  else if (JD >= g_LeapSecondCoefficients[0].JD)
+    LeapSeconds = EvaluateLeapSeconds(g_LeapSecondCoefficients, sizeof(g_LeapSecondCoefficients) / sizeof(LeapSecondCoefficient), JD, nCompiledCachedIndex);
+
+  return LeapSeconds;
+}
+
+//Returns true if the JD is within the range 1 January 1961 (or the start of any loaded table if earlier) to 500 days
+//after the last leap second in either the compiled or the loaded table
+static bool WithinLeapSecondRange(const EarthOrientationTables* pTables, double JD) noexcept
+{
+  double StartJD = g_LeapSecondCoefficients[0].JD;
+  double EndJD = g_LeapSecondCoefficients[(sizeof(g_LeapSecondCoefficients) / sizeof(LeapSecondCoefficient)) - 1].JD;
+  if ((pTables != nullptr) && !pTables->LeapSecondCoefficients.empty())
+  {
+    StartJD = min(StartJD, pTables->LeapSecondCoefficients.front().JD);
+    EndJD = max(EndJD, pTables->LeapSecondCoefficients.back().JD);
   }
-  else
+  return (JD >= StartJD) && (JD <= (EndJD + 500));
+}
+
+static double DeltaT(const EarthOrientationTables* pTables, double JD) noexcept
+{
+  //What will be the return value from the method
+  double Delta = 0;
+
+  //Determine if we can use a lookup table, trying any loaded table first and then the compiled table
+  thread_local size_t nLoadedCachedIndex = 0;
+  thread_local size_t nCompiledCachedIndex = 0;
+  if (((pTables == nullptr) || !InterpolateDeltaT(pTables->DeltaTValues.data(), pTables->DeltaTValues.size(), JD, nLoadedCachedIndex, Delta)) &&
+      !InterpolateDeltaT(g_DeltaTValues, sizeof(g_DeltaTValues) / sizeof(DeltaTValue), JD, nCompiledCachedIndex, Delta))
   {
-    const CAADate date(JD, CAADate::AfterPapalReform(JD));
-    const double y = date.FractionalYear();
+    const double y = FractionalYear(JD);
   
     //Use the polynomial expressions from Espenak & Meeus 2006. References: http://eclipse.gsfc.nasa.gov/SEcat5/deltatpoly.html and
     //http://www.staff.science.uu.nl/~gent0113/deltat/deltat_old.htm (Espenak & Meeus 2006 section)
@@ -2284,63 +2387,44 @@ double CAADynamicalTime::DeltaT(double JD) noexcept
   return Delta;
 }
 
-double CAADynamicalTime::CumulativeLeapSeconds(double JD) noexcept
+double CAADynamicalTime::DeltaT(double JD) noexcept
 {
-  //What will be the return value from the method
-  double LeapSeconds = 0;
-
-  constexpr const size_t nLookupElements = sizeof(g_LeapSecondCoefficients) / sizeof(LeapSecondCoefficient);
-  if (JD >= g_LeapSecondCoefficients[0].JD)
-  {
-    //Find the index in the lookup table which contains the JD value closest to the JD input parameter
-    bool bContinue = true;
-    size_t nIndex = 1;
-    while (bContinue)
-    {
-      if (nIndex >= nLookupElements)
-      {
-        LeapSeconds = g_LeapSecondCoefficients[nLookupElements - 1].LeapSeconds + (JD - 2400000.5 - g_LeapSecondCoefficients[nLookupElements - 1].BaseMJD) * g_LeapSecondCoefficients[nLookupElements - 1].Coefficient;
-        bContinue = false;
-      }
-      else if (JD < g_LeapSecondCoefficients[nIndex].JD)
-      {
-        LeapSeconds = g_LeapSecondCoefficients[nIndex - 1].LeapSeconds + (JD - 2400000.5 - g_LeapSecondCoefficients[nIndex - 1].BaseMJD) * g_LeapSecondCoefficients[nIndex - 1].Coefficient;
-        bContinue = false;
-      }
-
-      //Prepare for the next loop
-      if (bContinue)
-        ++nIndex;
-    }
-  }
+  return ::DeltaT(g_pLoadedTables.load(memory_order_acquire), JD);
+}
 
-  return LeapSeconds;
+double CAADynamicalTime::CumulativeLeapSeconds(double JD) noexcept
+{
+  return ::CumulativeLeapSeconds(g_pLoadedTables.load(memory_order_acquire), JD);
 }
 
 double CAADynamicalTime::TT2UTC(double JD) noexcept
 {
+  //Use the same set of tables for all the lookups
+  const EarthOrientationTables* pTables = g_pLoadedTables.load(memory_order_acquire);
+
   //Outside of the range 1 January 1961 to 500 days after the last leap second,
   //we implement TT2UTC as TT2UT1
-  constexpr const size_t nLookupElements = sizeof(g_LeapSecondCoefficients) / sizeof(LeapSecondCoefficient);
-  if ((JD < g_LeapSecondCoefficients[0].JD) || (JD > (g_LeapSecondCoefficients[nLookupElements - 1].JD + 500)))
-    return TT2UT1(JD);
+  const double DT = ::DeltaT(pTables, JD);
+  if (!WithinLeapSecondRange(pTables, JD))
+    return JD - (DT / 86400.0);
 
-  const double DT = DeltaT(JD);
   const double UT1 = JD - (DT / 86400.0);
-  const double LeapSeconds = CumulativeLeapSeconds(JD);
+  const double LeapSeconds = ::CumulativeLeapSeconds(pTables, JD);
   return ((DT - LeapSeconds - 32.184) / 86400.0) + UT1;
 }
 
 double CAADynamicalTime::UTC2TT(double JD) noexcept
 {
+  //Use the same set of tables for all the lookups
+  const EarthOrientationTables* pTables = g_pLoadedTables.load(memory_order_acquire);
+
   //Outside of the range 1 January 1961 to 500 days after the last leap second,
   //we implement TT2UTC as TT2UT1
-  constexpr const size_t nLookupElements = sizeof(g_LeapSecondCoefficients) / sizeof(LeapSecondCoefficient);
-  if ((JD < g_LeapSecondCoefficients[0].JD) || (JD >(g_LeapSecondCoefficients[nLookupElements - 1].JD + 500)))
-    return UT12TT(JD);
+  const double DT = ::DeltaT(pTables, JD);
+  if (!WithinLeapSecondRange(pTables, JD))
+    return JD + (DT / 86400.0);
 
-  const double DT = DeltaT(JD);
-  const double LeapSeconds = CumulativeLeapSeconds(JD);
+  const double LeapSeconds = ::CumulativeLeapSeconds(pTables, JD);
   const double UT1 = JD - ((DT - LeapSeconds - 32.184) / 86400.0);
   return UT1 + (DT / 86400.0);
 }
@@ -2357,6 +2441,228 @@ double CAADynamicalTime::UT12TT(double JD) noexcept
 
 double CAADynamicalTime::UT1MinusUTC(double JD) noexcept
 {
-  const double JDUTC = JD + ((CAADynamicalTime::DeltaT(JD) - CumulativeLeapSeconds(JD) - 32.184) / 86400);
+  const EarthOrientationTables* pTables = g_pLoadedTables.load(memory_order_acquire);
+  const double JDUTC = JD + ((::DeltaT(pTables, JD) - ::CumulativeLeapSeconds(pTables, JD) - 32.184) / 86400);
   return (JD - JDUTC) * 86400;
 }
+
+void CAADynamicalTime::DeltaT(const double* pJD, double* pDeltaT, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pJD != nullptr) || (nCount == 0));
+  assert((pDeltaT != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pDeltaT[i] = DeltaT(pJD[i]);
+}
+
+void CAADynamicalTime::TT2UTC(const double* pJD, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pJD != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = TT2UTC(pJD[i]);
+}
+
+void CAADynamicalTime::UTC2TT(const double* pJD, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pJD != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = UTC2TT(pJD[i]);
+}
+
+void CAADynamicalTime::TT2UT1(const double* pJD, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pJD != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = TT2UT1(pJD[i]);
+}
+
+void CAADynamicalTime::UT12TT(const double* pJD, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pJD != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = UT12TT(pJD[i]);
+}
+
+//Returns a copy of the currently loaded tables (or an empty set of tables) which can be modified and then published
+//using PublishTables. Both of these functions must be called with g_LoadedTablesMutex held
+static unique_ptr<EarthOrientationTables> CopyLoadedTables()
+{
+  const EarthOrientationTables* pTables = g_pLoadedTables.load(memory_order_acquire);
+  if (pTables == nullptr)
+    return unique_ptr<EarthOrientationTables>(new EarthOrientationTables);
+  return unique_ptr<EarthOrientationTables>(new EarthOrientationTables(*pTables));
+}
+
+static void PublishTables(unique_ptr<EarthOrientationTables> pTables)
+{
+  const EarthOrientationTables* pOldTables = g_pLoadedTables.exchange(pTables.release(), memory_order_acq_rel);
+  if (pOldTables != nullptr)
+    g_RetiredTables.emplace_back(pOldTables);
+}
+
+template <typename T>
+static void SortAndRemoveDuplicates(vector<T>& values)
+{
+  stable_sort(values.begin(), values.end(), [](const T& value1, const T& value2) noexcept { return value1.JD < value2.JD; });
+  values.erase(unique(values.begin(), values.end(), [](const T& value1, const T& value2) noexcept { return value1.JD == value2.JD; }), values.end());
+}
+
+bool CAADynamicalTime::LoadDeltaTValues(const char* pszFilename)
+{
+  //Validate our parameters
+  assert(pszFilename != nullptr);
+
+  FILE* pFile = fopen(pszFilename, "r");
+  if (pFile == nullptr)
+    return false;
+
+  //Each line is of the form "YYYY MM DD DeltaT" as used by http://maia.usno.navy.mil/ser7/deltat.data
+  vector<DeltaTValue> values;
+  char szLine[256];
+  while (fgets(szLine, sizeof(szLine), pFile) != nullptr)
+  {
+    int nYear = 0;
+    int nMonth = 0;
+    int nDay = 0;
+    double fDeltaT = 0;
+    if (sscanf(szLine, "%d %d %d %lf", &nYear, &nMonth, &nDay, &fDeltaT) == 4)
+    {
+      const DeltaTValue value{ CAADate::DateToJD(nYear, nMonth, nDay, true), fDeltaT };
+      values.push_back(value);
+    }
+  }
+  fclose(pFile);
+  SortAndRemoveDuplicates(values);
+  if (values.size() < 2)
+    return false;
+
+  const lock_guard<mutex> lock(g_LoadedTablesMutex);
+  unique_ptr<EarthOrientationTables> pTables = CopyLoadedTables();
+  pTables->DeltaTValues = move(values);
+  PublishTables(move(pTables));
+  return true;
+}
+
+bool CAADynamicalTime::LoadLeapSeconds(const char* pszFilename)
+{
+  //Validate our parameters
+  assert(pszFilename != nullptr);
+
+  FILE* pFile = fopen(pszFilename, "r");
+  if (pFile == nullptr)
+    return false;
+
+  //Both the layout of http://maia.usno.navy.mil/ser7/tai-utc.dat and the IERS Leap_Second.dat file are supported
+  vector<LeapSecondCoefficient> coefficients;
+  char szLine[256];
+  while (fgets(szLine, sizeof(szLine), pFile) != nullptr)
+  {
+    const char* pszJD = strstr(szLine, "=JD");
+    const char* pszTAIUTC = strstr(szLine, "TAI-UTC=");
+    if ((pszJD != nullptr) && (pszTAIUTC != nullptr))
+    {
+      //A line such as " 1961 JAN  1 =JD 2437300.5  TAI-UTC=   1.4228180 S + (MJD - 37300.) X 0.001296      S"
+      LeapSecondCoefficient coefficient{0, 0, 0, 0};
+      coefficient.JD = atof(pszJD + 3);
+      coefficient.LeapSeconds = atof(pszTAIUTC + 8);
+      const char* pszBaseMJD = strstr(pszTAIUTC, "MJD -");
+      const char* pszCoefficient = strstr(pszTAIUTC, ") X");
+      if ((pszBaseMJD != nullptr) && (pszCoefficient != nullptr))
+      {
+        coefficient.BaseMJD = atof(pszBaseMJD + 5);
+        coefficient.Coefficient = atof(pszCoefficient + 3);
+      }
+      coefficients.push_back(coefficient);
+    }
+    else if (szLine[0] != '#')
+    {
+      //A line such as "    41317.0    1  1 1972       10"
+      double fMJD = 0;
+      int nDay = 0;
+      int nMonth = 0;
+      int nYear = 0;
+      double fLeapSeconds = 0;
+      if (sscanf(szLine, "%lf %d %d %d %lf", &fMJD, &nDay, &nMonth, &nYear, &fLeapSeconds) == 5)
+      {
+        const LeapSecondCoefficient coefficient{ fMJD + 2400000.5, fLeapSeconds, fMJD, 0 };
+        coefficients.push_back(coefficient);
+      }
+    }
+  }
+  fclose(pFile);
+  SortAndRemoveDuplicates(coefficients);
+  if (coefficients.empty())
+    return false;
+
+  const lock_guard<mutex> lock(g_LoadedTablesMutex);
+  unique_ptr<EarthOrientationTables> pTables = CopyLoadedTables();
+  pTables->LeapSecondCoefficients = move(coefficients);
+  PublishTables(move(pTables));
+  return true;
+}
+
+bool CAADynamicalTime::LoadFinals(const char* pszFilename)
+{
+  //Validate our parameters
+  assert(pszFilename != nullptr);
+
+  FILE* pFile = fopen(pszFilename, "r");
+  if (pFile == nullptr)
+    return false;
+
+  //Read the UT1-UTC values from the fixed width columns of the IERS finals.all / finals2000A.all files. Column 8 to 15
+  //is the MJD, column 58 is "I" for IERS values or "P" for predictions and columns 59 to 68 are UT1-UTC in seconds
+  vector<pair<double, double>> UT1MinusUTCValues;
+  char szLine[256];
+  while (fgets(szLine, sizeof(szLine), pFile) != nullptr)
+  {
+    if ((strlen(szLine) >= 68) && ((szLine[57] == 'I') || (szLine[57] == 'P')))
+    {
+      char szMJD[9];
+      memcpy(szMJD, szLine + 7, 8);
+      szMJD[8] = '\0';
+      char szUT1MinusUTC[11];
+      memcpy(szUT1MinusUTC, szLine + 58, 10);
+      szUT1MinusUTC[10] = '\0';
+      UT1MinusUTCValues.emplace_back(atof(szMJD) + 2400000.5, atof(szUT1MinusUTC));
+    }
+  }
+  fclose(pFile);
+  if (UT1MinusUTCValues.size() < 2)
+    return false;
+
+  //Convert the values to DeltaT = TT - UT1 = 32.184 + (TAI - UTC) - (UT1 - UTC) using the leap seconds which will
+  //be in effect once the tables are published
+  const lock_guard<mutex> lock(g_LoadedTablesMutex);
+  unique_ptr<EarthOrientationTables> pTables = CopyLoadedTables();
+  vector<DeltaTValue> values;
+  values.reserve(UT1MinusUTCValues.size());
+  for (const auto& UT1MinusUTCValue : UT1MinusUTCValues)
+  {
+    const DeltaTValue value{ UT1MinusUTCValue.first, 32.184 + ::CumulativeLeapSeconds(pTables.get(), UT1MinusUTCValue.first) - UT1MinusUTCValue.second };
+    values.push_back(value);
+  }
+  SortAndRemoveDuplicates(values);
+  pTables->DeltaTValues = move(values);
+  PublishTables(move(pTables));
+  return true;
+}
+
+void CAADynamicalTime::ResetToCompiledTables()
+{
+  const lock_guard<mutex> lock(g_LoadedTablesMutex);
+  PublishTables(unique_ptr<EarthOrientationTables>());
+}
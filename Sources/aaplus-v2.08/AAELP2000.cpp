@@ -31,6 +31,7 @@ to maintain a single distribution point for the source code.
 #include "AAELP2000.h"
 #include "AACoordinateTransformation.h"
 #include "AA3DCoordinate.h"
+#include "AAInstrumentation.h"
 #include <cmath>
 #include <cassert>
 #include <array>
@@ -38135,6 +38136,98 @@ const ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient g_ELP36[] =
 
 ////////////////////////////// Implementation /////////////////////////////////
 
+//The polynomials in radians for the Delaunay arguments D, l', l & F, or their linear parts if nSize is 2
+static void DelaunayArguments(double Arguments[4][5], int nSize) noexcept
+{
+  for (int i=0; i<5; i++)
+  {
+    const double W1 = (i < nSize) ? g_W[3 * i] : 0;
+    const double W2 = (i < nSize) ? g_W[(3 * i) + 1] : 0;
+    const double W3 = (i < nSize) ? g_W[(3 * i) + 2] : 0;
+    const double EMB = (i < nSize) ? g_EARTH[i] : 0;
+    const double PERI = (i < nSize) ? g_PERI[i] : 0;
+    Arguments[0][i] = W1 - EMB + ((i == 0) ? CAACoordinateTransformation::PI() : 0);
+    Arguments[1][i] = EMB - PERI;
+    Arguments[2][i] = W1 - W2;
+    Arguments[3][i] = W1 - W3;
+  }
+}
+
+static void AddMainProblemTerms(CAASeriesStepper& series, const ELP2000MainProblemCoefficient* pCoefficients, int nCoefficients, bool bSine)
+{
+  double Arguments[4][5];
+  DelaunayArguments(Arguments, 5);
+  for (int j=0; j<nCoefficients; j++)
+  {
+    //The amplitudes are as calculated by CAAELP2000::Accumulate & CAAELP2000::Accumulate_2
+    const double tgv = pCoefficients[j].m_B[0] + DTASM * pCoefficients[j].m_B[4];
+    double A = pCoefficients[j].m_A;
+    if (!bSine)
+      A -= A * 2.0 * g_DELNU / 3.0;
+    const double x = A + tgv * (g_DELNP - AM * g_DELNU) + pCoefficients[j].m_B[1] * g_DELG + pCoefficients[j].m_B[2] * g_DELE + pCoefficients[j].m_B[3] * g_DELEP;
+    double Phase[5] = { 0, 0, 0, 0, 0 };
+    for (int k=0; k<5; k++)
+      Phase[k] = (pCoefficients[j].m_I[0] * Arguments[0][k]) + (pCoefficients[j].m_I[1] * Arguments[1][k]) + (pCoefficients[j].m_I[2] * Arguments[2][k]) + (pCoefficients[j].m_I[3] * Arguments[3][k]);
+    series.AddTerm(x, bSine, 0, Phase, 5);
+  }
+}
+
+static void AddPerturbationTerms(CAASeriesStepper& series, const ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient* pCoefficients, int nCoefficients, int nPower)
+{
+  double Arguments[4][5];
+  DelaunayArguments(Arguments, 2);
+  for (int j=0; j<nCoefficients; j++)
+  {
+    double Phase[2] = { CAACoordinateTransformation::DegreesToRadians(pCoefficients[j].m_O), 0 };
+    for (int k=0; k<2; k++)
+      Phase[k] += (pCoefficients[j].m_I[0] * Arguments[0][k]) + (pCoefficients[j].m_I[1] * Arguments[1][k]) + (pCoefficients[j].m_I[2] * Arguments[2][k]) + (pCoefficients[j].m_I[3] * Arguments[3][k]) +
+                  (pCoefficients[j].m_IZ * g_ZETA[k]);
+    series.AddTerm(pCoefficients[j].m_A, true, nPower, Phase, 2);
+  }
+}
+
+static void AddPlanetaryTerms(CAASeriesStepper& series, const ELP2000PlanetPertCoefficient* pCoefficients, int nCoefficients, int nPower, bool bTable1)
+{
+  //Table 1 uses the arguments Me, V, T, Ma, J, S, U, N, D, l & F and table 2 uses Me, V, T, Ma, J, S, U, D, l', l & F
+  double Delaunay[4][5];
+  DelaunayArguments(Delaunay, 2);
+  double Arguments[11][2];
+  for (int k=0; k<2; k++)
+  {
+    Arguments[0][k] = g_P[0][k];
+    Arguments[1][k] = g_P[1][k];
+    Arguments[2][k] = g_EARTH[k];
+    Arguments[3][k] = g_P[3][k];
+    Arguments[4][k] = g_P[4][k];
+    Arguments[5][k] = g_P[5][k];
+    Arguments[6][k] = g_P[6][k];
+    if (bTable1)
+    {
+      Arguments[7][k] = g_P[7][k];
+      Arguments[8][k] = Delaunay[0][k];
+      Arguments[9][k] = Delaunay[2][k];
+    }
+    else
+    {
+      Arguments[7][k] = Delaunay[0][k];
+      Arguments[8][k] = Delaunay[1][k];
+      Arguments[9][k] = Delaunay[2][k];
+    }
+    Arguments[10][k] = Delaunay[3][k];
+  }
+  for (int j=0; j<nCoefficients; j++)
+  {
+    double Phase[2] = { CAACoordinateTransformation::DegreesToRadians(pCoefficients[j].m_theta), 0 };
+    for (int i=0; i<11; i++)
+    {
+      for (int k=0; k<2; k++)
+        Phase[k] += (pCoefficients[j].m_ip[i] * Arguments[i][k]);
+    }
+    series.AddTerm(pCoefficients[j].m_O, true, nPower, Phase, 2);
+  }
+}
+
+
 double CAAELP2000::MoonMeanLongitude(const double* pT, int nTSize) noexcept //Aka W1
 {
   //Validate our parameters
@@ -38404,6 +38497,7 @@ double CAAELP2000::Accumulate(const ELP2000MainProblemCoefficient* pCoefficients
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j=0; j<nCoefficients; j++)
@@ -38432,6 +38526,7 @@ double CAAELP2000::Accumulate_2(const ELP2000MainProblemCoefficient* pCoefficien
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j = 0; j<nCoefficients; j++)
@@ -38469,6 +38564,7 @@ double CAAELP2000::Accumulate(const double* pT, int nTSize, const ELP2000EarthTi
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j=0; j<nCoefficients; j++)
@@ -38508,6 +38604,7 @@ double CAAELP2000::Accumulate_2(const double* pT, int nTSize, const ELP2000Earth
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j=0; j<nCoefficients; j++)
@@ -38542,6 +38639,7 @@ double CAAELP2000::AccumulateTable1(const ELP2000PlanetPertCoefficient* pCoeffic
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j=0; j<nCoefficients; j++)
@@ -38582,6 +38680,7 @@ double CAAELP2000::AccumulateTable1_2(const double* pT, int nTSize, const ELP200
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j=0; j<nCoefficients; j++)
@@ -38617,6 +38716,7 @@ double CAAELP2000::AccumulateTable2(const ELP2000PlanetPertCoefficient* pCoeffic
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j=0; j<nCoefficients; j++)
@@ -38657,6 +38757,7 @@ double CAAELP2000::AccumulateTable2_2(const double* pT, int nTSize, const ELP200
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   //Accumulate the result
   for (int j=0; j<nCoefficients; j++)
@@ -38697,6 +38798,7 @@ double CAAELP2000::Accumulate_3(const double* pT, int nTSize, const ELP2000Earth
 
   //What will be the return value from this function
   double fResult = 0;
+  AAPLUS_INSTRUMENT_TERMS(ELP2000, nCoefficients);
 
   for (int j=0; j<nCoefficients; j++)
   {
@@ -38721,6 +38823,9 @@ double CAAELP2000::EclipticLongitude(const double* pT, int nTSize) noexcept
   assert(pT != nullptr);
   assert(nTSize >= 2);
 
+  AAPLUS_INSTRUMENT_CALL(ELP2000);
+  AAPLUS_INSTRUMENT_SCOPE(ELP2000);
+
   //Compute the delaney arguments for the specified time
   const double fD = MoonMeanSolarElongation(pT, nTSize);
   const double fldash = SunMeanAnomaly(pT, nTSize);
@@ -38779,6 +38884,9 @@ double CAAELP2000::EclipticLatitude(const double* pT, int nTSize) noexcept
   assert(pT != nullptr);
   assert(nTSize >= 2);
 
+  AAPLUS_INSTRUMENT_CALL(ELP2000);
+  AAPLUS_INSTRUMENT_SCOPE(ELP2000);
+
   //Compute the delaney arguments for the specified time
   const double fD = MoonMeanSolarElongation(pT, nTSize);
   const double fldash = SunMeanAnomaly(pT, nTSize);
@@ -38837,6 +38945,9 @@ double CAAELP2000::RadiusVector(const double* pT, int nTSize) noexcept
   assert(pT != nullptr);
   assert(nTSize >= 2);
 
+  AAPLUS_INSTRUMENT_CALL(ELP2000);
+  AAPLUS_INSTRUMENT_SCOPE(ELP2000);
+
   //Compute the delaney arguments for the specified time
   const double fD = MoonMeanSolarElongation(pT, nTSize);
   const double fldash = SunMeanAnomaly(pT, nTSize);
@@ -38941,3 +39052,70 @@ CAA3DCoordinate CAAELP2000::EquatorialRectangularCoordinatesFK5(double JD) noexc
 
   return FK5;
 }
+
+CAAELP2000Stepper::CAAELP2000Stepper(double StartJD, double StepInterval, int nAnchorInterval) : m_Longitude(36525, StepInterval, nAnchorInterval),
+                                                                                               m_Latitude(36525, StepInterval, nAnchorInterval),
+                                                                                               m_RadiusVector(36525, StepInterval, nAnchorInterval)
+{
+  //The tables are added in the same order as they are summed by CAAELP2000::EclipticLongitude etc
+  AddMainProblemTerms (m_Longitude, g_ELP1,  sizeof(g_ELP1)/sizeof(ELP2000MainProblemCoefficient), true);
+  AddPerturbationTerms(m_Longitude, g_ELP4,  sizeof(g_ELP4)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Longitude, g_ELP7,  sizeof(g_ELP7)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 1);
+  AddPlanetaryTerms   (m_Longitude, g_ELP10, sizeof(g_ELP10)/sizeof(ELP2000PlanetPertCoefficient), 0, true);
+  AddPlanetaryTerms   (m_Longitude, g_ELP13, sizeof(g_ELP13)/sizeof(ELP2000PlanetPertCoefficient), 1, true);
+  AddPlanetaryTerms   (m_Longitude, g_ELP16, sizeof(g_ELP16)/sizeof(ELP2000PlanetPertCoefficient), 0, false);
+  AddPlanetaryTerms   (m_Longitude, g_ELP19, sizeof(g_ELP19)/sizeof(ELP2000PlanetPertCoefficient), 1, false);
+  AddPerturbationTerms(m_Longitude, g_ELP22, sizeof(g_ELP22)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Longitude, g_ELP25, sizeof(g_ELP25)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 1);
+  AddPerturbationTerms(m_Longitude, g_ELP28, sizeof(g_ELP28)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Longitude, g_ELP31, sizeof(g_ELP31)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Longitude, g_ELP34, sizeof(g_ELP34)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 2);
+
+  AddMainProblemTerms (m_Latitude, g_ELP2,  sizeof(g_ELP2)/sizeof(ELP2000MainProblemCoefficient), true);
+  AddPerturbationTerms(m_Latitude, g_ELP5,  sizeof(g_ELP5)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Latitude, g_ELP8,  sizeof(g_ELP8)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 1);
+  AddPlanetaryTerms   (m_Latitude, g_ELP11, sizeof(g_ELP11)/sizeof(ELP2000PlanetPertCoefficient), 0, true);
+  AddPlanetaryTerms   (m_Latitude, g_ELP14, sizeof(g_ELP14)/sizeof(ELP2000PlanetPertCoefficient), 1, true);
+  AddPlanetaryTerms   (m_Latitude, g_ELP17, sizeof(g_ELP17)/sizeof(ELP2000PlanetPertCoefficient), 0, false);
+  AddPlanetaryTerms   (m_Latitude, g_ELP20, sizeof(g_ELP20)/sizeof(ELP2000PlanetPertCoefficient), 1, false);
+  AddPerturbationTerms(m_Latitude, g_ELP23, sizeof(g_ELP23)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Latitude, g_ELP26, sizeof(g_ELP26)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 1);
+  AddPerturbationTerms(m_Latitude, g_ELP29, sizeof(g_ELP29)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Latitude, g_ELP32, sizeof(g_ELP32)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_Latitude, g_ELP35, sizeof(g_ELP35)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 2);
+
+  AddMainProblemTerms (m_RadiusVector, g_ELP3,  sizeof(g_ELP3)/sizeof(ELP2000MainProblemCoefficient), false);
+  AddPerturbationTerms(m_RadiusVector, g_ELP6,  sizeof(g_ELP6)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_RadiusVector, g_ELP9,  sizeof(g_ELP9)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 1);
+  AddPlanetaryTerms   (m_RadiusVector, g_ELP12, sizeof(g_ELP12)/sizeof(ELP2000PlanetPertCoefficient), 0, true);
+  AddPlanetaryTerms   (m_RadiusVector, g_ELP15, sizeof(g_ELP15)/sizeof(ELP2000PlanetPertCoefficient), 1, true);
+  AddPlanetaryTerms   (m_RadiusVector, g_ELP18, sizeof(g_ELP18)/sizeof(ELP2000PlanetPertCoefficient), 0, false);
+  AddPlanetaryTerms   (m_RadiusVector, g_ELP21, sizeof(g_ELP21)/sizeof(ELP2000PlanetPertCoefficient), 1, false);
+  AddPerturbationTerms(m_RadiusVector, g_ELP24, sizeof(g_ELP24)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_RadiusVector, g_ELP27, sizeof(g_ELP27)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 1);
+  AddPerturbationTerms(m_RadiusVector, g_ELP30, sizeof(g_ELP30)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_RadiusVector, g_ELP33, sizeof(g_ELP33)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 0);
+  AddPerturbationTerms(m_RadiusVector, g_ELP36, sizeof(g_ELP36)/sizeof(ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient), 2);
+
+  m_Longitude.Anchor(StartJD);
+  m_Latitude.Anchor(StartJD);
+  m_RadiusVector.Anchor(StartJD);
+}
+
+double CAAELP2000Stepper::EclipticLongitude(double JD)
+{
+  const double A = m_Longitude.Calculate(JD);
+  return CAACoordinateTransformation::MapTo0To360Range(A/3600.0 + CAACoordinateTransformation::RadiansToDegrees(CAAELP2000::MoonMeanLongitude(JD)));
+}
+
+double CAAELP2000Stepper::EclipticLatitude(double JD)
+{
+  const double B = m_Latitude.Calculate(JD);
+  return CAACoordinateTransformation::MapToMinus90To90Range(B/3600.0);
+}
+
+double CAAELP2000Stepper::RadiusVector(double JD)
+{
+  const double fValue = m_RadiusVector.Calculate(JD);
+  return fValue * 384747.9806448954 / 384747.9806743165;
+}
@@ -43,6 +43,8 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AAEarth.h"
 #include "AACoordinateTransformation.h"
+#include "AANutation.h"
+#include "AAVSOP87.h"
 #ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
 #include "AAVSOP87D_EAR.h"
 #include "AAVSOP87B_EAR.h"
@@ -57,13 +59,6 @@ using namespace std;
 #pragma warning(disable : 26446 26482 26485)
 #endif //#ifdef _MSC_VER
 
-struct VSOP87Coefficient
-{
-  double A;
-  double B;
-  double C;
-};
-
 const VSOP87Coefficient g_L0EarthCoefficients[] =
 { 
   { 175347046, 0,         0            },
@@ -676,3 +671,14 @@ double CAAEarth::SunMeanAnomaly(double JD) noexcept
   const double Tcubed = Tsquared*T;
   return CAACoordinateTransformation::MapTo0To360Range(357.5291092 + 35999.0502909*T - 0.0001536*Tsquared + Tcubed/24490000);
 }
+
+CAAEarthEpoch::CAAEarthEpoch(double jd, bool highPrecision) noexcept : JD(jd),
+                                                                     bHighPrecision(highPrecision),
+                                                                     EclipticLongitude(CAAEarth::EclipticLongitude(jd, highPrecision)),
+                                                                     EclipticLatitude(CAAEarth::EclipticLatitude(jd, highPrecision)),
+                                                                     RadiusVector(CAAEarth::RadiusVector(jd, highPrecision)),
+                                                                     MeanObliquity(CAANutation::MeanObliquityOfEcliptic(jd)),
+                                                                     NutationInLongitude(CAANutation::NutationInLongitude(jd)),
+                                                                     NutationInObliquity(CAANutation::NutationInObliquity(jd))
+{
+}
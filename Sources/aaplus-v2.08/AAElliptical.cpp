@@ -82,6 +82,7 @@ to maintain a single distribution point for the source code.
 #include "AAFK5.h"
 #include "AANutation.h"
 #include "AAKepler.h"
+#include "AAInstrumentation.h"
 #include <cmath>
 #include <cassert>
 using namespace std;
@@ -91,6 +92,9 @@ using namespace std;
 
 CAAEllipticalPlanetaryDetails CAAElliptical::Calculate(double JD, EllipticalObject object, bool bHighPrecision) noexcept
 {
+  AAPLUS_INSTRUMENT_CALL(EllipticalLightTime);
+  AAPLUS_INSTRUMENT_SCOPE(EllipticalLightTime);
+
   //What will be the return value
   CAAEllipticalPlanetaryDetails details;
 
@@ -116,6 +120,7 @@ CAAEllipticalPlanetaryDetails CAAElliptical::Calculate(double JD, EllipticalObje
     double RPrevious = 0;
     while (bRecalc)
     {
+      AAPLUS_INSTRUMENT_TERMS(EllipticalLightTime, 1);
       switch (object)
       {
         case EllipticalObject::MERCURY:
@@ -169,9 +174,10 @@ CAAEllipticalPlanetaryDetails CAAElliptical::Calculate(double JD, EllipticalObje
         }
         case EllipticalObject::PLUTO:
         {
-          L = CAAPluto::EclipticLongitude(JD0);
-          B = CAAPluto::EclipticLatitude(JD0);
-          R = CAAPluto::RadiusVector(JD0);
+          const CAAPlutoDetails pluto = CAAPluto::Position(JD0);
+          L = pluto.EclipticLongitude;
+          B = pluto.EclipticLatitude;
+          R = pluto.RadiusVector;
           break;
         }
         default:
@@ -29,10 +29,8 @@ to maintain a single distribution point for the source code.
 
 #include "stdafx.h"
 #include "AAEquationOfTime.h"
-#include "AA2DCoordinate.h"
 #include "AACoordinateTransformation.h"
 #include "AASun.h"
-#include "AANutation.h"
 #include <cmath>
 using namespace std;
 
@@ -40,6 +38,11 @@ using namespace std;
 ///////////////////////// Implementation //////////////////////////////////////
 
 double CAAEquationOfTime::Calculate(double JD, bool bHighPrecision) noexcept
+{
+  return CAASun::ApparentPosition(JD, bHighPrecision).EquationOfTime;
+}
+
+double CAAEquationOfTime::Calculate(double JD, double SunApparentRightAscension, double NutationInLongitude, double TrueObliquity) noexcept
 {
   const double rho = (JD - 2451545) / 365250;
   const double rhosquared = rho*rho;
@@ -51,14 +54,8 @@ double CAAEquationOfTime::Calculate(double JD, bool bHighPrecision) noexcept
   const double L0 = CAACoordinateTransformation::MapTo0To360Range(280.4664567 + 360007.6982779*rho + 0.03032028*rhosquared +
                                                                   rhocubed / 49931 - rho4 / 15300 - rho5 / 2000000);
 
-  //Calculate the Suns apparent right ascension
-  const double SunLong = CAASun::ApparentEclipticLongitude(JD, bHighPrecision);
-  const double SunLat = CAASun::ApparentEclipticLatitude(JD, bHighPrecision);
-  double epsilon = CAANutation::TrueObliquityOfEcliptic(JD);
-  const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(SunLong, SunLat, epsilon);
-
-  epsilon = CAACoordinateTransformation::DegreesToRadians(epsilon);
-  double E = L0 - 0.0057183 - Equatorial.X*15 + CAACoordinateTransformation::DMSToDegrees(0, 0, CAANutation::NutationInLongitude(JD))*cos(epsilon);
+  const double epsilon = CAACoordinateTransformation::DegreesToRadians(TrueObliquity);
+  double E = L0 - 0.0057183 - SunApparentRightAscension*15 + CAACoordinateTransformation::DMSToDegrees(0, 0, NutationInLongitude)*cos(epsilon);
   if (E > 180)
     E = -(360 - E);
   E *= 4; //Convert to minutes of time
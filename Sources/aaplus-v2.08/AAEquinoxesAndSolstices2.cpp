@@ -24,10 +24,9 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AAEquinoxesAndSolstices2.h"
 #include "AASun.h"
-#include "AANutation.h"
-#include "AACoordinateTransformation.h"
-#include "AAInterpolate.h"
+#include "AAEventFinder.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -38,64 +37,49 @@ vector<CAAEquinoxSolsticeDetails2> CAAEquinoxesAndSolstices2::Calculate(double S
   //What will be the return value
   vector<CAAEquinoxSolsticeDetails2> events;
 
-  double JD = StartJD;
-  double LastJD0 = 0;
-  double LastJD1 = 0;
-  double LastLatitude0 = -90;
-  double LastLatitude1 = -90;
-  while (JD < EndJD)
+  //The equinoxes are the roots and the solstices are the extrema of the apparent declination of the Sun. The
+  //position of the Sun is stepped along the same grid of dates which CAAEventFinder samples
+  CAASunStepper sun(StartJD, StepInterval, bHighPrecision);
+  auto Declination = [&sun](double JD)
   {
-    const double lambda = CAASun::ApparentEclipticLongitude(JD, bHighPrecision);
-    const double beta = CAASun::ApparentEclipticLatitude(JD, bHighPrecision);
-    const double epsilon = CAANutation::TrueObliquityOfEcliptic(JD);
-    const CAA2DCoordinate Solarcoord = CAACoordinateTransformation::Ecliptic2Equatorial(lambda, beta, epsilon);
-    if (LastLatitude0 != -90)
+    return sun.Calculate(JD).ApparentDeclination;
+  };
+  const vector<CAAEventFinderDetails> found = CAAEventFinder::Calculate(StartJD, EndJD, StepInterval, Declination);
+  for (const auto& detail : found)
+  {
+    CAAEquinoxSolsticeDetails2 event;
+    event.JD = detail.JD;
+    switch (detail.type)
     {
-      if ((LastLatitude0 < 0) && (Solarcoord.Y >= 0))
+      case CAAEventFinderDetails::Type::AscendingRoot:
       {
-        CAAEquinoxSolsticeDetails2 event;
         event.type = CAAEquinoxSolsticeDetails2::Type::NorthwardEquinox;
-        const double fraction = (0 - LastLatitude0) / (Solarcoord.Y - LastLatitude0);
-        event.JD = LastJD0 + (fraction * StepInterval);
-        events.push_back(event);
+        break;
       }
-      else if ((LastLatitude0 > 0) && (Solarcoord.Y <= 0))
+      case CAAEventFinderDetails::Type::DescendingRoot:
       {
-        CAAEquinoxSolsticeDetails2 event;
         event.type = CAAEquinoxSolsticeDetails2::Type::SouthwardEquinox;
-        const double fraction = (0 - LastLatitude0) / (Solarcoord.Y - LastLatitude0);
-        event.JD = LastJD0 + (fraction * StepInterval);
-        events.push_back(event);
+        break;
       }
-    }
-    if ((LastLatitude0 != -90) && (LastLatitude1 != -90))
-    {
-      if ((LastLatitude0 > Solarcoord.Y) && (LastLatitude0 > LastLatitude1))
+      case CAAEventFinderDetails::Type::Maximum:
       {
-        CAAEquinoxSolsticeDetails2 event;
         event.type = CAAEquinoxSolsticeDetails2::Type::NorthernSolstice;
-        double fraction = 0;
-        event.Declination = CAAInterpolate::Extremum(LastLatitude1, LastLatitude0, Solarcoord.Y, fraction);
-        event.JD = JD - StepInterval + (fraction*StepInterval);
-        events.push_back(event);
+        event.Declination = detail.Value;
+        break;
       }
-      else if ((LastLatitude0 < Solarcoord.Y) && (LastLatitude0 < LastLatitude1))
+      case CAAEventFinderDetails::Type::Minimum:
       {
-        CAAEquinoxSolsticeDetails2 event;
         event.type = CAAEquinoxSolsticeDetails2::Type::SouthernSolstice;
-        double fraction = 0;
-        event.Declination = CAAInterpolate::Extremum(LastLatitude1, LastLatitude0, Solarcoord.Y, fraction);
-        event.JD = JD - StepInterval + (fraction*StepInterval);
-        events.push_back(event);
+        event.Declination = detail.Value;
+        break;
+      }
+      default:
+      {
+        assert(false);
+        break;
       }
     }
-
-    //Prepare for the next loop
-    LastLatitude1 = LastLatitude0;
-    LastLatitude0 = Solarcoord.Y;
-    LastJD0 = JD;
-    LastJD1 = LastJD0;
-    JD += StepInterval;
+    events.push_back(event);
   }
 
   return events;
@@ -0,0 +1,378 @@
+/*
+Module : AAEventFinder.cpp
+Purpose: Implementation for a generic root and extremum finder for functions of time
+Created: 18-10-2026
+History: None
+
+*/
+
+
+////////////////////// Includes ///////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AAEventFinder.h"
+#include <cmath>
+#include <cassert>
+#include <cfloat>
+#include <algorithm>
+using namespace std;
+
+
+////////////////////// Macros / Defines ///////////////////////////////////////
+
+constexpr int AAEVENTFINDER_MAX_ITERATIONS = 100;
+constexpr size_t AAEVENTFINDER_BATCH_SIZE = 256;
+
+
+////////////////////// Implementation /////////////////////////////////////////
+
+vector<CAAEventFinderDetails> CAAEventFinder::Calculate(double StartJD, double EndJD, double StepInterval, const Function& function, bool bRoots, bool bExtrema, double Tolerance, const Function& derivative)
+{
+  //Validate our parameters
+  assert(function);
+
+  auto sampler = [&function](const double* pJD, double* pValues, size_t nCount)
+  {
+    for (size_t i=0; i<nCount; i++)
+    {
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      pValues[i] = function(pJD[i]);
+    }
+  };
+  return Calculate(StartJD, EndJD, StepInterval, sampler, function, bRoots, bExtrema, Tolerance, derivative);
+}
+
+vector<CAAEventFinderDetails> CAAEventFinder::Calculate(double StartJD, double EndJD, double StepInterval, const BatchFunction& function, bool bRoots, bool bExtrema, double Tolerance)
+{
+  //Validate our parameters
+  assert(function);
+
+  //The refinement stage evaluates the batch function one value at a time
+  auto scalar = [&function](double JD)
+  {
+    double Value = 0;
+    function(&JD, &Value, 1);
+    return Value;
+  };
+  return Calculate(StartJD, EndJD, StepInterval, function, scalar, bRoots, bExtrema, Tolerance, nullptr);
+}
+
+vector<CAAEventFinderDetails> CAAEventFinder::Calculate(double StartJD, double EndJD, double StepInterval, const BatchFunction& sampler, const Function& function, bool bRoots, bool bExtrema, double Tolerance, const Function& derivative)
+{
+  //Validate our parameters
+  assert(StepInterval > 0);
+
+  //What will be the return value
+  vector<CAAEventFinderDetails> events;
+
+  //Sample the function in batches, carrying the last two samples across batches so that events which straddle a batch boundary are still found
+  vector<double> JDs;
+  JDs.reserve(AAEVENTFINDER_BATCH_SIZE);
+  vector<double> Values(AAEVENTFINDER_BATCH_SIZE);
+  size_t nSamples = 0;
+  double JD0 = 0;
+  double JD1 = 0;
+  double Value0 = 0;
+  double Value1 = 0;
+  size_t nIndex = 0;
+  for (;;)
+  {
+    //Form the next batch of times to sample at
+    JDs.clear();
+    while (JDs.size() < AAEVENTFINDER_BATCH_SIZE)
+    {
+      const double JD = StartJD + (nIndex * StepInterval);
+      if (JD >= EndJD)
+        break;
+      JDs.push_back(JD);
+      ++nIndex;
+    }
+    if (JDs.empty())
+      break;
+    sampler(JDs.data(), Values.data(), JDs.size());
+
+    for (size_t i=0; i<JDs.size(); i++)
+    {
+      const double JD2 = JDs[i];
+      const double Value2 = Values[i];
+      if (bRoots && (nSamples >= 1))
+      {
+        if ((Value1 < 0) && (Value2 >= 0))
+        {
+          CAAEventFinderDetails event;
+          event.type = CAAEventFinderDetails::Type::AscendingRoot;
+          event.JD = Root(function, JD1, JD2, Value1, Value2, Tolerance, derivative);
+          events.push_back(event);
+        }
+        else if ((Value1 > 0) && (Value2 <= 0))
+        {
+          CAAEventFinderDetails event;
+          event.type = CAAEventFinderDetails::Type::DescendingRoot;
+          event.JD = Root(function, JD1, JD2, Value1, Value2, Tolerance, derivative);
+          events.push_back(event);
+        }
+      }
+      if (bExtrema && (nSamples >= 2))
+      {
+        if ((Value1 > Value0) && (Value1 > Value2))
+        {
+          CAAEventFinderDetails event;
+          event.type = CAAEventFinderDetails::Type::Maximum;
+          event.JD = Extremum(function, JD0, JD1, JD2, Value1, true, event.Value, Tolerance, derivative);
+          events.push_back(event);
+        }
+        else if ((Value1 < Value0) && (Value1 < Value2))
+        {
+          CAAEventFinderDetails event;
+          event.type = CAAEventFinderDetails::Type::Minimum;
+          event.JD = Extremum(function, JD0, JD1, JD2, Value1, false, event.Value, Tolerance, derivative);
+          events.push_back(event);
+        }
+      }
+
+      //Prepare for the next sample
+      JD0 = JD1;
+      Value0 = Value1;
+      JD1 = JD2;
+      Value1 = Value2;
+      ++nSamples;
+    }
+  }
+
+  //Roots and extrema are found in separate passes over each sample, so put them back into time order
+  stable_sort(events.begin(), events.end(), [](const CAAEventFinderDetails& a, const CAAEventFinderDetails& b) noexcept { return a.JD < b.JD; });
+
+  return events;
+}
+
+double CAAEventFinder::Root(const Function& function, double A, double B, double fA, double fB, double Tolerance, const Function& derivative)
+{
+  //Validate our parameters
+  assert(function);
+  assert(((fA <= 0) && (fB >= 0)) || ((fA >= 0) && (fB <= 0)));
+
+  //Handle the trivial cases
+  if (fA == 0)
+    return A;
+  if (fB == 0)
+    return B;
+
+  if (derivative)
+  {
+    //Use a Newton-Raphson iteration which falls back to bisection whenever the step would leave the bracket or is not converging quickly enough
+    double Low = (fA < 0) ? A : B;
+    double High = (fA < 0) ? B : A;
+    double x = A - (fA * (B - A) / (fB - fA));
+    double LastStep = fabs(B - A);
+    for (int i=0; i<AAEVENTFINDER_MAX_ITERATIONS; i++)
+    {
+      const double fx = function(x);
+      if (fx == 0)
+        return x;
+      if (fx < 0)
+        Low = x;
+      else
+        High = x;
+      const double fDashx = derivative(x);
+      double NewX = (fDashx != 0) ? (x - (fx / fDashx)) : 0;
+      if ((fDashx != 0) && (fabs(NewX - x) <= Tolerance))
+        return NewX;
+      const double BracketLow = min(Low, High);
+      const double BracketHigh = max(Low, High);
+      if ((fDashx == 0) || (NewX <= BracketLow) || (NewX >= BracketHigh) || (fabs(NewX - x) > (LastStep / 2)))
+        NewX = (Low + High) / 2;
+      LastStep = fabs(NewX - x);
+      x = NewX;
+      if ((LastStep <= Tolerance) || ((BracketHigh - BracketLow) <= Tolerance))
+        return x;
+    }
+    return x;
+  }
+
+  //Otherwise use Brent's method which combines bisection, secant and inverse quadratic interpolation steps
+  double a = A;
+  double b = B;
+  double c = B;
+  double fa = fA;
+  double fb = fB;
+  double fc = fB;
+  double d = b - a;
+  double e = d;
+  for (int i=0; i<AAEVENTFINDER_MAX_ITERATIONS; i++)
+  {
+    if (((fb > 0) && (fc > 0)) || ((fb < 0) && (fc < 0)))
+    {
+      c = a;
+      fc = fa;
+      d = b - a;
+      e = d;
+    }
+    if (fabs(fc) < fabs(fb))
+    {
+      a = b;
+      b = c;
+      c = a;
+      fa = fb;
+      fb = fc;
+      fc = fa;
+    }
+    const double tol1 = (2 * DBL_EPSILON * fabs(b)) + (Tolerance / 2);
+    const double xm = (c - b) / 2;
+    if ((fabs(xm) <= tol1) || (fb == 0))
+      return b;
+    if ((fabs(e) >= tol1) && (fabs(fa) > fabs(fb)))
+    {
+      const double s = fb / fa;
+      double p = 0;
+      double q = 0;
+      if (a == c)
+      {
+        p = 2 * xm * s;
+        q = 1 - s;
+      }
+      else
+      {
+        const double q2 = fa / fc;
+        const double r = fb / fc;
+        p = s * ((2 * xm * q2 * (q2 - r)) - ((b - a) * (r - 1)));
+        q = (q2 - 1) * (r - 1) * (s - 1);
+      }
+      if (p > 0)
+        q = -q;
+      else
+        p = -p;
+      if ((2 * p) < min((3 * xm * q) - fabs(tol1 * q), fabs(e * q)))
+      {
+        e = d;
+        d = p / q;
+      }
+      else
+      {
+        d = xm;
+        e = d;
+      }
+    }
+    else
+    {
+      d = xm;
+      e = d;
+    }
+    a = b;
+    fa = fb;
+    if (fabs(d) > tol1)
+      b += d;
+    else
+      b += ((xm > 0) ? tol1 : -tol1);
+    fb = function(b);
+  }
+
+  return b;
+}
+
+double CAAEventFinder::Extremum(const Function& function, double A, double B, double C, double fB, bool bMaximum, double& Value, double Tolerance, const Function& derivative)
+{
+  //Validate our parameters
+  assert(function);
+  assert(((A < B) && (B < C)) || ((A > B) && (B > C)));
+
+  if (derivative)
+  {
+    //The extremum is a root of the derivative, provided the derivative changes sign across the bracket
+    const double fDashA = derivative(A);
+    const double fDashC = derivative(C);
+    if (((fDashA <= 0) && (fDashC >= 0)) || ((fDashA >= 0) && (fDashC <= 0)))
+    {
+      const double JD = Root(derivative, A, C, fDashA, fDashC, Tolerance);
+      Value = function(JD);
+      return JD;
+    }
+  }
+
+  //Otherwise use Brent's parabolic interpolation, minimizing the negated function for a maximum
+  const double sign = bMaximum ? -1 : 1;
+  constexpr double CGOLD = 0.3819660112501051;
+  double a = min(A, C);
+  double b = max(A, C);
+  double x = B;
+  double w = B;
+  double v = B;
+  double fx = sign * fB;
+  double fw = fx;
+  double fv = fx;
+  double d = 0;
+  double e = 0;
+  for (int i=0; i<AAEVENTFINDER_MAX_ITERATIONS; i++)
+  {
+    const double xm = (a + b) / 2;
+    const double tol1 = (2 * DBL_EPSILON * fabs(x)) + (Tolerance / 2);
+    const double tol2 = 2 * tol1;
+    if (fabs(x - xm) <= (tol2 - ((b - a) / 2)))
+      break;
+    bool bGoldenSection = true;
+    if (fabs(e) > tol1)
+    {
+      //Try a parabolic fit through x, w and v
+      double r = (x - w) * (fx - fv);
+      double q = (x - v) * (fx - fw);
+      double p = ((x - v) * q) - ((x - w) * r);
+      q = 2 * (q - r);
+      if (q > 0)
+        p = -p;
+      q = fabs(q);
+      const double etemp = e;
+      e = d;
+      if ((fabs(p) < fabs(q * etemp / 2)) && (p > (q * (a - x))) && (p < (q * (b - x))))
+      {
+        d = p / q;
+        const double u = x + d;
+        if (((u - a) < tol2) || ((b - u) < tol2))
+          d = (xm >= x) ? tol1 : -tol1;
+        bGoldenSection = false;
+      }
+    }
+    if (bGoldenSection)
+    {
+      e = (x >= xm) ? (a - x) : (b - x);
+      d = CGOLD * e;
+    }
+    const double u = (fabs(d) >= tol1) ? (x + d) : (x + ((d >= 0) ? tol1 : -tol1));
+    const double fu = sign * function(u);
+    if (fu <= fx)
+    {
+      if (u >= x)
+        a = x;
+      else
+        b = x;
+      v = w;
+      fv = fw;
+      w = x;
+      fw = fx;
+      x = u;
+      fx = fu;
+    }
+    else
+    {
+      if (u < x)
+        a = u;
+      else
+        b = u;
+      if ((fu <= fw) || (w == x))
+      {
+        v = w;
+        fv = fw;
+        w = u;
+        fw = fu;
+      }
+      else if ((fu <= fv) || (v == x) || (v == w))
+      {
+        v = u;
+        fv = fu;
+      }
+    }
+  }
+
+  Value = sign * fx;
+  return x;
+}
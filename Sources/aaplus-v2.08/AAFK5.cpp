@@ -58,25 +58,15 @@ double CAAFK5::CorrectionInLatitude(double Longitude, double JD) noexcept
 
 CAA3DCoordinate CAAFK5::ConvertVSOPToFK5J2000(const CAA3DCoordinate& value) noexcept
 {
-  CAA3DCoordinate result;
-  result.X = value.X + 0.000000440360 * value.Y - 0.000000190919 * value.Z;
-  result.Y = -0.000000479966 * value.X + 0.917482137087 * value.Y - 0.397776982902 * value.Z;
-  result.Z = 0.397776982902 * value.Y + 0.917482137087 * value.Z;
-
-  return result;
+  return CAARotationMatrix::VSOPToFK5J2000() * value;
 }
 
 CAA3DCoordinate CAAFK5::ConvertVSOPToFK5B1950(const CAA3DCoordinate& value) noexcept
 {
-  CAA3DCoordinate result;
-  result.X = 0.999925702634 * value.X + 0.012189716217 * value.Y + 0.000011134016 * value.Z;
-  result.Y = -0.011179418036 * value.X + 0.917413998946 * value.Y - 0.397777041885 * value.Z;
-  result.Z = -0.004859003787 * value.X + 0.397747363646 * value.Y + 0.917482111428 * value.Z;
-
-  return result;
+  return CAARotationMatrix::VSOPToFK5B1950() * value;
 }
 
-CAA3DCoordinate CAAFK5::ConvertVSOPToFK5AnyEquinox(const CAA3DCoordinate& value, double JDEquinox) noexcept
+CAARotationMatrix CAAFK5::VSOPToFK5AnyEquinoxMatrix(double JDEquinox) noexcept
 {
   const double t = (JDEquinox - 2451545.0) / 36525;
   const double tsquared = t*t;
@@ -108,10 +98,16 @@ CAA3DCoordinate CAAFK5::ConvertVSOPToFK5AnyEquinox(const CAA3DCoordinate& value,
   const double zy = -sinzeta * sinphi;
   const double zz = cosphi;
 
-  CAA3DCoordinate result;
-  result.X = xx * value.X + yx * value.Y + zx * value.Z;
-  result.Y = xy * value.X + yy * value.Y + zy * value.Z;
-  result.Z = xz * value.X + yz * value.Y + zz * value.Z;
+  return CAARotationMatrix(xx, yx, zx, xy, yy, zy, xz, yz, zz);
+}
 
-  return result;
+CAA3DCoordinate CAAFK5::ConvertVSOPToFK5AnyEquinox(const CAA3DCoordinate& value, double JDEquinox) noexcept
+{
+  return VSOPToFK5AnyEquinoxMatrix(JDEquinox) * value;
+}
+
+void CAAFK5::ConvertVSOPToFK5AnyEquinox(const CAA3DCoordinate* pValues, CAA3DCoordinate* pResults, size_t nCount, double JDEquinox) noexcept
+{
+  //The matrix only depends on the equinox, so form it once for all of the positions
+  VSOPToFK5AnyEquinoxMatrix(JDEquinox).Apply(pValues, pResults, nCount);
 }
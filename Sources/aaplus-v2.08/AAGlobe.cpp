@@ -28,18 +28,115 @@ to maintain a single distribution point for the source code.
 #include "AAGlobe.h"
 #include "AACoordinateTransformation.h"
 #include <cmath>
+#include <cassert>
+#include <vector>
+#ifndef AAPLUS_NO_THREADS
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#endif //#ifndef AAPLUS_NO_THREADS
 using namespace std;
 
 
+/////////////////////////// Macros / Defines //////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26482)
+#endif //#ifdef _MSC_VER
+
+constexpr double AAGLOBE_EQUATORIAL_RADIUS = 6378.14; //In kilometres
+
+constexpr double AAGLOBE_EQUATORIAL_RADIUS_METRES = 6378140;
+
+constexpr double AAGLOBE_POLAR_RATIO = 0.99664719; //b/a, the ratio of the polar to the equatorial radius
+
+constexpr double AAGLOBE_FLATTENING = 0.0033528131778969144060323814696721;
+
+constexpr double AAGLOBE_ECCENTRICITY_SQUARED = 0.0066943847614084;
+
+#ifndef UNREFERENCED_PARAMETER
+#define UNREFERENCED_PARAMETER(x) ((void)(x))
+#endif //#ifndef UNREFERENCED_PARAMETER
+
+constexpr size_t AAGLOBE_BLOCK_SIZE = 64; //The number of rows and columns in each block of CAAGlobe::DistanceMatrix
+
+
 /////////////////////////// Implementation ////////////////////////////////////
 
+//Formula 11.1 from the sines and cosines of F, G and lambda (the half sum and half difference of the latitudes and
+//the half difference of the longitudes), which is shared by the scalar and batch versions of DistanceBetweenPoints
+static double DistanceBetweenPoints(double sinF, double cosF, double sinG, double cosG, double sinLambda, double cosLambda) noexcept
+{
+  const double S = (sinG*sinG*cosLambda*cosLambda) + (cosF*cosF*sinLambda*sinLambda);
+  const double C = (cosG*cosG*cosLambda*cosLambda) + (sinF*sinF*sinLambda*sinLambda);
+  const double w = atan(sqrt(S/C));
+  const double R = sqrt(S*C)/w;
+  const double D = 2*w*AAGLOBE_EQUATORIAL_RADIUS;
+  const double Hprime = (3*R - 1) / (2*C);
+  const double Hprime2 = (3*R + 1) / (2*S);
+
+  return D * (1 + (AAGLOBE_FLATTENING*Hprime*sinF*sinF*cosG*cosG) - (AAGLOBE_FLATTENING*Hprime2*cosF*cosF*sinG*sinG));
+}
+
+//The batch and matrix versions take the distance between coincident points as zero, where formula 11.1 divides by zero
+static double DistanceBetweenDistinctPoints(double sinF, double cosF, double sinG, double cosG, double sinLambda, double cosLambda) noexcept
+{
+  if ((sinG == 0) && (sinLambda == 0))
+    return 0;
+  return DistanceBetweenPoints(sinF, cosF, sinG, cosG, sinLambda, cosLambda);
+}
+
+//The sine and cosine of the reduced latitude u, where tan(u) = (b/a)tan(latitude), without evaluating the tangent
+//and its inverse
+static void ReducedLatitude(double sinLatitude, double cosLatitude, double& sinU, double& cosU) noexcept
+{
+  const double bsinLatitude = AAGLOBE_POLAR_RATIO * sinLatitude;
+  const double Denominator = sqrt((cosLatitude*cosLatitude) + (bsinLatitude*bsinLatitude));
+  sinU = bsinLatitude / Denominator;
+  cosU = cosLatitude / Denominator;
+}
+
+//Fills the rows from nRowStart to nRowEnd of a distance matrix, a block of columns at a time from the diagonal,
+//mirroring each value into the lower triangle
+static void DistanceMatrixRows(const double* pSinHalfLatitude, const double* pCosHalfLatitude, const double* pSinHalfLongitude, const double* pCosHalfLongitude,
+                               double* pResults, size_t nCount, size_t nRowStart, size_t nRowEnd) noexcept
+{
+  for (size_t nColumnStart=nRowStart; nColumnStart<nCount; nColumnStart+=AAGLOBE_BLOCK_SIZE)
+  {
+    const size_t nColumnEnd = (nCount - nColumnStart) > AAGLOBE_BLOCK_SIZE ? (nColumnStart + AAGLOBE_BLOCK_SIZE) : nCount;
+    for (size_t i=nRowStart; i<nRowEnd; i++)
+    {
+      const double sinA = pSinHalfLatitude[i];
+      const double cosA = pCosHalfLatitude[i];
+      const double sinL = pSinHalfLongitude[i];
+      const double cosL = pCosHalfLongitude[i];
+      double* pRow = pResults + (i * nCount);
+      for (size_t j=(i >= nColumnStart ? i + 1 : nColumnStart); j<nColumnEnd; j++)
+      {
+        //Use the sum and difference formulae to form F, G and lambda from the half angles of each point
+        const double sinF = (sinA*pCosHalfLatitude[j]) + (cosA*pSinHalfLatitude[j]);
+        const double cosF = (cosA*pCosHalfLatitude[j]) - (sinA*pSinHalfLatitude[j]);
+        const double sinG = (sinA*pCosHalfLatitude[j]) - (cosA*pSinHalfLatitude[j]);
+        const double cosG = (cosA*pCosHalfLatitude[j]) + (sinA*pSinHalfLatitude[j]);
+        const double sinLambda = (sinL*pCosHalfLongitude[j]) - (cosL*pSinHalfLongitude[j]);
+        const double cosLambda = (cosL*pCosHalfLongitude[j]) + (sinL*pSinHalfLongitude[j]);
+        const double Distance = DistanceBetweenDistinctPoints(sinF, cosF, sinG, cosG, sinLambda, cosLambda);
+        pRow[j] = Distance;
+        pResults[(j * nCount) + i] = Distance;
+      }
+    }
+  }
+}
+
+
 double CAAGlobe::RhoSinThetaPrime(double GeographicalLatitude, double Height) noexcept
 {
   //Convert from degress to radians
   GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(GeographicalLatitude);
 
-  const double U = atan(0.99664719 * tan(GeographicalLatitude));
-  return 0.99664719 * sin(U) + (Height/6378140 * sin(GeographicalLatitude));
+  const double U = atan(AAGLOBE_POLAR_RATIO * tan(GeographicalLatitude));
+  return AAGLOBE_POLAR_RATIO * sin(U) + (Height/AAGLOBE_EQUATORIAL_RADIUS_METRES * sin(GeographicalLatitude));
 }
 
 double CAAGlobe::RhoCosThetaPrime(double GeographicalLatitude, double Height) noexcept
@@ -47,8 +144,8 @@ double CAAGlobe::RhoCosThetaPrime(double GeographicalLatitude, double Height) no
   //Convert from degress to radians
   GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(GeographicalLatitude);
 
-  const double U = atan(0.99664719 * tan(GeographicalLatitude));
-  return cos(U) + (Height/6378140 * cos(GeographicalLatitude));
+  const double U = atan(AAGLOBE_POLAR_RATIO * tan(GeographicalLatitude));
+  return cos(U) + (Height/AAGLOBE_EQUATORIAL_RADIUS_METRES * cos(GeographicalLatitude));
 }
 
 double CAAGlobe::RadiusOfParallelOfLatitude(double GeographicalLatitude) noexcept
@@ -57,7 +154,7 @@ double CAAGlobe::RadiusOfParallelOfLatitude(double GeographicalLatitude) noexcep
   GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(GeographicalLatitude);
 
   const double sinGeo = sin(GeographicalLatitude);
-  return (6378.14 * cos(GeographicalLatitude)) / (sqrt(1 - 0.0066943847614084*sinGeo*sinGeo));
+  return (AAGLOBE_EQUATORIAL_RADIUS * cos(GeographicalLatitude)) / (sqrt(1 - AAGLOBE_ECCENTRICITY_SQUARED*sinGeo*sinGeo));
 }
 
 double CAAGlobe::RadiusOfCurvature(double GeographicalLatitude) noexcept
@@ -66,7 +163,7 @@ double CAAGlobe::RadiusOfCurvature(double GeographicalLatitude) noexcept
   GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(GeographicalLatitude);
 
   const double sinGeo = sin(GeographicalLatitude);
-  return (6378.14 * (1 - 0.0066943847614084)) / pow((1 - 0.0066943847614084 * sinGeo * sinGeo), 1.5);
+  return (AAGLOBE_EQUATORIAL_RADIUS * (1 - AAGLOBE_ECCENTRICITY_SQUARED)) / pow((1 - AAGLOBE_ECCENTRICITY_SQUARED * sinGeo * sinGeo), 1.5);
 }
 
 double CAAGlobe::DistanceBetweenPoints(double GeographicalLatitude1, double GeographicalLongitude1, double GeographicalLatitude2, double GeographicalLongitude2) noexcept
@@ -80,20 +177,193 @@ double CAAGlobe::DistanceBetweenPoints(double GeographicalLatitude1, double Geog
   const double F = (GeographicalLatitude1 + GeographicalLatitude2) / 2;
   const double G = (GeographicalLatitude1 - GeographicalLatitude2) / 2;
   const double lambda = (GeographicalLongitude1 - GeographicalLongitude2) / 2;
-  const double sinG = sin(G);
-  const double cosG = cos(G);
-  const double cosF = cos(F);
-  const double sinF = sin(F);
-  const double sinLambda = sin(lambda);
-  const double cosLambda = cos(lambda);
-  const double S = (sinG*sinG*cosLambda*cosLambda) + (cosF*cosF*sinLambda*sinLambda);
-  const double C = (cosG*cosG*cosLambda*cosLambda) + (sinF*sinF*sinLambda*sinLambda);
-  const double w = atan(sqrt(S/C));
-  const double R = sqrt(S*C)/w;
-  const double D = 2*w*6378.14;
-  const double Hprime = (3*R - 1) / (2*C);
-  const double Hprime2 = (3*R + 1) / (2*S);
-  constexpr const double f = 0.0033528131778969144060323814696721;
+  return ::DistanceBetweenPoints(sin(F), cos(F), sin(G), cos(G), sin(lambda), cos(lambda));
+}
+
+void CAAGlobe::RhoSinThetaPrime(const double* pGeographicalLatitude, const double* pHeight, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pGeographicalLatitude != nullptr) || (nCount == 0));
+  assert((pHeight != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+  {
+    const double GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(pGeographicalLatitude[i]);
+    const double sinGeo = sin(GeographicalLatitude);
+    double sinU = 0;
+    double cosU = 0;
+    ReducedLatitude(sinGeo, cos(GeographicalLatitude), sinU, cosU);
+    pResults[i] = AAGLOBE_POLAR_RATIO * sinU + (pHeight[i]/AAGLOBE_EQUATORIAL_RADIUS_METRES * sinGeo);
+  }
+}
+
+void CAAGlobe::RhoCosThetaPrime(const double* pGeographicalLatitude, const double* pHeight, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pGeographicalLatitude != nullptr) || (nCount == 0));
+  assert((pHeight != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+  {
+    const double GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(pGeographicalLatitude[i]);
+    const double cosGeo = cos(GeographicalLatitude);
+    double sinU = 0;
+    double cosU = 0;
+    ReducedLatitude(sin(GeographicalLatitude), cosGeo, sinU, cosU);
+    pResults[i] = cosU + (pHeight[i]/AAGLOBE_EQUATORIAL_RADIUS_METRES * cosGeo);
+  }
+}
+
+void CAAGlobe::RadiusOfParallelOfLatitude(const double* pGeographicalLatitude, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pGeographicalLatitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+  {
+    const double GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(pGeographicalLatitude[i]);
+    const double sinGeo = sin(GeographicalLatitude);
+    pResults[i] = (AAGLOBE_EQUATORIAL_RADIUS * cos(GeographicalLatitude)) / (sqrt(1 - AAGLOBE_ECCENTRICITY_SQUARED*sinGeo*sinGeo));
+  }
+}
+
+void CAAGlobe::RadiusOfCurvature(const double* pGeographicalLatitude, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pGeographicalLatitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
 
-  return D * (1 + (f*Hprime*sinF*sinF*cosG*cosG) - (f*Hprime2*cosF*cosF*sinG*sinG));
+  constexpr double Numerator = AAGLOBE_EQUATORIAL_RADIUS * (1 - AAGLOBE_ECCENTRICITY_SQUARED);
+  for (size_t i=0; i<nCount; i++)
+  {
+    const double sinGeo = sin(CAACoordinateTransformation::DegreesToRadians(pGeographicalLatitude[i]));
+    const double Value = 1 - AAGLOBE_ECCENTRICITY_SQUARED * sinGeo * sinGeo;
+    pResults[i] = Numerator / (Value * sqrt(Value));
+  }
+}
+
+void CAAGlobe::DistanceBetweenPoints(const double* pGeographicalLatitude1, const double* pGeographicalLongitude1, const double* pGeographicalLatitude2, const double* pGeographicalLongitude2, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pGeographicalLatitude1 != nullptr) || (nCount == 0));
+  assert((pGeographicalLongitude1 != nullptr) || (nCount == 0));
+  assert((pGeographicalLatitude2 != nullptr) || (nCount == 0));
+  assert((pGeographicalLongitude2 != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+  {
+    const double GeographicalLatitude1 = CAACoordinateTransformation::DegreesToRadians(pGeographicalLatitude1[i]);
+    const double GeographicalLatitude2 = CAACoordinateTransformation::DegreesToRadians(pGeographicalLatitude2[i]);
+    const double F = (GeographicalLatitude1 + GeographicalLatitude2) / 2;
+    const double G = (GeographicalLatitude1 - GeographicalLatitude2) / 2;
+    const double lambda = CAACoordinateTransformation::DegreesToRadians(pGeographicalLongitude1[i] - pGeographicalLongitude2[i]) / 2;
+    pResults[i] = DistanceBetweenDistinctPoints(sin(F), cos(F), sin(G), cos(G), sin(lambda), cos(lambda));
+  }
+}
+
+void CAAGlobe::DistanceMatrix(const double* pGeographicalLatitude, const double* pGeographicalLongitude, double* pResults, size_t nCount, unsigned int nThreads)
+{
+  //Validate our parameters
+  assert((pGeographicalLatitude != nullptr) || (nCount == 0));
+  assert((pGeographicalLongitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  //The sines and cosines of half of each latitude and longitude, from which those of F, G and lambda for every pair
+  //of points follow without any further trigonometric functions
+  vector<double> SinHalfLatitude(nCount);
+  vector<double> CosHalfLatitude(nCount);
+  vector<double> SinHalfLongitude(nCount);
+  vector<double> CosHalfLongitude(nCount);
+  for (size_t i=0; i<nCount; i++)
+  {
+    const double HalfLatitude = CAACoordinateTransformation::DegreesToRadians(pGeographicalLatitude[i]) / 2;
+    const double HalfLongitude = CAACoordinateTransformation::DegreesToRadians(pGeographicalLongitude[i]) / 2;
+    SinHalfLatitude[i] = sin(HalfLatitude);
+    CosHalfLatitude[i] = cos(HalfLatitude);
+    SinHalfLongitude[i] = sin(HalfLongitude);
+    CosHalfLongitude[i] = cos(HalfLongitude);
+    pResults[(i * nCount) + i] = 0;
+  }
+
+  const size_t nBlocks = (nCount + AAGLOBE_BLOCK_SIZE - 1) / AAGLOBE_BLOCK_SIZE;
+#ifndef AAPLUS_NO_THREADS
+  //Each thread takes the next block of rows in turn. The first blocks hold the most pairs, so handing them out first
+  //keeps the threads evenly loaded
+  if (nThreads == 0)
+    nThreads = thread::hardware_concurrency();
+  nThreads = static_cast<unsigned int>(min<size_t>(max(nThreads, 1U), nBlocks));
+  if (nThreads > 1)
+  {
+    atomic<size_t> nNextBlock{0};
+    auto Worker = [&]() noexcept
+    {
+      for (size_t nBlock=nNextBlock++; nBlock<nBlocks; nBlock=nNextBlock++)
+      {
+        const size_t nRowStart = nBlock * AAGLOBE_BLOCK_SIZE;
+        DistanceMatrixRows(SinHalfLatitude.data(), CosHalfLatitude.data(), SinHalfLongitude.data(), CosHalfLongitude.data(), pResults, nCount, nRowStart, min(nRowStart + AAGLOBE_BLOCK_SIZE, nCount));
+      }
+    };
+    vector<thread> threads;
+    threads.reserve(nThreads - 1);
+    try
+    {
+      for (unsigned int i=1; i<nThreads; i++)
+        threads.emplace_back(Worker);
+    }
+    catch (const system_error&)
+    {
+      //Carry on with the threads which could be created
+    }
+    Worker();
+    for (auto& t : threads)
+      t.join();
+    return;
+  }
+#else
+  UNREFERENCED_PARAMETER(nThreads);
+#endif //#ifndef AAPLUS_NO_THREADS
+
+  for (size_t nBlock=0; nBlock<nBlocks; nBlock++)
+  {
+    const size_t nRowStart = nBlock * AAGLOBE_BLOCK_SIZE;
+    DistanceMatrixRows(SinHalfLatitude.data(), CosHalfLatitude.data(), SinHalfLongitude.data(), CosHalfLongitude.data(), pResults, nCount, nRowStart, min(nRowStart + AAGLOBE_BLOCK_SIZE, nCount));
+  }
+}
+
+void CAAGlobe::Observers(const double* pLongitude, const double* pLatitude, const double* pHeight, CAAObserver* pObservers, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert((pLongitude != nullptr) || (nCount == 0));
+  assert((pLatitude != nullptr) || (nCount == 0));
+  assert((pHeight != nullptr) || (nCount == 0));
+  assert((pObservers != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+  {
+    const double GeographicalLatitude = CAACoordinateTransformation::DegreesToRadians(pLatitude[i]);
+    const double sinGeo = sin(GeographicalLatitude);
+    const double cosGeo = cos(GeographicalLatitude);
+    double sinU = 0;
+    double cosU = 0;
+    ReducedLatitude(sinGeo, cosGeo, sinU, cosU);
+    const double HeightRatio = pHeight[i]/AAGLOBE_EQUATORIAL_RADIUS_METRES;
+    CAAObserver& observer = pObservers[i];
+    observer.Longitude = pLongitude[i];
+    observer.Latitude = pLatitude[i];
+    observer.Height = pHeight[i];
+    observer.RhoSinThetaPrime = AAGLOBE_POLAR_RATIO * sinU + (HeightRatio * sinGeo);
+    observer.RhoCosThetaPrime = cosU + (HeightRatio * cosGeo);
+  }
+}
+
+CAAObserver::CAAObserver(double longitude, double latitude, double height) noexcept : Longitude(longitude),
+                                                                                     Latitude(latitude),
+                                                                                     Height(height),
+                                                                                     RhoSinThetaPrime(CAAGlobe::RhoSinThetaPrime(latitude, height)),
+                                                                                     RhoCosThetaPrime(CAAGlobe::RhoCosThetaPrime(latitude, height))
+{
 }
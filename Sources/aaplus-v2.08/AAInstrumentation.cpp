@@ -0,0 +1,63 @@
+/*
+Module : AAInstrumentation.cpp
+Purpose: Optional instrumentation counters for the hot paths of the AA+ framework
+Created: 18-10-2026
+History: None
+
+*/
+
+
+//////////////////// Includes /////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AAInstrumentation.h"
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define AAPLUS_HAVE_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#include <x86intrin.h>
+#define AAPLUS_HAVE_RDTSC
+#else
+#include <chrono>
+#endif
+using namespace std;
+
+
+//////////////////// Implementation ///////////////////////////////////////////
+
+bool CAAInstrumentation::Enabled() noexcept
+{
+  //This is defined here rather than inline in the header so that it reports how the library was built, rather than
+  //whether the client which includes the header happens to define AAPLUS_INSTRUMENTATION
+#ifdef AAPLUS_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif //#ifdef AAPLUS_INSTRUMENTATION
+}
+
+CAAInstrumentationCounters& CAAInstrumentation::Current() noexcept
+{
+  //Each thread accumulates into its own counters, so the hooks need no synchronisation
+  thread_local CAAInstrumentationCounters counters;
+  return counters;
+}
+
+CAAInstrumentationCounters CAAInstrumentation::Snapshot() noexcept
+{
+  return Current();
+}
+
+void CAAInstrumentation::Reset() noexcept
+{
+  Current() = CAAInstrumentationCounters();
+}
+
+uint64_t CAAInstrumentation::ReadTimer() noexcept
+{
+#ifdef AAPLUS_HAVE_RDTSC
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+#endif //#ifdef AAPLUS_HAVE_RDTSC
+}
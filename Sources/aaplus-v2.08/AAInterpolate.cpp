@@ -23,8 +23,10 @@ to maintain a single distribution point for the source code.
 
 #include "stdafx.h"
 #include "AAInterpolate.h"
+#include "AACoordinateTransformation.h"
 #include <cmath>
 #include <cassert>
+#include <algorithm>
 using namespace std;
 
 
@@ -221,3 +223,282 @@ double CAAInterpolate::Zero2(double Y1, double Y2, double Y3, double Y4, double
 
   return n0;
 }
+
+CAABarycentricInterpolator::CAABarycentricInterpolator(const double* pX, const double* pY, size_t n) : m_X(pX, pX + n),
+                                                                                                      m_Weights(n, 1)
+{
+  //Validate our parameters
+  assert(pX);
+  assert(pY);
+  assert(n);
+
+  //Compute the barycentric weights w(j) = 1 / product over k != j of (X(j) - X(k))
+  for (size_t j=0; j<n; j++)
+  {
+    for (size_t k=0; k<n; k++)
+    {
+      if (k != j)
+        m_Weights[j] *= (m_X[j] - m_X[k]);
+    }
+    m_Weights[j] = 1 / m_Weights[j];
+  }
+
+  SetValues(pY);
+}
+
+void CAABarycentricInterpolator::SetValues(const double* pY)
+{
+  //Validate our parameters
+  assert(pY);
+
+  m_Y.assign(pY, pY + m_X.size());
+}
+
+double CAABarycentricInterpolator::Evaluate(double X) const noexcept
+{
+  //Validate our parameters
+  assert(m_X.size());
+
+  double fNumerator = 0;
+  double fDenominator = 0;
+  const size_t n = m_X.size();
+  for (size_t j=0; j<n; j++)
+  {
+    const double fDelta = X - m_X[j];
+    if (fDelta == 0)
+      return m_Y[j];
+    const double fTerm = m_Weights[j] / fDelta;
+    fNumerator += (fTerm * m_Y[j]);
+    fDenominator += fTerm;
+  }
+
+  return fNumerator / fDenominator;
+}
+
+void CAABarycentricInterpolator::Evaluate(const double* pX, double* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert(pX || (nCount == 0));
+  assert(pResults || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = Evaluate(pX[i]);
+}
+
+CAAChebyshevSeries::CAAChebyshevSeries(double A, double B, std::vector<double> coefficients) : m_A(A),
+                                                                                               m_B(B),
+                                                                                               m_Coefficients(std::move(coefficients))
+{
+  //Validate our parameters
+  assert(B > A);
+}
+
+std::vector<double> CAAChebyshevSeries::Nodes(double A, double B, size_t n)
+{
+  //Validate our parameters
+  assert(B > A);
+  assert(n);
+
+  constexpr double PI = CAACoordinateTransformation::PI();
+  const double fHalfWidth = (B - A) / 2;
+  const double fMidPoint = (B + A) / 2;
+  std::vector<double> nodes(n);
+  for (size_t k=0; k<n; k++)
+    nodes[k] = fMidPoint + fHalfWidth*cos(PI*(k + 0.5)/n);
+
+  return nodes;
+}
+
+CAAChebyshevSeries CAAChebyshevSeries::Fit(double A, double B, const double* pValuesAtNodes, size_t n)
+{
+  //Validate our parameters
+  assert(pValuesAtNodes);
+  assert(n);
+
+  constexpr double PI = CAACoordinateTransformation::PI();
+  std::vector<double> coefficients(n);
+  for (size_t j=0; j<n; j++)
+  {
+    double fSum = 0;
+    for (size_t k=0; k<n; k++)
+      fSum += pValuesAtNodes[k]*cos(PI*j*(k + 0.5)/n);
+    coefficients[j] = 2*fSum/n;
+  }
+
+  return CAAChebyshevSeries(A, B, std::move(coefficients));
+}
+
+CAAChebyshevSeries CAAChebyshevSeries::Fit(const std::function<double(double)>& function, double A, double B, size_t n)
+{
+  std::vector<double> values = Nodes(A, B, n);
+  for (auto& value : values)
+    value = function(value);
+
+  return Fit(A, B, values.data(), n);
+}
+
+double CAAChebyshevSeries::Evaluate(double X) const noexcept
+{
+  if (m_Coefficients.empty())
+    return 0;
+
+  //Use Clenshaw's recurrence
+  const double Y = (2*X - m_A - m_B) / (m_B - m_A);
+  const double Y2 = 2*Y;
+  double D = 0;
+  double DD = 0;
+  for (size_t j=m_Coefficients.size() - 1; j>0; j--)
+  {
+    const double SV = D;
+    D = Y2*D - DD + m_Coefficients[j];
+    DD = SV;
+  }
+
+  return Y*D - DD + 0.5*m_Coefficients[0];
+}
+
+void CAAChebyshevSeries::Evaluate(const double* pX, double* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert(pX || (nCount == 0));
+  assert(pResults || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = Evaluate(pX[i]);
+}
+
+CAAChebyshevSeries CAAChebyshevSeries::Derivative() const
+{
+  const size_t n = m_Coefficients.size();
+  if (n < 2)
+    return CAAChebyshevSeries(m_A, m_B, std::vector<double>(1, 0));
+
+  std::vector<double> derivative(n - 1);
+  derivative[n - 2] = 2*(n - 1)*m_Coefficients[n - 1];
+  if (n > 2)
+    derivative[n - 3] = 2*(n - 2)*m_Coefficients[n - 2];
+  for (size_t j=n - 2; j>1; j--)
+    derivative[j - 2] = derivative[j] + 2*(j - 1)*m_Coefficients[j - 1];
+
+  const double fScale = 2 / (m_B - m_A);
+  for (auto& coefficient : derivative)
+    coefficient *= fScale;
+
+  return CAAChebyshevSeries(m_A, m_B, std::move(derivative));
+}
+
+CAAChebyshevSeries CAAChebyshevSeries::Integral() const
+{
+  const size_t n = m_Coefficients.size();
+  std::vector<double> integral(n + 1, 0);
+  const double fScale = 0.25*(m_B - m_A);
+
+  //Accumulate the constant term so that the integral is zero at A
+  double fSum = 0;
+  double fFactor = 1;
+  for (size_t j=1; j<=n; j++)
+  {
+    const double fNext = ((j + 1) < n) ? m_Coefficients[j + 1] : 0;
+    integral[j] = fScale*(m_Coefficients[j - 1] - fNext)/j;
+    fSum += fFactor*integral[j];
+    fFactor = -fFactor;
+  }
+  integral[0] = 2*fSum;
+
+  return CAAChebyshevSeries(m_A, m_B, std::move(integral));
+}
+
+CAACubicHermiteInterpolator::CAACubicHermiteInterpolator(const double* pX, const double* pY, const double* pYDash, size_t n, bool bAngle) : m_X(pX, pX + n),
+                                                                                                                                          m_Y(pY, pY + n),
+                                                                                                                                          m_YDash(pYDash, pYDash + n),
+                                                                                                                                          m_bAngle(bAngle)
+{
+  //Validate our parameters
+  assert(n >= 2);
+  assert(is_sorted(m_X.begin(), m_X.end()));
+
+  //Unwrap the angles so that there are no discontinuities between adjacent values
+  if (m_bAngle)
+  {
+    constexpr double PI = CAACoordinateTransformation::PI();
+    for (size_t i=1; i<n; i++)
+      m_Y[i] -= (2*PI*round((m_Y[i] - m_Y[i - 1]) / (2*PI)));
+  }
+}
+
+CAACubicHermiteInterpolator CAACubicHermiteInterpolator::Sample(double StartJD, double EndJD, double StepInterval, double (*pFunction)(double JD), double (*pFunctionDash)(double JD), bool bAngle)
+{
+  //Validate our parameters
+  assert(EndJD > StartJD);
+  assert(StepInterval > 0);
+  assert(pFunction);
+  assert(pFunctionDash);
+
+  const size_t n = static_cast<size_t>(ceil((EndJD - StartJD) / StepInterval)) + 1;
+  std::vector<double> X(n);
+  std::vector<double> Y(n);
+  std::vector<double> YDash(n);
+  for (size_t i=0; i<n; i++)
+  {
+    X[i] = (i == (n - 1)) ? EndJD : (StartJD + (i*StepInterval));
+    Y[i] = pFunction(X[i]);
+    YDash[i] = pFunctionDash(X[i]);
+  }
+
+  return CAACubicHermiteInterpolator(X.data(), Y.data(), YDash.data(), n, bAngle);
+}
+
+size_t CAACubicHermiteInterpolator::FindInterval(double X) const noexcept
+{
+  //Returns the index of the start of the interval which contains X, clamping to the first and last intervals
+  const size_t nIndex = upper_bound(m_X.begin(), m_X.end(), X) - m_X.begin();
+  if (nIndex == 0)
+    return 0;
+  return min(nIndex - 1, m_X.size() - 2);
+}
+
+double CAACubicHermiteInterpolator::Evaluate(double X) const noexcept
+{
+  //Validate our parameters
+  assert(m_X.size() >= 2);
+
+  const size_t i = FindInterval(X);
+  const double h = m_X[i + 1] - m_X[i];
+  const double t = (X - m_X[i]) / h;
+  const double t2 = t*t;
+  const double t3 = t2*t;
+  const double h00 = 2*t3 - 3*t2 + 1;
+  const double h10 = t3 - 2*t2 + t;
+  const double h01 = -2*t3 + 3*t2;
+  const double h11 = t3 - t2;
+  const double Y = h00*m_Y[i] + h10*h*m_YDash[i] + h01*m_Y[i + 1] + h11*h*m_YDash[i + 1];
+
+  return m_bAngle ? CAACoordinateTransformation::MapTo0To2PIRange(Y) : Y;
+}
+
+double CAACubicHermiteInterpolator::EvaluateDash(double X) const noexcept
+{
+  //Validate our parameters
+  assert(m_X.size() >= 2);
+
+  const size_t i = FindInterval(X);
+  const double h = m_X[i + 1] - m_X[i];
+  const double t = (X - m_X[i]) / h;
+  const double t2 = t*t;
+  const double h00 = 6*t2 - 6*t;
+  const double h10 = 3*t2 - 4*t + 1;
+  const double h01 = -6*t2 + 6*t;
+  const double h11 = 3*t2 - 2*t;
+
+  return (h00*m_Y[i] + h01*m_Y[i + 1])/h + h10*m_YDash[i] + h11*m_YDash[i + 1];
+}
+
+void CAACubicHermiteInterpolator::Evaluate(const double* pX, double* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert(pX || (nCount == 0));
+  assert(pResults || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = Evaluate(pX[i]);
+}
@@ -24,6 +24,7 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AAKepler.h"
 #include "AACoordinateTransformation.h"
+#include "AAInstrumentation.h"
 #include <cmath>
 using namespace std;
 
@@ -32,6 +33,10 @@ using namespace std;
 
 double CAAKepler::Calculate(double M, double e, int nIterations) noexcept
 {
+  AAPLUS_INSTRUMENT_CALL(Kepler);
+  AAPLUS_INSTRUMENT_TERMS(Kepler, nIterations);
+  AAPLUS_INSTRUMENT_SCOPE(Kepler);
+
   //Convert from degrees to radians
   M = CAACoordinateTransformation::DegreesToRadians(M);
   constexpr double PI = CAACoordinateTransformation::PI();
@@ -0,0 +1,129 @@
+/*
+Module : AALunations.cpp
+Purpose: Implementation for a catalogue of the phases, apsides and nodal passages of the Moon over a range of dates
+Created: 18-10-2026
+History: None
+
+*/
+
+
+////////////////////// Includes ///////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AALunations.h"
+#include "AAMoonPhases.h"
+#include "AAMoonPerigeeApogee.h"
+#include "AAMoonNodes.h"
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+using namespace std;
+
+
+////////////////////// Implementation /////////////////////////////////////////
+
+static void AddEvents(double StartJD, double EndJD, double Epoch, double Period, int nEventsPerPeriod, const CAALunationEventDetails::Type* pTypes,
+                      void (*pCalculate)(const double* pK, double* pResults, size_t nCount, bool bHighPrecision), bool bHighPrecision, vector<CAALunationEventDetails>& events)
+{
+  //Enumerate the k values of the events whose mean dates fall in the range. The true dates differ from the mean
+  //dates by a lot less than the spacing of the events, so one extra k value at either end is enough. Note that k
+  //is formed from an integer so that its fractional part is exact, which the phase calculation relies on
+  const long nFirst = static_cast<long>(floor(((StartJD - Epoch) / Period) * nEventsPerPeriod)) - 1;
+  const long nLast = static_cast<long>(ceil(((EndJD - Epoch) / Period) * nEventsPerPeriod)) + 1;
+  vector<double> K;
+  K.reserve(static_cast<size_t>(nLast - nFirst + 1));
+  for (long n=nFirst; n<=nLast; n++)
+    K.push_back(static_cast<double>(n) / nEventsPerPeriod);
+  vector<double> JD(K.size());
+  pCalculate(K.data(), JD.data(), K.size(), bHighPrecision);
+
+  for (size_t i=0; i<K.size(); i++)
+  {
+    if ((JD[i] >= StartJD) && (JD[i] <= EndJD))
+    {
+      const long nEvent = ((nFirst + static_cast<long>(i)) % nEventsPerPeriod + nEventsPerPeriod) % nEventsPerPeriod;
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      events.emplace_back(pTypes[nEvent], K[i], JD[i]);
+    }
+  }
+}
+
+static void TrueApsides(const double* pK, double* pResults, size_t nCount, bool bHighPrecision)
+{
+  //Integer values of k are perigees and half integer values are apogees, which are alternated in the batch so
+  //evaluate them as two batches of their own
+  vector<double> K[2];
+  vector<size_t> Indices[2];
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double k = pK[i];
+    const int nApogee = (k == floor(k)) ? 0 : 1;
+    K[nApogee].push_back(k);
+    Indices[nApogee].push_back(i);
+  }
+  vector<double> JD[2];
+  JD[0].resize(K[0].size());
+  JD[1].resize(K[1].size());
+  CAAMoonPerigeeApogee::TruePerigee(K[0].data(), JD[0].data(), K[0].size(), bHighPrecision);
+  CAAMoonPerigeeApogee::TrueApogee(K[1].data(), JD[1].data(), K[1].size(), bHighPrecision);
+  for (int j=0; j<2; j++)
+  {
+    for (size_t i=0; i<K[j].size(); i++)
+    {
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      pResults[Indices[j][i]] = JD[j][i];
+    }
+  }
+}
+
+static void TruePhases(const double* pK, double* pResults, size_t nCount, bool bHighPrecision) noexcept
+{
+  CAAMoonPhases::TruePhase(pK, pResults, nCount, bHighPrecision);
+}
+
+static void PassageThroNode(const double* pK, double* pResults, size_t nCount, bool /*bHighPrecision*/) noexcept
+{
+  CAAMoonNodes::PassageThroNode(pK, pResults, nCount);
+}
+
+vector<CAALunationEventDetails> CAALunations::Calculate(double StartJD, double EndJD, bool bPhases, bool bApsides, bool bNodes, bool bHighPrecision)
+{
+  //Validate our parameters
+  assert(EndJD >= StartJD);
+
+  //What will be the return value
+  vector<CAALunationEventDetails> events;
+
+  //Each family is evaluated in its own batch, so that the planetary arguments of the phases which are linear in
+  //k can be advanced by rotation from one event to the next
+  if (bPhases)
+  {
+    constexpr const CAALunationEventDetails::Type Types[4] = { CAALunationEventDetails::Type::NewMoon, CAALunationEventDetails::Type::FirstQuarter, CAALunationEventDetails::Type::FullMoon, CAALunationEventDetails::Type::LastQuarter };
+    events.reserve(events.size() + static_cast<size_t>(((EndJD - StartJD) / 29.530588861) * 4) + 4);
+    AddEvents(StartJD, EndJD, 2451550.09766, 29.530588861, 4, Types, TruePhases, bHighPrecision, events);
+  }
+  if (bApsides)
+  {
+    constexpr const CAALunationEventDetails::Type Types[2] = { CAALunationEventDetails::Type::Perigee, CAALunationEventDetails::Type::Apogee };
+    events.reserve(events.size() + static_cast<size_t>(((EndJD - StartJD) / 27.55454989) * 2) + 2);
+    AddEvents(StartJD, EndJD, 2451534.6698, 27.55454989, 2, Types, TrueApsides, bHighPrecision, events);
+  }
+  if (bNodes)
+  {
+    constexpr const CAALunationEventDetails::Type Types[2] = { CAALunationEventDetails::Type::AscendingNode, CAALunationEventDetails::Type::DescendingNode };
+    events.reserve(events.size() + static_cast<size_t>(((EndJD - StartJD) / 27.212220817) * 2) + 2);
+    AddEvents(StartJD, EndJD, 2451565.1619, 27.212220817, 2, Types, PassageThroNode, bHighPrecision, events);
+  }
+
+  //Merge the families into date order
+  sort(events.begin(), events.end(), [](const CAALunationEventDetails& a, const CAALunationEventDetails& b) noexcept { return a.JD < b.JD; });
+
+  return events;
+}
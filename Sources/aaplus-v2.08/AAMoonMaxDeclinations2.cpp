@@ -25,12 +25,13 @@ to maintain a single distribution point for the source code.
 #include "AAMoonMaxDeclinations2.h"
 #include "AAMoon.h"
 #include "AAELP2000.h"
+#ifndef AAPLUS_NO_ELPMPP02
 #include "AAELPMPP02.h"
+#endif //#ifndef AAPLUS_NO_ELPMPP02
 #include "AANutation.h"
 #include "AACoordinateTransformation.h"
-#include "AAInterpolate.h"
+#include "AAEventFinder.h"
 #include "AAPrecession.h"
-#include "AARiseTransitSet.h"
 #include <cmath>
 #include <cassert>
 using namespace std;
@@ -43,14 +44,8 @@ vector<CAAMoonMaxDeclinationsDetails2> CAAMoonMaxDeclinations2::Calculate(double
   //What will be the return value
   vector<CAAMoonMaxDeclinationsDetails2> events;
 
-  double JD = StartJD;
-  double LastJD0 = 0;
-  double LastJD1 = 0;
-  double LastLatitude0 = -90;
-  double LastLatitude1 = -90;
-  double LastRA0 = 0;
-  double LastRA1 = 0;
-  while (JD < EndJD)
+  //The apparent equatorial coordinates of the Moon
+  auto EquatorialCoordinates = [algorithm](double JD)
   {
     double MoonLong = 0;
     double MoonLat = 0;
@@ -68,6 +63,7 @@ vector<CAAMoonMaxDeclinationsDetails2> CAAMoonMaxDeclinations2::Calculate(double
         MoonLat = CAAELP2000::EclipticLatitude(JD);
         break;
       }
+#ifndef AAPLUS_NO_ELPMPP02
       case Algorithm::ELPMPP02Nominal:
       {
         MoonLong = CAAELPMPP02::EclipticLongitude(JD, CAAELPMPP02::Correction::Nominal);
@@ -92,6 +88,7 @@ vector<CAAMoonMaxDeclinationsDetails2> CAAMoonMaxDeclinations2::Calculate(double
         MoonLat = CAAELPMPP02::EclipticLatitude(JD, CAAELPMPP02::Correction::DE406);
         break;
       }
+#endif //#ifndef AAPLUS_NO_ELPMPP02
       default:
       {
         assert(false);
@@ -103,43 +100,19 @@ vector<CAAMoonMaxDeclinationsDetails2> CAAMoonMaxDeclinations2::Calculate(double
     //Precess the coordinates if required
     if (algorithm != Algorithm::MeeusTruncated)
       Equatorial = CAAPrecession::PrecessEquatorial(Equatorial.X, Equatorial.Y, 2451545, JD);
+    return Equatorial;
+  };
 
-    if ((LastLatitude0 != -90) && (LastLatitude1 != -90))
-    {
-      double tempRA = Equatorial.X;
-      double tempLastRA1 = LastRA1;
-      double tempLastRA0 = LastRA0;
-      CAARiseTransitSet::CorrectRAValuesForInterpolation(tempLastRA1, tempLastRA0, tempRA);
-      if ((LastLatitude0 > Equatorial.Y) && (LastLatitude0 > LastLatitude1))
-      {
-        CAAMoonMaxDeclinationsDetails2 event;
-        event.type = CAAMoonMaxDeclinationsDetails2::Type::MaxNorthernDeclination;
-        double fraction = 0;
-        event.Declination = CAAInterpolate::Extremum(LastLatitude1, LastLatitude0, Equatorial.Y, fraction);
-        event.RA = CAACoordinateTransformation::MapTo0To24Range(CAAInterpolate::Interpolate(fraction, tempLastRA1, tempLastRA0, tempRA));
-        event.JD = JD - StepInterval + (fraction * StepInterval);
-        events.push_back(event);
-      }
-      else if ((LastLatitude0 < Equatorial.Y) && (LastLatitude0 < LastLatitude1))
-      {
-        CAAMoonMaxDeclinationsDetails2 event;
-        event.type = CAAMoonMaxDeclinationsDetails2::Type::MaxSouthernDeclination;
-        double fraction = 0;
-        event.Declination = CAAInterpolate::Extremum(LastLatitude1, LastLatitude0, Equatorial.Y, fraction);
-        event.RA = CAACoordinateTransformation::MapTo0To24Range(CAAInterpolate::Interpolate(fraction, tempLastRA1, tempLastRA0, tempRA));
-        event.JD = JD - StepInterval + (fraction * StepInterval);
-        events.push_back(event);
-      }
-    }
-
-    //Prepare for the next loop
-    LastLatitude1 = LastLatitude0;
-    LastLatitude0 = Equatorial.Y;
-    LastRA1 = LastRA0;
-    LastRA0 = Equatorial.X;
-    LastJD0 = JD;
-    LastJD1 = LastJD0;
-    JD += StepInterval;
+  //The max declinations are the extrema of the declination
+  const vector<CAAEventFinderDetails> found = CAAEventFinder::Calculate(StartJD, EndJD, StepInterval, [&EquatorialCoordinates](double JD) { return EquatorialCoordinates(JD).Y; }, false, true);
+  for (const auto& detail : found)
+  {
+    CAAMoonMaxDeclinationsDetails2 event;
+    event.type = (detail.type == CAAEventFinderDetails::Type::Maximum) ? CAAMoonMaxDeclinationsDetails2::Type::MaxNorthernDeclination : CAAMoonMaxDeclinationsDetails2::Type::MaxSouthernDeclination;
+    event.JD = detail.JD;
+    event.Declination = detail.Value;
+    event.RA = CAACoordinateTransformation::MapTo0To24Range(EquatorialCoordinates(detail.JD).X);
+    events.push_back(event);
   }
 
   return events;
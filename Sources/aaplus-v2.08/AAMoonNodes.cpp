@@ -31,9 +31,55 @@ to maintain a single distribution point for the source code.
 #include "AAMoonNodes.h"
 #include "AACoordinateTransformation.h"
 #include <cmath>
+#include <cstdlib>
+#include <cassert>
 using namespace std;
 
 
+//////////////////////////// Macros / Defines /////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26482)
+#endif //#ifdef _MSC_VER
+
+struct MoonNodesCoefficient
+{
+  int D;
+  int M;
+  int Mdash;
+  int omega;
+  int E; //The power of E which multiplies the term
+  double C;
+};
+
+const MoonNodesCoefficient g_MoonNodesCoefficients[] =
+{
+  { 0, 0,  1,  0, 0, -0.4721 },
+  { 2, 0,  0,  0, 0, -0.1649 },
+  { 2, 0,  -1, 0, 0, -0.0868 },
+  { 2, 0,  1,  0, 0, 0.0084  },
+  { 2, -1, 0,  0, 1, -0.0083 },
+  { 2, -1, -1, 0, 1, -0.0039 },
+  { 0, 0,  2,  0, 0, 0.0034  },
+  { 2, 0,  -2, 0, 0, -0.0031 },
+  { 2, 1,  0,  0, 1, 0.0030  },
+  { 0, 1,  -1, 0, 1, 0.0028  },
+  { 0, 1,  0,  0, 1, 0.0026  },
+  { 4, 0,  0,  0, 0, 0.0025  },
+  { 1, 0,  0,  0, 0, 0.0024  },
+  { 0, 1,  1,  0, 1, 0.0022  },
+  { 0, 0,  0,  1, 0, 0.0017  },
+  { 4, 0,  -1, 0, 0, 0.0014  },
+  { 2, 1,  -1, 0, 1, 0.0005  },
+  { 2, -1, 1,  0, 1, 0.0004  },
+  { 2, -2, 0,  0, 1, -0.0003 },
+  { 4, -1, 0,  0, 1, 0.0003  }
+};
+
+constexpr const int g_MoonNodesMaxMultiples[4] = { 4, 2, 2, 1 };
+constexpr int AAMOONNODES_MAX_MULTIPLE = 4;
+
+
 //////////////////////////// Implementation ///////////////////////////////////
 
 double CAAMoonNodes::PassageThroNode(double k) noexcept
@@ -92,3 +138,87 @@ double CAAMoonNodes::PassageThroNode(double k) noexcept
 
   return JD;
 }
+
+void CAAMoonNodes::PassageThroNode(const double* pK, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pK);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double k = pK[i];
+
+    //convert from K to T
+    const double T = k/1342.23;
+    const double Tsquared = T*T;
+    const double Tcubed = Tsquared*T;
+    const double T4 = Tcubed*T;
+
+    const double omega = CAACoordinateTransformation::MapTo0To360Range(123.9767 - 1.44098956*k + 0.0020608*Tsquared + 0.00000214*Tcubed - 0.000000016*T4);
+    const double V = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(299.75 + 132.85*T - 0.009173*Tsquared));
+    const double P = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(omega + 272.75 - 2.3*T));
+    const double E = 1 - 0.002516*T - 0.0000074*Tsquared;
+
+    //The arguments are all integer combinations of D, M, M' & omega, so build up the sines and cosines of their
+    //multiples using the angle addition formulae rather than calling sin for every term
+    const double Arguments[4] = { CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(183.6380 + 331.73735682*k + 0.0014852*Tsquared + 0.00000209*Tcubed - 0.000000010*T4)),
+                                  CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(17.4006 + 26.82037250*k + 0.0001186*Tsquared + 0.00000006*Tcubed)),
+                                  CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(38.3776 + 355.52747313*k + 0.0123499*Tsquared + 0.000014627*Tcubed - 0.000000069*T4)),
+                                  CAACoordinateTransformation::DegreesToRadians(omega) };
+    double sinMultiples[4][(2 * AAMOONNODES_MAX_MULTIPLE) + 1];
+    double cosMultiples[4][(2 * AAMOONNODES_MAX_MULTIPLE) + 1];
+    for (int j=0; j<4; j++)
+    {
+      const double sinArgument = sin(Arguments[j]);
+      const double cosArgument = cos(Arguments[j]);
+      double* pSin = sinMultiples[j] + AAMOONNODES_MAX_MULTIPLE;
+      double* pCos = cosMultiples[j] + AAMOONNODES_MAX_MULTIPLE;
+      pSin[0] = 0;
+      pCos[0] = 1;
+      for (int m=1; m<=g_MoonNodesMaxMultiples[j]; m++)
+      {
+        pSin[m] = (pSin[m - 1] * cosArgument) + (pCos[m - 1] * sinArgument);
+        pCos[m] = (pCos[m - 1] * cosArgument) - (pSin[m - 1] * sinArgument);
+        pSin[-m] = -pSin[m];
+        pCos[-m] = pCos[m];
+      }
+    }
+
+    double JD = 2451565.1619 + 27.212220817*k
+                + 0.0002762*Tsquared
+                + 0.000000021*Tcubed
+                - 0.000000000088*T4;
+    constexpr const int nMoonNodesCoefficients = sizeof(g_MoonNodesCoefficients) / sizeof(MoonNodesCoefficient);
+    for (int j=0; j<nMoonNodesCoefficients; j++)
+    {
+      const MoonNodesCoefficient& coefficient = g_MoonNodesCoefficients[j];
+      const int Multiples[4] = { coefficient.D, coefficient.M, coefficient.Mdash, coefficient.omega };
+      double sinArgument = 0;
+      double cosArgument = 1;
+      for (int m=0; m<4; m++)
+      {
+        const int nMultiple = Multiples[m];
+        if (nMultiple)
+        {
+          assert(abs(nMultiple) <= g_MoonNodesMaxMultiples[m]);
+          const double sinMultiple = sinMultiples[m][AAMOONNODES_MAX_MULTIPLE + nMultiple];
+          const double cosMultiple = cosMultiples[m][AAMOONNODES_MAX_MULTIPLE + nMultiple];
+          const double sinTemp = (sinArgument * cosMultiple) + (cosArgument * sinMultiple);
+          cosArgument = (cosArgument * cosMultiple) - (sinArgument * sinMultiple);
+          sinArgument = sinTemp;
+        }
+      }
+      JD += ((coefficient.E ? (E * coefficient.C) : coefficient.C) * sinArgument);
+    }
+    JD += (0.0003*sin(V) + 0.0003*sin(P));
+
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = JD;
+  }
+}
@@ -44,7 +44,10 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AAMoonPerigeeApogee.h"
 #include "AACoordinateTransformation.h"
+#include "AAELP2000.h"
 #include <cmath>
+#include <cstdlib>
+#include <cassert>
 using namespace std;
 
 
@@ -235,8 +238,94 @@ const MoonPerigeeApogeeCoefficient g_MoonPerigeeApogeeCoefficients4[] =
 };
 
 
+constexpr const int g_MoonPerigeeApogeeMaxMultiples[3] = { 24, 2, 4 };
+constexpr int AAMOONPERIGEEAPOGEE_MAX_MULTIPLE = 24;
+constexpr int AAMOONPERIGEEAPOGEE_MAX_ITERATIONS = 5;
+constexpr double AAMOONPERIGEEAPOGEE_DIFFERENCE_INTERVAL = 0.01; //In days
+constexpr double AAMOONPERIGEEAPOGEE_TOLERANCE = 0.00001; //In days
+
+
 //////////////////////////////// Implementation ///////////////////////////////
 
+static void TrueApsis(const double* pK, double* pResults, size_t nCount, const MoonPerigeeApogeeCoefficient* pCoefficients, size_t nCoefficients, bool bHighPrecision, double* pFastResults) noexcept
+{
+  //Validate our parameters
+  assert(pK);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double k = pK[i];
+    const double MeanJD = CAAMoonPerigeeApogee::MeanPerigee(k);
+
+    //convert from K to T
+    const double T = k/1325.55;
+    const double Tsquared = T*T;
+    const double Tcubed = Tsquared*T;
+    const double T4 = Tcubed*T;
+
+    //The arguments are all integer combinations of D, M & F, so build up the sines and cosines of their multiples
+    //using the angle addition formulae rather than calling sin for every term
+    const double Arguments[3] = { CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(171.9179 + 335.9106046*k - 0.0100383*Tsquared - 0.00001156*Tcubed + 0.000000055*T4)),
+                                  CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(347.3477 + 27.1577721*k - 0.0008130*Tsquared - 0.0000010*Tcubed)),
+                                  CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(316.6109 + 364.5287911*k - 0.0125053*Tsquared - 0.0000148*Tcubed)) };
+    double sinMultiples[3][(2 * AAMOONPERIGEEAPOGEE_MAX_MULTIPLE) + 1];
+    double cosMultiples[3][(2 * AAMOONPERIGEEAPOGEE_MAX_MULTIPLE) + 1];
+    for (int j=0; j<3; j++)
+    {
+      const double sinArgument = sin(Arguments[j]);
+      const double cosArgument = cos(Arguments[j]);
+      double* pSin = sinMultiples[j] + AAMOONPERIGEEAPOGEE_MAX_MULTIPLE;
+      double* pCos = cosMultiples[j] + AAMOONPERIGEEAPOGEE_MAX_MULTIPLE;
+      pSin[0] = 0;
+      pCos[0] = 1;
+      for (int m=1; m<=g_MoonPerigeeApogeeMaxMultiples[j]; m++)
+      {
+        pSin[m] = (pSin[m - 1] * cosArgument) + (pCos[m - 1] * sinArgument);
+        pCos[m] = (pCos[m - 1] * cosArgument) - (pSin[m - 1] * sinArgument);
+        pSin[-m] = -pSin[m];
+        pCos[-m] = pCos[m];
+      }
+    }
+
+    double Sigma = 0;
+    for (size_t j=0; j<nCoefficients; j++)
+    {
+      const MoonPerigeeApogeeCoefficient& coefficient = pCoefficients[j];
+      const int Multiples[3] = { coefficient.D, coefficient.M, coefficient.F };
+      double sinArgument = 0;
+      double cosArgument = 1;
+      for (int m=0; m<3; m++)
+      {
+        const int nMultiple = Multiples[m];
+        if (nMultiple)
+        {
+          assert(abs(nMultiple) <= g_MoonPerigeeApogeeMaxMultiples[m]);
+          const double sinMultiple = sinMultiples[m][AAMOONPERIGEEAPOGEE_MAX_MULTIPLE + nMultiple];
+          const double cosMultiple = cosMultiples[m][AAMOONPERIGEEAPOGEE_MAX_MULTIPLE + nMultiple];
+          const double sinTemp = (sinArgument * cosMultiple) + (cosArgument * sinMultiple);
+          cosArgument = (cosArgument * cosMultiple) - (sinArgument * sinMultiple);
+          sinArgument = sinTemp;
+        }
+      }
+      Sigma += (coefficient.C + T*coefficient.T) * sinArgument;
+    }
+
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    if (pFastResults != nullptr)
+      pFastResults[i] = MeanJD + Sigma;
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = bHighPrecision ? CAAMoonPerigeeApogee::RefineApsis(MeanJD + Sigma) : (MeanJD + Sigma);
+  }
+}
+
 double CAAMoonPerigeeApogee::TruePerigee(double k) noexcept
 {
   const double MeanJD = MeanPerigee(k);
@@ -344,3 +433,50 @@ double CAAMoonPerigeeApogee::ApogeeParallax(double k) noexcept
 
   return Parallax / 3600;
 }
+
+double CAAMoonPerigeeApogee::TruePerigee(double k, bool bHighPrecision) noexcept
+{
+  const double JD = TruePerigee(k);
+  return bHighPrecision ? RefineApsis(JD) : JD;
+}
+
+double CAAMoonPerigeeApogee::TrueApogee(double k, bool bHighPrecision) noexcept
+{
+  const double JD = TrueApogee(k);
+  return bHighPrecision ? RefineApsis(JD) : JD;
+}
+
+double CAAMoonPerigeeApogee::RefineApsis(double JD) noexcept
+{
+  //The apsis is where the rate of change of the distance is zero, so use Newton's method on the first derivative
+  //of the distance with both derivatives found from central differences. This is the vertex of the parabola
+  //through the three distances and works equally well for perigees and apogees. The seed is within a few
+  //minutes so two or three iterations are normally required, each of which costs three evaluations of the
+  //ELP2000 distance series
+  constexpr double h = AAMOONPERIGEEAPOGEE_DIFFERENCE_INTERVAL;
+  for (int i=0; i<AAMOONPERIGEEAPOGEE_MAX_ITERATIONS; i++)
+  {
+    const double Before = CAAELP2000::RadiusVector(JD - h);
+    const double Now = CAAELP2000::RadiusVector(JD);
+    const double After = CAAELP2000::RadiusVector(JD + h);
+    const double SecondDifference = After - (2 * Now) + Before;
+    if (SecondDifference == 0)
+      break;
+    const double Delta = -(h * (After - Before)) / (2 * SecondDifference);
+    JD += Delta;
+    if (fabs(Delta) < AAMOONPERIGEEAPOGEE_TOLERANCE)
+      break;
+  }
+
+  return JD;
+}
+
+void CAAMoonPerigeeApogee::TruePerigee(const double* pK, double* pResults, size_t nCount, bool bHighPrecision, double* pFastResults) noexcept
+{
+  TrueApsis(pK, pResults, nCount, g_MoonPerigeeApogeeCoefficients1, sizeof(g_MoonPerigeeApogeeCoefficients1) / sizeof(MoonPerigeeApogeeCoefficient), bHighPrecision, pFastResults);
+}
+
+void CAAMoonPerigeeApogee::TrueApogee(const double* pK, double* pResults, size_t nCount, bool bHighPrecision, double* pFastResults) noexcept
+{
+  TrueApsis(pK, pResults, nCount, g_MoonPerigeeApogeeCoefficients2, sizeof(g_MoonPerigeeApogeeCoefficients2) / sizeof(MoonPerigeeApogeeCoefficient), bHighPrecision, pFastResults);
+}
@@ -31,13 +31,186 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AAMoonPhases.h"
 #include "AACoordinateTransformation.h"
+#include "AAELP2000.h"
+#include "AASun.h"
+#include "AAEarth.h"
+#include "AAPrecession.h"
 #include <cmath>
 #include <cassert>
 using namespace std;
 
 
+//////////////////////////// Macros / Defines /////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26482)
+#endif //#ifdef _MSC_VER
+
+struct MoonPhasesCoefficient
+{
+  int M;
+  int Mdash;
+  int F;
+  int omega;
+  int E; //The power of E which multiplies the term
+  double C;
+};
+
+const MoonPhasesCoefficient g_NewMoonCoefficients[] =
+{
+  { 0,  1,  0,  0, 0, -0.40720 },
+  { 1,  0,  0,  0, 1, 0.17241  },
+  { 0,  2,  0,  0, 0, 0.01608  },
+  { 0,  0,  2,  0, 0, 0.01039  },
+  { -1, 1,  0,  0, 1, 0.00739  },
+  { 1,  1,  0,  0, 1, -0.00514 },
+  { 2,  0,  0,  0, 2, 0.00208  },
+  { 0,  1,  -2, 0, 0, -0.00111 },
+  { 0,  1,  2,  0, 0, -0.00057 },
+  { 1,  2,  0,  0, 1, 0.00056  },
+  { 0,  3,  0,  0, 0, -0.00042 },
+  { 1,  0,  2,  0, 1, 0.00042  },
+  { 1,  0,  -2, 0, 1, 0.00038  },
+  { -1, 2,  0,  0, 1, -0.00024 },
+  { 0,  0,  0,  1, 0, -0.00017 },
+  { 2,  1,  0,  0, 0, -0.00007 },
+  { 0,  2,  -2, 0, 0, 0.00004  },
+  { 3,  0,  0,  0, 0, 0.00004  },
+  { 1,  1,  -2, 0, 0, 0.00003  },
+  { 0,  2,  2,  0, 0, 0.00003  },
+  { 1,  1,  2,  0, 0, -0.00003 },
+  { -1, 1,  2,  0, 0, 0.00003  },
+  { -1, 1,  -2, 0, 0, -0.00002 },
+  { 1,  3,  0,  0, 0, -0.00002 },
+  { 0,  4,  0,  0, 0, 0.00002  }
+};
+
+const MoonPhasesCoefficient g_QuarterMoonCoefficients[] =
+{
+  { 0,  1,  0,  0, 0, -0.62801 },
+  { 1,  0,  0,  0, 1, 0.17172  },
+  { 1,  1,  0,  0, 1, -0.01183 },
+  { 0,  2,  0,  0, 0, 0.00862  },
+  { 0,  0,  2,  0, 0, 0.00804  },
+  { -1, 1,  0,  0, 1, 0.00454  },
+  { 2,  0,  0,  0, 2, 0.00204  },
+  { 0,  1,  -2, 0, 0, -0.00180 },
+  { 0,  1,  2,  0, 0, -0.00070 },
+  { 0,  3,  0,  0, 0, -0.00040 },
+  { -1, 2,  0,  0, 1, -0.00034 },
+  { 1,  0,  2,  0, 1, 0.00032  },
+  { 1,  0,  -2, 0, 1, 0.00032  },
+  { 2,  1,  0,  0, 2, -0.00028 },
+  { 1,  2,  0,  0, 1, 0.00027  },
+  { 0,  0,  0,  1, 0, -0.00017 },
+  { -1, 1,  -2, 0, 0, -0.00005 },
+  { 0,  2,  2,  0, 0, 0.00004  },
+  { 1,  1,  2,  0, 0, -0.00004 },
+  { -2, 1,  0,  0, 0, 0.00004  },
+  { 1,  1,  -2, 0, 0, 0.00003  },
+  { 3,  0,  0,  0, 0, 0.00003  },
+  { 0,  2,  -2, 0, 0, 0.00002  },
+  { -1, 1,  2,  0, 0, 0.00002  },
+  { 1,  3,  0,  0, 0, -0.00002 }
+};
+
+const MoonPhasesCoefficient g_FullMoonCoefficients[] =
+{
+  { 0,  1,  0,  0, 0, -0.40614 },
+  { 1,  0,  0,  0, 1, 0.17302  },
+  { 0,  2,  0,  0, 0, 0.01614  },
+  { 0,  0,  2,  0, 0, 0.01043  },
+  { -1, 1,  0,  0, 1, 0.00734  },
+  { 1,  1,  0,  0, 1, -0.00514 },
+  { 2,  0,  0,  0, 2, 0.00209  },
+  { 0,  1,  -2, 0, 0, -0.00111 },
+  { 0,  1,  2,  0, 0, -0.00057 },
+  { 1,  2,  0,  0, 1, 0.00056  },
+  { 0,  3,  0,  0, 0, -0.00042 },
+  { 1,  0,  2,  0, 1, 0.00042  },
+  { 1,  0,  -2, 0, 1, 0.00038  },
+  { -1, 2,  0,  0, 1, -0.00024 },
+  { 0,  0,  0,  1, 0, -0.00017 },
+  { 2,  1,  0,  0, 0, -0.00007 },
+  { 0,  2,  -2, 0, 0, 0.00004  },
+  { 3,  0,  0,  0, 0, 0.00004  },
+  { 1,  1,  -2, 0, 0, 0.00003  },
+  { 0,  2,  2,  0, 0, 0.00003  },
+  { 1,  1,  2,  0, 0, -0.00003 },
+  { -1, 1,  2,  0, 0, 0.00003  },
+  { -1, 1,  -2, 0, 0, -0.00002 },
+  { 1,  3,  0,  0, 0, -0.00002 },
+  { 0,  4,  0,  0, 0, 0.00002  }
+};
+
+struct MoonPhasesPlanetaryCoefficient
+{
+  double A; //The argument in degrees is A + k*k + T2*T^2
+  double k;
+  double T2;
+  double C;
+};
+
+const MoonPhasesPlanetaryCoefficient g_MoonPhasesPlanetaryCoefficients[] =
+{
+  { 299.77, 0.107408,  -0.009173, 0.000325 },
+  { 251.88, 0.016321,  0,         0.000165 },
+  { 251.83, 26.651886, 0,         0.000164 },
+  { 349.42, 36.412478, 0,         0.000126 },
+  { 84.66,  18.206239, 0,         0.000110 },
+  { 141.74, 53.303771, 0,         0.000062 },
+  { 207.14, 2.453732,  0,         0.000060 },
+  { 154.84, 7.306860,  0,         0.000056 },
+  { 34.52,  27.261239, 0,         0.000047 },
+  { 207.19, 0.121824,  0,         0.000042 },
+  { 291.34, 1.844379,  0,         0.000040 },
+  { 161.72, 24.198154, 0,         0.000037 },
+  { 239.56, 25.513099, 0,         0.000035 },
+  { 331.55, 3.592518,  0,         0.000023 }
+};
+
+constexpr int AAMOONPHASES_MAX_MULTIPLE = 4;
+constexpr int AAMOONPHASES_PLANETARY_ANCHOR_INTERVAL = 64;
+constexpr int AAMOONPHASES_MAX_ITERATIONS = 6;
+constexpr double AAMOONPHASES_SYNODIC_RATE = 360 / 29.530588861; //The mean rate of the elongation in degrees per day
+constexpr double AAMOONPHASES_MOON_LIGHT_TIME = 384400 / (299792.458 * 86400); //At the mean distance of the Moon, in days
+constexpr double AAMOONPHASES_TOLERANCE = 0.000001; //In days
+
+
 //////////////////////////// Implementation ///////////////////////////////////
 
+static double SumPhaseTerms(const MoonPhasesCoefficient* pCoefficients, size_t nCoefficients, const double sinMultiples[4][(2 * AAMOONPHASES_MAX_MULTIPLE) + 1],
+                            const double cosMultiples[4][(2 * AAMOONPHASES_MAX_MULTIPLE) + 1], double E) noexcept
+{
+  double DeltaJD = 0;
+  for (size_t i=0; i<nCoefficients; i++)
+  {
+    const MoonPhasesCoefficient& coefficient = pCoefficients[i];
+    const int Multiples[4] = { coefficient.M, coefficient.Mdash, coefficient.F, coefficient.omega };
+    double sinArgument = 0;
+    double cosArgument = 1;
+    for (int j=0; j<4; j++)
+    {
+      const int nMultiple = Multiples[j];
+      if (nMultiple)
+      {
+        assert(abs(nMultiple) <= AAMOONPHASES_MAX_MULTIPLE);
+        const double sinMultiple = sinMultiples[j][AAMOONPHASES_MAX_MULTIPLE + nMultiple];
+        const double cosMultiple = cosMultiples[j][AAMOONPHASES_MAX_MULTIPLE + nMultiple];
+        const double sinTemp = (sinArgument * cosMultiple) + (cosArgument * sinMultiple);
+        cosArgument = (cosArgument * cosMultiple) - (sinArgument * sinMultiple);
+        sinArgument = sinTemp;
+      }
+    }
+    double Term = coefficient.C;
+    for (int j=0; j<coefficient.E; j++)
+      Term *= E;
+    DeltaJD += (Term * sinArgument);
+  }
+
+  return DeltaJD;
+}
+
 double CAAMoonPhases::TruePhase(double k) noexcept
 {
   //What will be the return value
@@ -211,3 +384,197 @@ double CAAMoonPhases::TruePhase(double k) noexcept
 
   return JD;
 }
+
+double CAAMoonPhases::TruePhase(double k, bool bHighPrecision) noexcept
+{
+  const double JD = TruePhase(k);
+  if (!bHighPrecision)
+    return JD;
+
+  double kint = 0;
+  double kfrac = modf(k, &kint);
+  if (kfrac < 0)
+    kfrac = 1 + kfrac;
+  return RefinePhase(JD, kfrac * 360);
+}
+
+double CAAMoonPhases::RefinePhase(double JD, double Phase) noexcept
+{
+  //The Moon's latitude hardly changes over the few seconds the date moves by, so it is only computed once for the
+  //precession of the Moon's position from the J2000.0 ecliptic of ELP2000 to the ecliptic of date
+  const double MoonLatitude = CAAELP2000::EclipticLatitude(JD - AAMOONPHASES_MOON_LIGHT_TIME);
+
+  //The phase is the apparent geocentric longitude of the Moon less that of the Sun. The nutation in longitude is
+  //common to both and cancels, while the light time of the Moon and the aberration of the Sun are allowed for
+  auto Elongation = [MoonLatitude, Phase](double jd) noexcept
+  {
+    const CAA2DCoordinate Moon = CAAPrecession::PrecessEcliptic(CAAELP2000::EclipticLongitude(jd - AAMOONPHASES_MOON_LIGHT_TIME), MoonLatitude, 2451545, jd);
+    const double SunLongitude = CAASun::GeometricEclipticLongitude(jd, true) - (20.4898 / (3600 * CAAEarth::RadiusVector(jd, true)));
+    return remainder(Moon.X - SunLongitude - Phase, 360);
+  };
+
+  //Use a secant iteration, starting with the mean rate of the elongation as the derivative. Since the rate
+  //changes slowly, this converges to a small fraction of a second in three or four evaluations
+  double JD0 = JD;
+  double f0 = Elongation(JD0);
+  double JD1 = JD0 - (f0 / AAMOONPHASES_SYNODIC_RATE);
+  for (int i=0; i<AAMOONPHASES_MAX_ITERATIONS; i++)
+  {
+    if (fabs(JD1 - JD0) < AAMOONPHASES_TOLERANCE)
+      break;
+    const double f1 = Elongation(JD1);
+    if (f1 == f0)
+      break;
+    const double JD2 = JD1 - ((f1 * (JD1 - JD0)) / (f1 - f0));
+    JD0 = JD1;
+    f0 = f1;
+    JD1 = JD2;
+  }
+
+  return JD1;
+}
+
+void CAAMoonPhases::TruePhase(const double* pK, double* pResults, size_t nCount, bool bHighPrecision, double* pFastResults) noexcept
+{
+  //Validate our parameters
+  assert(pK);
+  assert(pResults);
+
+  constexpr const size_t nPlanetaryCoefficients = sizeof(g_MoonPhasesPlanetaryCoefficients) / sizeof(MoonPhasesPlanetaryCoefficient);
+  double sinPlanetary[nPlanetaryCoefficients] = {};
+  double cosPlanetary[nPlanetaryCoefficients] = {};
+  double sinPlanetaryStep[nPlanetaryCoefficients] = {};
+  double cosPlanetaryStep[nPlanetaryCoefficients] = {};
+  double Spacing = 0;
+  bool bSpacingSet = false;
+  int nStepsSinceAnchor = AAMOONPHASES_PLANETARY_ANCHOR_INTERVAL;
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double k = pK[i];
+
+    //What will be the return value
+    double JD = MeanPhase(k);
+
+    //convert from K to T
+    const double T = k/1236.85;
+    const double T2 = T*T;
+    const double T3 = T2*T;
+    const double T4 = T3*T;
+
+    const double E = 1 - 0.002516*T - 0.0000074*T2;
+
+    //The arguments of the lunar terms are all small integer combinations of M, M', F & omega, so build up the
+    //sines and cosines of their multiples using the angle addition formulae rather than calling sin for every term
+    const double Arguments[4] = { CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(2.5534 + 29.10535670*k - 0.0000014*T2 - 0.00000011*T3)),
+                                  CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(201.5643 + 385.81693528*k + 0.0107582*T2 + 0.00001238*T3 - 0.000000058*T4)),
+                                  CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(160.7108 + 390.67050284*k - 0.0016118*T2 - 0.00000227*T3 + 0.000000011*T4)),
+                                  CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(124.7746 - 1.56375588*k + 0.0020672*T2 + 0.00000215*T3)) };
+    double sinMultiples[4][(2 * AAMOONPHASES_MAX_MULTIPLE) + 1];
+    double cosMultiples[4][(2 * AAMOONPHASES_MAX_MULTIPLE) + 1];
+    for (int j=0; j<4; j++)
+    {
+      const double sinArgument = sin(Arguments[j]);
+      const double cosArgument = cos(Arguments[j]);
+      double* pSin = sinMultiples[j] + AAMOONPHASES_MAX_MULTIPLE;
+      double* pCos = cosMultiples[j] + AAMOONPHASES_MAX_MULTIPLE;
+      pSin[0] = 0;
+      pCos[0] = 1;
+      for (int m=1; m<=AAMOONPHASES_MAX_MULTIPLE; m++)
+      {
+        pSin[m] = (pSin[m - 1] * cosArgument) + (pCos[m - 1] * sinArgument);
+        pCos[m] = (pCos[m - 1] * cosArgument) - (pSin[m - 1] * sinArgument);
+        pSin[-m] = -pSin[m];
+        pCos[-m] = pCos[m];
+      }
+    }
+
+    double kint = 0;
+    double kfrac = modf(k, &kint);
+    if (kfrac < 0)
+      kfrac = 1 + kfrac;
+    if (kfrac == 0) //New Moon
+      JD += SumPhaseTerms(g_NewMoonCoefficients, sizeof(g_NewMoonCoefficients) / sizeof(MoonPhasesCoefficient), sinMultiples, cosMultiples, E);
+    else if ((kfrac == 0.25) || (kfrac == 0.75)) //First Quarter or Last Quarter
+    {
+      JD += SumPhaseTerms(g_QuarterMoonCoefficients, sizeof(g_QuarterMoonCoefficients) / sizeof(MoonPhasesCoefficient), sinMultiples, cosMultiples, E);
+
+      const double* pCosM = cosMultiples[0] + AAMOONPHASES_MAX_MULTIPLE;
+      const double* pSinM = sinMultiples[0] + AAMOONPHASES_MAX_MULTIPLE;
+      const double* pCosMdash = cosMultiples[1] + AAMOONPHASES_MAX_MULTIPLE;
+      const double* pSinMdash = sinMultiples[1] + AAMOONPHASES_MAX_MULTIPLE;
+      const double cosMdashMinusM = (pCosMdash[1] * pCosM[1]) + (pSinMdash[1] * pSinM[1]);
+      const double cosMdashPlusM = (pCosMdash[1] * pCosM[1]) - (pSinMdash[1] * pSinM[1]);
+      const double W = 0.00306 - 0.00038*E*pCosM[1] + 0.00026*pCosMdash[1] - 0.00002*cosMdashMinusM + 0.00002*cosMdashPlusM + 0.00002*cosMultiples[2][AAMOONPHASES_MAX_MULTIPLE + 2];
+      if (kfrac == 0.25) //First quarter
+        JD += W;
+      else
+        JD -= W;
+    }
+    else if (kfrac == 0.5) //Full Moon
+      JD += SumPhaseTerms(g_FullMoonCoefficients, sizeof(g_FullMoonCoefficients) / sizeof(MoonPhasesCoefficient), sinMultiples, cosMultiples, E);
+    else
+    {
+      assert(false);
+    }
+
+    //The planetary arguments other than A1 are linear in k, so for equally spaced values of k they can be advanced
+    //by a fixed rotation. They are recomputed directly every so often to bound the rounding drift. Note that the
+    //rotation must be set up from the first spacing seen, even if that is zero (i.e. a repeated value of k)
+    const double Delta = (i > 0) ? (k - pK[i - 1]) : 0;
+    if ((i == 0) || !bSpacingSet || (Delta != Spacing) || (nStepsSinceAnchor >= AAMOONPHASES_PLANETARY_ANCHOR_INTERVAL))
+    {
+      if ((i > 0) && (!bSpacingSet || (Delta != Spacing)))
+      {
+        Spacing = Delta;
+        bSpacingSet = true;
+        for (size_t j=1; j<nPlanetaryCoefficients; j++)
+        {
+          const double Step = CAACoordinateTransformation::DegreesToRadians(g_MoonPhasesPlanetaryCoefficients[j].k * Spacing);
+          sinPlanetaryStep[j] = sin(Step);
+          cosPlanetaryStep[j] = cos(Step);
+        }
+      }
+      for (size_t j=1; j<nPlanetaryCoefficients; j++)
+      {
+        const double A = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(g_MoonPhasesPlanetaryCoefficients[j].A + g_MoonPhasesPlanetaryCoefficients[j].k*k));
+        sinPlanetary[j] = sin(A);
+        cosPlanetary[j] = cos(A);
+      }
+      nStepsSinceAnchor = 0;
+    }
+    else
+    {
+      for (size_t j=1; j<nPlanetaryCoefficients; j++)
+      {
+        const double sinTemp = (sinPlanetary[j] * cosPlanetaryStep[j]) + (cosPlanetary[j] * sinPlanetaryStep[j]);
+        cosPlanetary[j] = (cosPlanetary[j] * cosPlanetaryStep[j]) - (sinPlanetary[j] * sinPlanetaryStep[j]);
+        sinPlanetary[j] = sinTemp;
+      }
+      ++nStepsSinceAnchor;
+    }
+
+    //Additional corrections for all phases
+    double DeltaJD2 = g_MoonPhasesPlanetaryCoefficients[0].C * sin(CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::MapTo0To360Range(g_MoonPhasesPlanetaryCoefficients[0].A +
+                                                                                                                                                                 g_MoonPhasesPlanetaryCoefficients[0].k*k +
+                                                                                                                                                                 g_MoonPhasesPlanetaryCoefficients[0].T2*T2)));
+    for (size_t j=1; j<nPlanetaryCoefficients; j++)
+      DeltaJD2 += (g_MoonPhasesPlanetaryCoefficients[j].C * sinPlanetary[j]);
+    JD += DeltaJD2;
+
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    if (pFastResults != nullptr)
+      pFastResults[i] = JD;
+    if (bHighPrecision)
+      JD = RefinePhase(JD, kfrac * 360);
+
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = JD;
+  }
+}
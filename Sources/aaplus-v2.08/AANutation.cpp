@@ -28,7 +28,9 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AANutation.h"
 #include "AACoordinateTransformation.h"
+#include "AAInstrumentation.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -123,6 +125,9 @@ const NutationCoefficient g_NutationCoefficients[] =
 
 double CAANutation::NutationInLongitude(double JD) noexcept
 {
+  AAPLUS_INSTRUMENT_CALL(Nutation);
+  AAPLUS_INSTRUMENT_SCOPE(Nutation);
+
   const double T = (JD - 2451545) / 36525;
   const double Tsquared = T*T;
   const double Tcubed = Tsquared*T;
@@ -143,6 +148,7 @@ double CAANutation::NutationInLongitude(double JD) noexcept
   omega = CAACoordinateTransformation::MapTo0To360Range(omega);
 
   constexpr const int nCoefficients = sizeof(g_NutationCoefficients) / sizeof(NutationCoefficient);
+  AAPLUS_INSTRUMENT_TERMS(Nutation, nCoefficients);
   double value = 0;
   for (int i=0; i<nCoefficients; i++)
   {
@@ -158,6 +164,9 @@ double CAANutation::NutationInLongitude(double JD) noexcept
 
 double CAANutation::NutationInObliquity(double JD) noexcept
 {
+  AAPLUS_INSTRUMENT_CALL(Nutation);
+  AAPLUS_INSTRUMENT_SCOPE(Nutation);
+
   const double T = (JD - 2451545) / 36525;
   const double Tsquared = T*T;
   const double Tcubed = Tsquared*T;
@@ -178,6 +187,7 @@ double CAANutation::NutationInObliquity(double JD) noexcept
   omega = CAACoordinateTransformation::MapTo0To360Range(omega);
 
   constexpr const int nCoefficients = sizeof(g_NutationCoefficients) / sizeof(NutationCoefficient);
+  AAPLUS_INSTRUMENT_TERMS(Nutation, nCoefficients);
   double value = 0;
   for (int i=0; i<nCoefficients; i++)
   {
@@ -239,3 +249,55 @@ double CAANutation::NutationInDeclination(double Alpha, double Obliquity, double
 
   return sin(Obliquity) * cos(Alpha) * NutationInLongitude + sin(Alpha)*NutationInObliquity; 
 }
+
+CAANutationStepper::CAANutationStepper(double StartJD, double StepInterval, int nAnchorInterval) : m_Longitude(36525, StepInterval, nAnchorInterval),
+                                                                                                 m_Obliquity(36525, StepInterval, nAnchorInterval)
+{
+  //The polynomials in degrees for D, M, Mprime, F & omega as used by NutationInLongitude & NutationInObliquity
+  constexpr const double Arguments[5][4] =
+  {
+    { 297.85036, 445267.111480, -0.0019142,  1.0 / 189474 },
+    { 357.52772, 35999.050340,  -0.0001603, -1.0 / 300000 },
+    { 134.96298, 477198.867398,  0.0086972,  1.0 / 56250  },
+    { 93.27191,  483202.017538, -0.0036825,  1.0 / 327270 },
+    { 125.04452, -1934.136261,   0.0020708,  1.0 / 450000 }
+  };
+
+  //The constant and T parts of the amplitudes are kept as separate blocks of the series
+  constexpr const int nCoefficients = sizeof(g_NutationCoefficients) / sizeof(NutationCoefficient);
+  for (int nPower=0; nPower<2; nPower++)
+  {
+    for (int i=0; i<nCoefficients; i++)
+    {
+      const int Multiples[5] = { g_NutationCoefficients[i].D, g_NutationCoefficients[i].M, g_NutationCoefficients[i].Mprime, g_NutationCoefficients[i].F, g_NutationCoefficients[i].omega };
+      double Phase[4] = { 0, 0, 0, 0 };
+      for (int j=0; j<5; j++)
+      {
+        for (int k=0; k<4; k++)
+          Phase[k] += (Multiples[j] * Arguments[j][k]);
+      }
+      for (int k=0; k<4; k++)
+        Phase[k] = CAACoordinateTransformation::DegreesToRadians(Phase[k]);
+      if (nPower == 0)
+      {
+        m_Longitude.AddTerm(g_NutationCoefficients[i].sincoeff1 * 0.0001, true, 0, Phase, 4);
+        m_Obliquity.AddTerm(g_NutationCoefficients[i].coscoeff1 * 0.0001, false, 0, Phase, 4);
+      }
+      else
+      {
+        //Most of the terms have no part in T, so only the ones which do are stepped
+        if (g_NutationCoefficients[i].sincoeff2 != 0)
+          m_Longitude.AddTerm(g_NutationCoefficients[i].sincoeff2 * 0.0001, true, 1, Phase, 4);
+        if (g_NutationCoefficients[i].coscoeff2 != 0)
+          m_Obliquity.AddTerm(g_NutationCoefficients[i].coscoeff2 * 0.0001, false, 1, Phase, 4);
+      }
+    }
+  }
+  m_Longitude.Anchor(StartJD);
+  m_Obliquity.Anchor(StartJD);
+}
+
+double CAANutationStepper::TrueObliquityOfEcliptic(double JD)
+{
+  return CAANutation::MeanObliquityOfEcliptic(JD) + CAACoordinateTransformation::DMSToDegrees(0, 0, NutationInObliquity(JD));
+}
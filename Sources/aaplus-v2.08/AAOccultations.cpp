@@ -0,0 +1,533 @@
+/*
+Module : AAOccultations.cpp
+Purpose: Implementation for the prediction of the occultations of the stars of a catalogue by the Moon
+Created: 18-10-2026
+History: None
+
+*/
+
+
+////////////////////// Includes ///////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AAOccultations.h"
+#include "AAAberration.h"
+#include "AAAngularSeparation.h"
+#include "AACoordinateTransformation.h"
+#include "AADynamicalTime.h"
+#include "AAELP2000.h"
+#include "AAEventFinder.h"
+#include "AAMoon.h"
+#include "AANutation.h"
+#include "AAParallax.h"
+#include "AARotation.h"
+#include "AASidereal.h"
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+using namespace std;
+
+
+////////////////////// Macros / Defines ///////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26482)
+#endif //#ifdef _MSC_VER
+
+constexpr double AAOCCULTATIONS_EARTH_RADIUS = 6378.14; //In km, as used by CAADiameters
+
+constexpr double AAOCCULTATIONS_MOON_RADIUS = 0.272481; //In equatorial radii of the Earth, as used by CAADiameters
+
+constexpr double AAOCCULTATIONS_AU = 149597870.691; //In km
+
+constexpr double AAOCCULTATIONS_LIGHT_TIME = 1 / (299792.458 * 86400); //The light time in days for each km
+
+constexpr double AAOCCULTATIONS_SPEED_OF_LIGHT = 17314463350.0; //In the units of CAAAberration::EarthVelocity
+
+//The Moon's limb can be displaced from its geocentric position by at most the parallax, and the topocentric
+//closest approach occurs within this many days of the geocentric one
+constexpr double AAOCCULTATIONS_WINDOW = 0.25;
+
+//An allowance in degrees for the difference between the tabulated path of the Moon and its full positions
+constexpr double AAOCCULTATIONS_SCREENING_TOLERANCE = 0.01;
+
+constexpr double AAOCCULTATIONS_BRACKET = 0.0007; //The half width in days of the initial bracket about each estimated contact
+
+constexpr double AAOCCULTATIONS_TOLERANCE = 1e-6; //The tolerance to which the contacts are refined in days
+
+
+////////////////////// Implementation /////////////////////////////////////////
+
+CAAStarIndex::CAAStarIndex(const double* pAlpha, const double* pDelta, size_t nCount, double BandWidth) : m_BandWidth(BandWidth),
+                                                                                                         m_Alpha(nCount),
+                                                                                                         m_Star(nCount),
+                                                                                                         m_X(nCount),
+                                                                                                         m_Y(nCount),
+                                                                                                         m_Z(nCount)
+{
+  //Validate our parameters
+  assert(pAlpha);
+  assert(pDelta);
+  assert(BandWidth > 0);
+
+  const size_t nBands = static_cast<size_t>(ceil(180 / BandWidth));
+  m_BandStart.assign(nBands + 1, 0);
+
+  //Form the unit vectors and count the stars in each band
+  vector<size_t> Bands(nCount);
+  vector<double> Alphas(nCount);
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    Alphas[i] = CAACoordinateTransformation::HoursToRadians(CAACoordinateTransformation::MapTo0To24Range(pAlpha[i]));
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double Delta = CAACoordinateTransformation::DegreesToRadians(pDelta[i]);
+    m_X[i] = cos(Delta) * cos(Alphas[i]);
+    m_Y[i] = cos(Delta) * sin(Alphas[i]);
+    m_Z[i] = sin(Delta);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    Bands[i] = min(nBands - 1, static_cast<size_t>(max(0.0, floor((pDelta[i] + 90) / BandWidth))));
+    ++m_BandStart[Bands[i] + 1];
+  }
+
+  //Then distribute the stars into their bands and sort each band by right ascension
+  for (size_t i=0; i<nBands; i++)
+    m_BandStart[i + 1] += m_BandStart[i];
+  vector<size_t> Next(m_BandStart.begin(), m_BandStart.end() - 1);
+  for (size_t i=0; i<nCount; i++)
+    m_Star[Next[Bands[i]]++] = i;
+  for (size_t i=0; i<nBands; i++)
+    sort(m_Star.begin() + m_BandStart[i], m_Star.begin() + m_BandStart[i + 1], [&Alphas](size_t a, size_t b) noexcept { return Alphas[a] < Alphas[b]; });
+  for (size_t i=0; i<nCount; i++)
+    m_Alpha[i] = Alphas[m_Star[i]];
+}
+
+CAA3DCoordinate CAAStarIndex::UnitVector(size_t nStar) const noexcept
+{
+  //Validate our parameters
+  assert(nStar < m_X.size());
+
+  CAA3DCoordinate value;
+  value.X = m_X[nStar];
+  value.Y = m_Y[nStar];
+  value.Z = m_Z[nStar];
+  return value;
+}
+
+void CAAStarIndex::Query(double Alpha, double Delta, double Radius, vector<size_t>& Stars) const
+{
+  Alpha = CAACoordinateTransformation::HoursToRadians(Alpha);
+  Delta = CAACoordinateTransformation::DegreesToRadians(Delta);
+  CAA3DCoordinate value;
+  value.X = cos(Delta) * cos(Alpha);
+  value.Y = cos(Delta) * sin(Alpha);
+  value.Z = sin(Delta);
+  Query(value, Radius, Stars);
+}
+
+void CAAStarIndex::Query(const CAA3DCoordinate& UnitVector, double Radius, vector<size_t>& Stars) const
+{
+  if (m_Star.empty())
+    return;
+  const size_t nBands = m_BandStart.size() - 1;
+
+  double Alpha = atan2(UnitVector.Y, UnitVector.X);
+  if (Alpha < 0)
+    Alpha += 2 * CAACoordinateTransformation::PI();
+  const double Delta = CAACoordinateTransformation::RadiansToDegrees(asin(max(-1.0, min(1.0, UnitVector.Z))));
+  const double cosRadius = cos(CAACoordinateTransformation::DegreesToRadians(Radius));
+
+  //The half width in right ascension of the circle about the point, unless the circle includes a pole
+  double HalfWidth = CAACoordinateTransformation::PI();
+  if ((fabs(Delta) + Radius) < 90)
+    HalfWidth = asin(min(1.0, sin(CAACoordinateTransformation::DegreesToRadians(Radius)) / cos(CAACoordinateTransformation::DegreesToRadians(Delta))));
+
+  const size_t nFirstBand = min(nBands - 1, static_cast<size_t>(max(0.0, floor((Delta - Radius + 90) / m_BandWidth))));
+  const size_t nLastBand = min(nBands - 1, static_cast<size_t>(max(0.0, floor((Delta + Radius + 90) / m_BandWidth))));
+  for (size_t i=nFirstBand; i<=nLastBand; i++)
+  {
+    const auto Begin = m_Alpha.begin() + m_BandStart[i];
+    const auto End = m_Alpha.begin() + m_BandStart[i + 1];
+
+    //Test the stars in the range of right ascension, which is split in two when it wraps around zero
+    auto Test = [&](double From, double To)
+    {
+      for (auto j=lower_bound(Begin, End, From); (j != End) && (*j <= To); ++j)
+      {
+        const size_t nStar = m_Star[j - m_Alpha.begin()];
+        if (((m_X[nStar]*UnitVector.X) + (m_Y[nStar]*UnitVector.Y) + (m_Z[nStar]*UnitVector.Z)) >= cosRadius)
+          Stars.push_back(nStar);
+      }
+    };
+    if (HalfWidth >= CAACoordinateTransformation::PI())
+      Test(0, 2 * CAACoordinateTransformation::PI());
+    else
+    {
+      const double From = Alpha - HalfWidth;
+      const double To = Alpha + HalfWidth;
+      if (From < 0)
+      {
+        Test(0, To);
+        Test(From + (2 * CAACoordinateTransformation::PI()), 2 * CAACoordinateTransformation::PI());
+      }
+      else if (To >= (2 * CAACoordinateTransformation::PI()))
+      {
+        Test(From, 2 * CAACoordinateTransformation::PI());
+        Test(0, To - (2 * CAACoordinateTransformation::PI()));
+      }
+      else
+        Test(From, To);
+    }
+  }
+}
+
+//The geocentric path of the Moon tabulated at equal steps, along with the quantities which change slowly enough to
+//be taken from the nearest node
+class CAAOccultationPath
+{
+public:
+//Constructors / Destructors
+  CAAOccultationPath(double StartJD, double EndJD, double StepInterval) : m_StartJD(StartJD),
+                                                                          m_StepInterval(StepInterval),
+                                                                          m_Sidereal(CAADynamicalTime::TT2UT1(StartJD) - 1, CAADynamicalTime::TT2UT1(EndJD) + 1)
+  {
+    const size_t nNodes = static_cast<size_t>(ceil((EndJD - StartJD) / StepInterval)) + 1;
+    Alpha.resize(nNodes);
+    Delta.resize(nNodes);
+    Distance.resize(nNodes);
+    X.resize(nNodes);
+    Y.resize(nNodes);
+    Z.resize(nNodes);
+    DeltaT.resize(nNodes);
+    Frame.resize(nNodes);
+    Beta.resize(nNodes);
+    for (size_t k=0; k<nNodes; k++)
+    {
+      const double JD = StartJD + (k * StepInterval);
+      const double NutationInLongitude = CAANutation::NutationInLongitude(JD) / 3600;
+      const double Obliquity = CAANutation::TrueObliquityOfEcliptic(JD);
+      DeltaT[k] = (JD - CAADynamicalTime::TT2UT1(JD));
+      Frame[k] = CAARotationMatrix::Nutation(JD) * CAARotationMatrix::Precession(2451545, JD);
+      Beta[k] = CAAAberration::EarthVelocity(JD, false);
+      Beta[k].X /= AAOCCULTATIONS_SPEED_OF_LIGHT;
+      Beta[k].Y /= AAOCCULTATIONS_SPEED_OF_LIGHT;
+      Beta[k].Z /= AAOCCULTATIONS_SPEED_OF_LIGHT;
+
+      //The apparent position of the Moon, and its direction in the frame of J2000.0 for the sweep through the index
+      Distance[k] = CAAMoon::RadiusVector(JD);
+      const double LightTime = Distance[k] * AAOCCULTATIONS_LIGHT_TIME;
+      const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(CAAMoon::EclipticLongitude(JD - LightTime) + NutationInLongitude, CAAMoon::EclipticLatitude(JD - LightTime), Obliquity);
+      Distance[k] = CAAMoon::RadiusVector(JD - LightTime);
+      Alpha[k] = Equatorial.X;
+      Delta[k] = Equatorial.Y;
+      const double AlphaRadians = CAACoordinateTransformation::HoursToRadians(Alpha[k]);
+      const double DeltaRadians = CAACoordinateTransformation::DegreesToRadians(Delta[k]);
+      CAA3DCoordinate Moon;
+      Moon.X = cos(DeltaRadians) * cos(AlphaRadians);
+      Moon.Y = cos(DeltaRadians) * sin(AlphaRadians);
+      Moon.Z = sin(DeltaRadians);
+      Moon = Frame[k].Transpose() * Moon;
+      X[k] = Moon.X;
+      Y[k] = Moon.Y;
+      Z[k] = Moon.Z;
+    }
+  }
+
+//Methods
+  size_t Size() const noexcept
+  {
+    return Alpha.size();
+  }
+  double JD(size_t k) const noexcept
+  {
+    return m_StartJD + (k * m_StepInterval);
+  }
+  size_t Nearest(double JD) const noexcept
+  {
+    const double fNode = floor(((JD - m_StartJD) / m_StepInterval) + 0.5);
+    return static_cast<size_t>(min(static_cast<double>(Alpha.size() - 1), max(0.0, fNode)));
+  }
+  double ApparentGreenwichSiderealTime(double JD) const noexcept
+  {
+    return m_Sidereal.ApparentGreenwichSiderealTime(JD - DeltaT[Nearest(JD)]);
+  }
+
+  //Quadratic interpolation in the path of the Moon, which over a step of a few hours is accurate to well under an arcsecond
+  void Interpolate(double JD, double& AlphaValue, double& DeltaValue, double& DistanceValue) const noexcept
+  {
+    const size_t k = min(Alpha.size() - 2, max(static_cast<size_t>(1), Nearest(JD)));
+    const double p = (JD - this->JD(k)) / m_StepInterval;
+    const double AlphaBefore = remainder(Alpha[k - 1] - Alpha[k], 24);
+    const double AlphaAfter = remainder(Alpha[k + 1] - Alpha[k], 24);
+    AlphaValue = Alpha[k] + (p * (AlphaAfter - AlphaBefore) / 2) + (p * p * (AlphaAfter + AlphaBefore) / 2);
+    DeltaValue = Delta[k] + (p * (Delta[k + 1] - Delta[k - 1]) / 2) + (p * p * (Delta[k + 1] - (2 * Delta[k]) + Delta[k - 1]) / 2);
+    DistanceValue = Distance[k] + (p * (Distance[k + 1] - Distance[k - 1]) / 2) + (p * p * (Distance[k + 1] - (2 * Distance[k]) + Distance[k - 1]) / 2);
+  }
+
+//Member variables
+  std::vector<double> Alpha;               //The apparent right ascension of the Moon in hours
+  std::vector<double> Delta;               //The apparent declination of the Moon in degrees
+  std::vector<double> Distance;            //The distance of the Moon in km
+  std::vector<double> X;                   //The direction of the Moon in the frame of J2000.0
+  std::vector<double> Y;
+  std::vector<double> Z;
+  std::vector<double> DeltaT;              //TT - UT1 in days
+  std::vector<CAARotationMatrix> Frame;    //The precession and nutation from J2000.0 to the true equator and equinox of date
+  std::vector<CAA3DCoordinate> Beta;       //The velocity of the Earth as a fraction of the speed of light
+
+protected:
+  double m_StartJD;
+  double m_StepInterval;
+  CAASiderealTime m_Sidereal;
+};
+
+//The topocentric semidiameter of the Moon in degrees, which is CAADiameters::TopocentricMoonSemidiameter using the
+//geocentric position constants already held by the observer
+static double TopocentricSemidiameter(double Distance, double Delta, double H, const CAAObserver& observer) noexcept
+{
+  H = CAACoordinateTransformation::HoursToRadians(H);
+  Delta = CAACoordinateTransformation::DegreesToRadians(Delta);
+  const double sinpi = AAOCCULTATIONS_EARTH_RADIUS / Distance;
+  const double A = cos(Delta)*sin(H);
+  const double B = cos(Delta)*cos(H) - observer.RhoCosThetaPrime*sinpi;
+  const double C = sin(Delta) - observer.RhoSinThetaPrime*sinpi;
+  const double q = sqrt(A*A + B*B + C*C);
+  return CAACoordinateTransformation::RadiansToDegrees(asin(AAOCCULTATIONS_MOON_RADIUS*sinpi/q));
+}
+
+//Which side of the plane through the origin perpendicular to the path at interior node k a direction lies, positive
+//being the side which the Moon is moving towards
+static double NodeSide(const CAAOccultationPath& path, size_t k, const CAA3DCoordinate& Direction) noexcept
+{
+  return (Direction.X*(path.X[k + 1] - path.X[k - 1])) + (Direction.Y*(path.Y[k + 1] - path.Y[k - 1])) + (Direction.Z*(path.Z[k + 1] - path.Z[k - 1]));
+}
+
+vector<CAAOccultationDetails> CAAOccultations::Calculate(double StartJD, double EndJD, const CAAStarIndex& stars, const vector<CAAObserver>& observers, bool bHighPrecision, double StepInterval)
+{
+  //Validate our parameters
+  assert(StepInterval > 0);
+
+  //What will be the return value
+  vector<CAAOccultationDetails> events;
+
+  if ((EndJD <= StartJD) || (stars.Size() == 0) || observers.empty())
+    return events;
+
+  //Tabulate the path of the Moon, extending it so that the closest approaches just outside the range are still found
+  const double Padding = AAOCCULTATIONS_WINDOW + (2 * StepInterval);
+  const CAAOccultationPath path(StartJD - Padding, EndJD + Padding, StepInterval);
+  const size_t nNodes = path.Size();
+
+  vector<size_t> Candidates;
+  for (size_t k=0; (k + 1)<nNodes; k++)
+  {
+    //Find the stars near this step of the path. Any star which can be occulted from the Earth is within the
+    //parallax plus the semidiameter of the Moon of its geocentric position
+    const double dX = path.X[k + 1] - path.X[k];
+    const double dY = path.Y[k + 1] - path.Y[k];
+    const double dZ = path.Z[k + 1] - path.Z[k];
+    const double Chord2 = (dX*dX) + (dY*dY) + (dZ*dZ);
+    const double MinimumDistance = min(path.Distance[k], path.Distance[k + 1]);
+    const double Reach = CAACoordinateTransformation::RadiansToDegrees(asin(AAOCCULTATIONS_EARTH_RADIUS / MinimumDistance) + asin(AAOCCULTATIONS_MOON_RADIUS * AAOCCULTATIONS_EARTH_RADIUS / MinimumDistance)) + AAOCCULTATIONS_SCREENING_TOLERANCE;
+    CAA3DCoordinate Middle;
+    Middle.X = path.X[k] + (dX / 2);
+    Middle.Y = path.Y[k] + (dY / 2);
+    Middle.Z = path.Z[k] + (dZ / 2);
+    const double MiddleLength = sqrt((Middle.X*Middle.X) + (Middle.Y*Middle.Y) + (Middle.Z*Middle.Z));
+    Middle.X /= MiddleLength;
+    Middle.Y /= MiddleLength;
+    Middle.Z /= MiddleLength;
+    Candidates.clear();
+    stars.Query(Middle, CAACoordinateTransformation::RadiansToDegrees(asin(min(1.0, sqrt(Chord2) / 2))) + Reach, Candidates);
+
+    for (const auto nStar : Candidates)
+    {
+      //Only handle the star in the step of the path which contains its geocentric closest approach. The steps are
+      //divided at each node by the plane through the origin which is perpendicular to the path there, so that every
+      //star belongs to exactly one step. Projecting the star onto the chord instead would give ranges which overlap
+      //for stars off the path, and the same contacts would then be found from both of the adjacent steps
+      const CAA3DCoordinate Star = stars.UnitVector(nStar);
+      if ((k != 0) && (NodeSide(path, k, Star) <= 0))
+        continue;
+      if (((k + 2) != nNodes) && (NodeSide(path, k + 1, Star) > 0))
+        continue;
+      const double Fraction = (((Star.X - path.X[k])*dX) + ((Star.Y - path.Y[k])*dY) + ((Star.Z - path.Z[k])*dZ)) / Chord2;
+      const double ClampedFraction = max(0.0, min(1.0, Fraction));
+      const double ClosestX = path.X[k] + (ClampedFraction * dX);
+      const double ClosestY = path.Y[k] + (ClampedFraction * dY);
+      const double ClosestZ = path.Z[k] + (ClampedFraction * dZ);
+      const double ClosestLength = sqrt((ClosestX*ClosestX) + (ClosestY*ClosestY) + (ClosestZ*ClosestZ));
+      const double cosSeparation = ((ClosestX*Star.X) + (ClosestY*Star.Y) + (ClosestZ*Star.Z)) / ClosestLength;
+      if (CAACoordinateTransformation::RadiansToDegrees(acos(min(1.0, cosSeparation))) > Reach)
+        continue;
+      const double JD0 = path.JD(k) + (ClampedFraction * StepInterval);
+      if ((JD0 < (StartJD - AAOCCULTATIONS_WINDOW)) || (JD0 > (EndJD + AAOCCULTATIONS_WINDOW)))
+        continue;
+
+      //The apparent place of the star for the true equator and equinox of date, using the first order aberration
+      //and the frame of the nearest node, neither of which change appreciably over the occultation
+      const size_t nNode = path.Nearest(JD0);
+      const CAA3DCoordinate& Beta = path.Beta[nNode];
+      const double Dot = (Star.X*Beta.X) + (Star.Y*Beta.Y) + (Star.Z*Beta.Z);
+      CAA3DCoordinate Apparent;
+      Apparent.X = Star.X + Beta.X - (Dot*Star.X);
+      Apparent.Y = Star.Y + Beta.Y - (Dot*Star.Y);
+      Apparent.Z = Star.Z + Beta.Z - (Dot*Star.Z);
+      Apparent = path.Frame[nNode] * Apparent;
+      const double StarAlpha = CAACoordinateTransformation::MapTo0To24Range(CAACoordinateTransformation::RadiansToHours(atan2(Apparent.Y, Apparent.X)));
+      const double StarDelta = CAACoordinateTransformation::RadiansToDegrees(atan2(Apparent.Z, sqrt((Apparent.X*Apparent.X) + (Apparent.Y*Apparent.Y))));
+      const double cosStarDelta = cos(CAACoordinateTransformation::DegreesToRadians(StarDelta));
+
+      //The constants for the full position of the Moon
+      const CAARotationMatrix EclipticFrame = path.Frame[nNode] * CAARotationMatrix::EclipticToEquatorialJ2000();
+      const double LightTime = path.Distance[nNode] * AAOCCULTATIONS_LIGHT_TIME;
+
+      for (size_t nObserver=0; nObserver<observers.size(); nObserver++)
+      {
+        const CAAObserver& observer = observers[nObserver];
+
+        //The position of the topocentric Moon relative to the star in the tangent plane in degrees, from the
+        //interpolated path of the Moon
+        auto Offset = [&path, &observer, StarAlpha, StarDelta, cosStarDelta](double JD, double& OffsetX, double& OffsetY, double& Semidiameter) noexcept
+        {
+          double Alpha = 0;
+          double Delta = 0;
+          double Distance = 0;
+          path.Interpolate(JD, Alpha, Delta, Distance);
+          const CAATopocentricEpoch epoch(JD, path.ApparentGreenwichSiderealTime(JD));
+          const CAA2DCoordinate Topocentric = CAAParallax::Equatorial2Topocentric(Alpha, Delta, Distance / AAOCCULTATIONS_AU, observer, epoch);
+          OffsetX = remainder(Topocentric.X - StarAlpha, 24) * 15 * cosStarDelta;
+          OffsetY = Topocentric.Y - StarDelta;
+          Semidiameter = TopocentricSemidiameter(Distance, Delta, epoch.ApparentGreenwichSiderealTime - (observer.Longitude / 15) - Alpha, observer);
+        };
+
+        //Find the topocentric closest approach, treating the relative motion as linear over each iteration
+        double JD = JD0;
+        double OffsetX = 0;
+        double OffsetY = 0;
+        double Semidiameter = 0;
+        double Speed2 = 0;
+        bool bConverged = false;
+        for (int i=0; (i<8) && !bConverged; i++)
+        {
+          double OffsetX2 = 0;
+          double OffsetY2 = 0;
+          double Semidiameter2 = 0;
+          constexpr double h = 1.0 / 1440;
+          Offset(JD, OffsetX, OffsetY, Semidiameter);
+          Offset(JD + h, OffsetX2, OffsetY2, Semidiameter2);
+          const double VelocityX = (OffsetX2 - OffsetX) / h;
+          const double VelocityY = (OffsetY2 - OffsetY) / h;
+          Speed2 = (VelocityX*VelocityX) + (VelocityY*VelocityY);
+          const double Delta = max(-0.1, min(0.1, -((OffsetX*VelocityX) + (OffsetY*VelocityY)) / Speed2));
+          JD += Delta;
+          bConverged = (fabs(Delta) < 1e-5);
+        }
+        Offset(JD, OffsetX, OffsetY, Semidiameter);
+        const double ClosestApproach = sqrt((OffsetX*OffsetX) + (OffsetY*OffsetY));
+        if ((ClosestApproach > (Semidiameter + AAOCCULTATIONS_SCREENING_TOLERANCE)) || (fabs(JD - JD0) > AAOCCULTATIONS_WINDOW))
+          continue;
+
+        //The topocentric separation of the star from the limb of the Moon, which is negative while the star is
+        //occulted. For high precision the full position of the Moon from ELP2000 is used, otherwise the tabulated
+        //path is used directly since its interpolation error is far below that of the truncated theory
+        auto Limb = [&path, &observer, &EclipticFrame, StarAlpha, StarDelta, LightTime, bHighPrecision](double jd, CAA2DCoordinate* pTopocentric, double* pLocalHourAngle) noexcept
+        {
+          double Alpha = 0;
+          double Delta = 0;
+          double Distance = 0;
+          if (bHighPrecision)
+          {
+            const CAA3DCoordinate Moon = EclipticFrame * CAAELP2000::EclipticRectangularCoordinatesJ2000(jd - LightTime);
+            Distance = sqrt((Moon.X*Moon.X) + (Moon.Y*Moon.Y) + (Moon.Z*Moon.Z));
+            Alpha = CAACoordinateTransformation::MapTo0To24Range(CAACoordinateTransformation::RadiansToHours(atan2(Moon.Y, Moon.X)));
+            Delta = CAACoordinateTransformation::RadiansToDegrees(asin(Moon.Z / Distance));
+          }
+          else
+            path.Interpolate(jd, Alpha, Delta, Distance);
+          const CAATopocentricEpoch epoch(jd, path.ApparentGreenwichSiderealTime(jd));
+          const CAA2DCoordinate Topocentric = CAAParallax::Equatorial2Topocentric(Alpha, Delta, Distance / AAOCCULTATIONS_AU, observer, epoch);
+          if (pTopocentric)
+            *pTopocentric = Topocentric;
+          if (pLocalHourAngle)
+            *pLocalHourAngle = epoch.ApparentGreenwichSiderealTime - (observer.Longitude / 15) - Topocentric.X;
+          return CAAAngularSeparation::Separation(Topocentric.X, Topocentric.Y, StarAlpha, StarDelta) - TopocentricSemidiameter(Distance, Delta, epoch.ApparentGreenwichSiderealTime - (observer.Longitude / 15) - Alpha, observer);
+        };
+        auto LimbFunction = [&Limb](double jd) noexcept { return Limb(jd, nullptr, nullptr); };
+
+        //Make sure the star is occulted at the closest approach of the full positions
+        double Middle = JD;
+        double MiddleValue = LimbFunction(Middle);
+        if (MiddleValue >= 0)
+        {
+          const double Before = LimbFunction(Middle - AAOCCULTATIONS_BRACKET);
+          const double After = LimbFunction(Middle + AAOCCULTATIONS_BRACKET);
+          if ((MiddleValue >= Before) || (MiddleValue >= After))
+            continue;
+          Middle = CAAEventFinder::Extremum(LimbFunction, Middle - AAOCCULTATIONS_BRACKET, Middle, Middle + AAOCCULTATIONS_BRACKET, MiddleValue, false, MiddleValue, AAOCCULTATIONS_TOLERANCE);
+          if (MiddleValue >= 0)
+            continue;
+        }
+
+        //Then refine each contact from the estimate given by the chord of the linear motion
+        const double HalfDuration = sqrt(max(0.0, (Semidiameter*Semidiameter) - (ClosestApproach*ClosestApproach)) / Speed2);
+        for (int nContact=0; nContact<2; nContact++)
+        {
+          const bool bDisappearance = (nContact == 0);
+          const double Direction = bDisappearance ? -1 : 1;
+          double Inside = Middle;
+          double InsideValue = MiddleValue;
+          const double Estimate = Middle + (Direction * HalfDuration);
+          if (fabs(Estimate - Middle) > AAOCCULTATIONS_BRACKET)
+          {
+            const double Value = LimbFunction(Estimate - (Direction * AAOCCULTATIONS_BRACKET));
+            if (Value < 0)
+            {
+              Inside = Estimate - (Direction * AAOCCULTATIONS_BRACKET);
+              InsideValue = Value;
+            }
+          }
+          double Outside = Estimate + (Direction * AAOCCULTATIONS_BRACKET);
+          double OutsideValue = LimbFunction(Outside);
+          for (int i=0; (i<6) && (OutsideValue < 0); i++)
+          {
+            Inside = Outside;
+            InsideValue = OutsideValue;
+            Outside += (Direction * AAOCCULTATIONS_BRACKET * 4);
+            OutsideValue = LimbFunction(Outside);
+          }
+          if (OutsideValue < 0)
+            continue;
+
+          CAAOccultationDetails event;
+          event.type = bDisappearance ? CAAOccultationDetails::Type::Disappearance : CAAOccultationDetails::Type::Reappearance;
+          event.JD = bDisappearance ? CAAEventFinder::Root(LimbFunction, Outside, Inside, OutsideValue, InsideValue, AAOCCULTATIONS_TOLERANCE) :
+                                      CAAEventFinder::Root(LimbFunction, Inside, Outside, InsideValue, OutsideValue, AAOCCULTATIONS_TOLERANCE);
+          if ((event.JD < StartJD) || (event.JD >= EndJD))
+            continue;
+          event.Star = nStar;
+          event.Observer = nObserver;
+          CAA2DCoordinate Topocentric;
+          double LocalHourAngle = 0;
+          Limb(event.JD, &Topocentric, &LocalHourAngle);
+          const double DeltaAlpha = CAACoordinateTransformation::HoursToRadians(StarAlpha - Topocentric.X);
+          const double MoonDelta = CAACoordinateTransformation::DegreesToRadians(Topocentric.Y);
+          event.PositionAngle = CAACoordinateTransformation::MapTo0To360Range(CAACoordinateTransformation::RadiansToDegrees(atan2(sin(DeltaAlpha), (cos(MoonDelta) * tan(CAACoordinateTransformation::DegreesToRadians(StarDelta))) - (sin(MoonDelta) * cos(DeltaAlpha)))));
+          event.MoonAltitude = CAACoordinateTransformation::Equatorial2Horizontal(LocalHourAngle, Topocentric.Y, observer.Latitude).Y;
+          events.push_back(event);
+        }
+      }
+    }
+  }
+
+  //Put the events into time order
+  stable_sort(events.begin(), events.end(), [](const CAAOccultationDetails& a, const CAAOccultationDetails& b) noexcept { return a.JD < b.JD; });
+
+  return events;
+}
@@ -30,6 +30,7 @@ to maintain a single distribution point for the source code.
 #include "AACoordinateTransformation.h"
 #include "AASidereal.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -51,13 +52,23 @@ double CAAParallax::ParallaxToDistance(double Parallax) noexcept
   return g_AAParallax_C1 / sin(CAACoordinateTransformation::DegreesToRadians(Parallax));
 }
 
+CAATopocentricEpoch::CAATopocentricEpoch(double jd) noexcept : JD(jd),
+                                                               ApparentGreenwichSiderealTime(CAASidereal::ApparentGreenwichSiderealTime(jd))
+{
+}
+
 CAA2DCoordinate CAAParallax::Equatorial2TopocentricDelta(double Alpha, double Delta, double Distance, double Longitude, double Latitude, double Height, double JD) noexcept
 {
-  const double RhoSinThetaPrime = CAAGlobe::RhoSinThetaPrime(Latitude, Height);
-  const double RhoCosThetaPrime = CAAGlobe::RhoCosThetaPrime(Latitude, Height);
+  return Equatorial2TopocentricDelta(Alpha, Delta, Distance, CAAObserver(Longitude, Latitude, Height), CAATopocentricEpoch(JD));
+}
+
+CAA2DCoordinate CAAParallax::Equatorial2TopocentricDelta(double Alpha, double Delta, double Distance, const CAAObserver& observer, const CAATopocentricEpoch& epoch) noexcept
+{
+  const double RhoSinThetaPrime = observer.RhoSinThetaPrime;
+  const double RhoCosThetaPrime = observer.RhoCosThetaPrime;
 
   //Calculate the Sidereal time
-  const double theta = CAASidereal::ApparentGreenwichSiderealTime(JD);
+  const double theta = epoch.ApparentGreenwichSiderealTime;
 
   //Convert to radians
   Delta = CAACoordinateTransformation::DegreesToRadians(Delta);
@@ -67,7 +78,7 @@ CAA2DCoordinate CAAParallax::Equatorial2TopocentricDelta(double Alpha, double De
   const double pi = asin(g_AAParallax_C1 / Distance);
 
   //Calculate the hour angle
-  const double H = CAACoordinateTransformation::HoursToRadians(theta - Longitude/15 - Alpha);
+  const double H = CAACoordinateTransformation::HoursToRadians(theta - observer.Longitude/15 - Alpha);
   const double cosH = cos(H);
   const double sinH = sin(H);
 
@@ -79,33 +90,76 @@ CAA2DCoordinate CAAParallax::Equatorial2TopocentricDelta(double Alpha, double De
 
 CAA2DCoordinate CAAParallax::Equatorial2Topocentric(double Alpha, double Delta, double Distance, double Longitude, double Latitude, double Height, double JD) noexcept
 {
-  const double RhoSinThetaPrime = CAAGlobe::RhoSinThetaPrime(Latitude, Height);
-  const double RhoCosThetaPrime = CAAGlobe::RhoCosThetaPrime(Latitude, Height);
+  return Equatorial2Topocentric(Alpha, Delta, Distance, CAAObserver(Longitude, Latitude, Height), CAATopocentricEpoch(JD));
+}
+
+CAA2DCoordinate CAAParallax::Equatorial2Topocentric(double Alpha, double Delta, double Distance, const CAAObserver& observer, const CAATopocentricEpoch& epoch) noexcept
+{
+  CAA2DCoordinate Topocentric;
+  Equatorial2Topocentric(Alpha, Delta, Distance, &observer, epoch, &Topocentric, 1);
+  return Topocentric;
+}
+
+void CAAParallax::Equatorial2Topocentric(double Alpha, double Delta, double Distance, const CAAObserver* pObservers, const CAATopocentricEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pObservers);
+  assert(pResults);
 
   //Calculate the Sidereal time
-  const double theta = CAASidereal::ApparentGreenwichSiderealTime(JD);
+  const double theta = epoch.ApparentGreenwichSiderealTime;
 
   //Convert to radians
-  Delta = CAACoordinateTransformation::DegreesToRadians(Delta);
-  const double cosDelta = cos(Delta);
+  const double DeltaRadians = CAACoordinateTransformation::DegreesToRadians(Delta);
+  const double cosDelta = cos(DeltaRadians);
+  const double sinDelta = sin(DeltaRadians);
 
   //Calculate the Parallax
   const double pi = asin(g_AAParallax_C1 / Distance);
   const double sinpi = sin(pi);
 
-  //Calculate the hour angle
-  const double H = CAACoordinateTransformation::HoursToRadians(theta - Longitude/15 - Alpha);
-  const double cosH = cos(H);
-  const double sinH = sin(H);
-
-  //Calculate the adjustment in right ascension
-  const double DeltaAlpha = atan2(-RhoCosThetaPrime*sinpi*sinH, cosDelta - RhoCosThetaPrime*sinpi*cosH);
-
-  CAA2DCoordinate Topocentric;
-  Topocentric.X = CAACoordinateTransformation::MapTo0To24Range(Alpha + CAACoordinateTransformation::RadiansToHours(DeltaAlpha));
-  Topocentric.Y = CAACoordinateTransformation::RadiansToDegrees(atan2((sin(Delta) - RhoSinThetaPrime*sinpi) * cos(DeltaAlpha), cosDelta - RhoCosThetaPrime*sinpi*cosH));
+  //Only the hour angle and the geocentric coordinates of the observer vary from one observer to the next
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const CAAObserver& observer = pObservers[i];
+    const double RhoSinThetaPrime = observer.RhoSinThetaPrime;
+    const double RhoCosThetaPrime = observer.RhoCosThetaPrime;
+
+    //Calculate the hour angle
+    const double H = CAACoordinateTransformation::HoursToRadians(theta - observer.Longitude/15 - Alpha);
+    const double cosH = cos(H);
+    const double sinH = sin(H);
+
+    //Calculate the adjustment in right ascension
+    const double DeltaAlpha = atan2(-RhoCosThetaPrime*sinpi*sinH, cosDelta - RhoCosThetaPrime*sinpi*cosH);
+
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    CAA2DCoordinate& Topocentric = pResults[i];
+    Topocentric.X = CAACoordinateTransformation::MapTo0To24Range(Alpha + CAACoordinateTransformation::RadiansToHours(DeltaAlpha));
+    Topocentric.Y = CAACoordinateTransformation::RadiansToDegrees(atan2((sinDelta - RhoSinThetaPrime*sinpi) * cos(DeltaAlpha), cosDelta - RhoCosThetaPrime*sinpi*cosH));
+  }
+}
 
-  return Topocentric;
+void CAAParallax::Equatorial2Topocentric(const double* pAlpha, const double* pDelta, const double* pDistance, const CAAObserver& observer, const CAATopocentricEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pAlpha);
+  assert(pDelta);
+  assert(pDistance);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    Equatorial2Topocentric(pAlpha[i], pDelta[i], pDistance[i], &observer, epoch, pResults + i, 1);
+  }
 }
 
 CAATopocentricEclipticDetails CAAParallax::Ecliptic2Topocentric(double Lambda, double Beta, double Semidiameter, double Distance, double Epsilon, double Latitude, double Height, double JD) noexcept
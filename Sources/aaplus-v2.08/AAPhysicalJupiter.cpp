@@ -31,6 +31,7 @@ to maintain a single distribution point for the source code.
 #include "AANutation.h"
 #include "AACoordinateTransformation.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -38,6 +39,14 @@ using namespace std;
 
 CAAPhysicalJupiterDetails CAAPhysicalJupiter::Calculate(double JD, bool bHighPrecision) noexcept
 {
+  return Calculate(CAAEarthEpoch(JD, bHighPrecision));
+}
+
+CAAPhysicalJupiterDetails CAAPhysicalJupiter::Calculate(const CAAEarthEpoch& epoch) noexcept
+{
+  const double JD = epoch.JD;
+  const bool bHighPrecision = epoch.bHighPrecision;
+
   //What will be the return value
   CAAPhysicalJupiterDetails details;
 
@@ -54,11 +63,11 @@ CAAPhysicalJupiterDetails CAAPhysicalJupiter::Calculate(double JD, bool bHighPre
   const double W2 = CAACoordinateTransformation::MapTo0To360Range(16.838 + 870.27003539*d);
 
   //Step 3
-  const double l0 = CAAEarth::EclipticLongitude(JD, bHighPrecision);
+  const double l0 = epoch.EclipticLongitude;
   const double l0rad = CAACoordinateTransformation::DegreesToRadians(l0);
-  const double b0 = CAAEarth::EclipticLatitude(JD, bHighPrecision);
+  const double b0 = epoch.EclipticLatitude;
   const double b0rad = CAACoordinateTransformation::DegreesToRadians(b0);
-  const double R = CAAEarth::RadiusVector(JD, bHighPrecision);
+  const double R = epoch.RadiusVector;
 
   //Step 4
   double l = CAAJupiter::EclipticLongitude(JD, bHighPrecision);
@@ -84,7 +93,7 @@ CAAPhysicalJupiterDetails CAAPhysicalJupiter::Calculate(double JD, bool bHighPre
   DELTA = sqrt(x*x + y*y + z*z);
 
   //Step 8
-  double e0 = CAANutation::MeanObliquityOfEcliptic(JD);
+  double e0 = epoch.MeanObliquity;
   double e0rad = CAACoordinateTransformation::DegreesToRadians(e0);
 
   //Step 9
@@ -124,8 +133,8 @@ CAAPhysicalJupiterDetails CAAPhysicalJupiter::Calculate(double JD, bool bHighPre
   }
 
   //Step 15
-  const double NutationInLongitude = CAANutation::NutationInLongitude(JD);
-  const double NutationInObliquity = CAANutation::NutationInObliquity(JD);
+  const double NutationInLongitude = epoch.NutationInLongitude;
+  const double NutationInObliquity = epoch.NutationInObliquity;
   e0 += NutationInObliquity/3600;
   e0rad = CAACoordinateTransformation::DegreesToRadians(e0);
 
@@ -154,3 +163,33 @@ CAAPhysicalJupiterDetails CAAPhysicalJupiter::Calculate(double JD, bool bHighPre
 
   return details;
 }
+
+void CAAPhysicalJupiter::Calculate(const double* pJD, CAAPhysicalJupiterDetails* pResults, size_t nCount, bool bHighPrecision) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Calculate(CAAEarthEpoch(pJD[i], bHighPrecision));
+  }
+}
+
+void CAAPhysicalJupiter::Calculate(const CAAEarthEpoch* pEpochs, CAAPhysicalJupiterDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pEpochs);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Calculate(pEpochs[i]);
+  }
+}
@@ -28,20 +28,23 @@ to maintain a single distribution point for the source code.
 #include "AAPhysicalMars.h"
 #include "AAMars.h"
 #include "AAEarth.h"
-#include "AASun.h"
 #include "AANutation.h"
 #include "AACoordinateTransformation.h"
 #include "AAElliptical.h"
 #include "AAMoonIlluminatedFraction.h"
 #include "AAIlluminatedFraction.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
 //////////////////////////////// Implementation ///////////////////////////////
 
-CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(double JD, bool bHighPrecision) noexcept
+static CAAPhysicalMarsDetails CalculateWithLightTime(const CAAEarthEpoch& epoch, double& LightTravelTime) noexcept
 {
+  const double JD = epoch.JD;
+  const bool bHighPrecision = epoch.bHighPrecision;
+
   //What will be the return value
   CAAPhysicalMarsDetails details;
 
@@ -53,14 +56,15 @@ CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(double JD, bool bHighPrecision
   const double Beta0rad = CAACoordinateTransformation::DegreesToRadians(Beta0);
 
   //Step 2
-  const double l0 = CAAEarth::EclipticLongitude(JD, bHighPrecision);
+  const double l0 = epoch.EclipticLongitude;
   const double l0rad = CAACoordinateTransformation::DegreesToRadians(l0);
-  const double b0 = CAAEarth::EclipticLatitude(JD, bHighPrecision);
+  const double b0 = epoch.EclipticLatitude;
   const double b0rad = CAACoordinateTransformation::DegreesToRadians(b0);
-  const double R = CAAEarth::RadiusVector(JD, bHighPrecision);
+  const double R = epoch.RadiusVector;
 
-  double PreviousLightTravelTime = 0;
-  double LightTravelTime = 0;
+  //The light travel time starts from the value passed in, which lets a batch start from the value found for the
+  //previous date rather than from zero
+  double PreviousLightTravelTime = LightTravelTime;
   double x = 0;
   double y = 0;
   double z = 0;
@@ -119,7 +123,7 @@ CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(double JD, bool bHighPrecision
   const double W = CAACoordinateTransformation::MapTo0To360Range(11.504 + 350.89200025*(JD - LightTravelTime - 2433282.5));
 
   //Step 10
-  double e0 = CAANutation::MeanObliquityOfEcliptic(JD);
+  double e0 = epoch.MeanObliquity;
   const double e0rad = CAACoordinateTransformation::DegreesToRadians(e0);
   const CAA2DCoordinate PoleEquatorial = CAACoordinateTransformation::Ecliptic2Equatorial(Lambda0, Beta0, e0);
   const double alpha0rad = CAACoordinateTransformation::HoursToRadians(PoleEquatorial.X);
@@ -138,8 +142,8 @@ CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(double JD, bool bHighPrecision
   details.w = CAACoordinateTransformation::MapTo0To360Range(W - CAACoordinateTransformation::RadiansToDegrees(xi));
 
   //Step 13
-  const double NutationInLongitude = CAANutation::NutationInLongitude(JD);
-  const double NutationInObliquity = CAANutation::NutationInObliquity(JD);
+  const double NutationInLongitude = epoch.NutationInLongitude;
+  const double NutationInObliquity = epoch.NutationInObliquity;
 
   //Step 14
   lambda += 0.005693*cos(l0rad - lambdarad)/cos(betarad);
@@ -162,8 +166,8 @@ CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(double JD, bool bHighPrecision
   details.P = CAACoordinateTransformation::MapTo0To360Range(CAACoordinateTransformation::RadiansToDegrees(atan2(cos(delta0dash)*sin(alpha0dash - alphadash), sin(delta0dash)*cos(deltadash) - cos(delta0dash)*sin(deltadash)*cos(alpha0dash - alphadash))));
 
   //Step 18
-  const double SunLambda = CAASun::GeometricEclipticLongitude(JD, bHighPrecision);
-  const double SunBeta = CAASun::GeometricEclipticLatitude(JD, bHighPrecision);
+  const double SunLambda = CAACoordinateTransformation::MapTo0To360Range(l0 + 180);
+  const double SunBeta = -b0;
   const CAA2DCoordinate SunEquatorial = CAACoordinateTransformation::Ecliptic2Equatorial(SunLambda, SunBeta, e0);
   details.X = CAAMoonIlluminatedFraction::PositionAngle(SunEquatorial.X, SunEquatorial.Y, alpha, delta);
 
@@ -174,3 +178,49 @@ CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(double JD, bool bHighPrecision
 
   return details;
 }
+
+CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(double JD, bool bHighPrecision) noexcept
+{
+  return Calculate(CAAEarthEpoch(JD, bHighPrecision));
+}
+
+CAAPhysicalMarsDetails CAAPhysicalMars::Calculate(const CAAEarthEpoch& epoch) noexcept
+{
+  double LightTravelTime = 0;
+  return CalculateWithLightTime(epoch, LightTravelTime);
+}
+
+void CAAPhysicalMars::Calculate(const double* pJD, CAAPhysicalMarsDetails* pResults, size_t nCount, bool bHighPrecision) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  //Each date needs its own Earth epoch, but the light time iteration for Mars starts from the light time found for
+  //the previous date. For closely spaced dates this is already converged, so Mars is usually only evaluated once
+  //per date rather than two or three times
+  double LightTravelTime = 0;
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = CalculateWithLightTime(CAAEarthEpoch(pJD[i], bHighPrecision), LightTravelTime);
+  }
+}
+
+void CAAPhysicalMars::Calculate(const CAAEarthEpoch* pEpochs, CAAPhysicalMarsDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pEpochs);
+  assert(pResults);
+
+  double LightTravelTime = 0;
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = CalculateWithLightTime(pEpochs[i], LightTravelTime);
+  }
+}
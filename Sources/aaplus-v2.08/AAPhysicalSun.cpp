@@ -36,24 +36,21 @@ to maintain a single distribution point for the source code.
 #include "AANutation.h"
 #include "AACoordinateTransformation.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
 //////////////////////////////// Implementation ///////////////////////////////
 
-CAAPhysicalSunDetails CAAPhysicalSun::Calculate(double JD, bool bHighPrecision) noexcept
+static CAAPhysicalSunDetails CalculateFromEarth(double JD, double L, double R, double epsilon) noexcept
 {
   double theta = CAACoordinateTransformation::MapTo0To360Range((JD - 2398220) * 360 / 25.38);
   double I = 7.25;
   double K = 73.6667 + 1.3958333*(JD - 2396758)/36525;
 
   //Calculate the apparent longitude of the sun (excluding the effect of nutation)
-  const double L = CAAEarth::EclipticLongitude(JD, bHighPrecision);
-  const double R = CAAEarth::RadiusVector(JD, bHighPrecision);
   double SunLong = L + 180 - CAACoordinateTransformation::DMSToDegrees(0, 0, 20.4898 / R);
 
-  double epsilon = CAANutation::TrueObliquityOfEcliptic(JD);
-
   //Convert to radians
   epsilon = CAACoordinateTransformation::DegreesToRadians(epsilon);
   SunLong = CAACoordinateTransformation::DegreesToRadians(SunLong);
@@ -74,6 +71,46 @@ CAAPhysicalSunDetails CAAPhysicalSun::Calculate(double JD, bool bHighPrecision)
   return details;
 }
 
+CAAPhysicalSunDetails CAAPhysicalSun::Calculate(double JD, bool bHighPrecision) noexcept
+{
+  return CalculateFromEarth(JD, CAAEarth::EclipticLongitude(JD, bHighPrecision), CAAEarth::RadiusVector(JD, bHighPrecision), CAANutation::TrueObliquityOfEcliptic(JD));
+}
+
+CAAPhysicalSunDetails CAAPhysicalSun::Calculate(const CAAEarthEpoch& epoch) noexcept
+{
+  return CalculateFromEarth(epoch.JD, epoch.EclipticLongitude, epoch.RadiusVector, epoch.MeanObliquity + CAACoordinateTransformation::DMSToDegrees(0, 0, epoch.NutationInObliquity));
+}
+
+void CAAPhysicalSun::Calculate(const double* pJD, CAAPhysicalSunDetails* pResults, size_t nCount, bool bHighPrecision) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Calculate(pJD[i], bHighPrecision);
+  }
+}
+
+void CAAPhysicalSun::Calculate(const CAAEarthEpoch* pEpochs, CAAPhysicalSunDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pEpochs);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Calculate(pEpochs[i]);
+  }
+}
+
 double CAAPhysicalSun::TimeOfStartOfRotation(long C) noexcept
 {
   double JED = 2398140.2270 + 27.2752316*C;
@@ -30,6 +30,7 @@ to maintain a single distribution point for the source code.
 #include "AAPluto.h"
 #include "AACoordinateTransformation.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -309,3 +310,95 @@ double CAAPluto::RadiusVector(double JD) noexcept
 
   return R;
 }
+
+CAAPlutoDetails CAAPluto::Position(double JD) noexcept
+{
+  const double T = (JD - 2451545) / 36525;
+  const double J = CAACoordinateTransformation::DegreesToRadians(34.35 + 3034.9057*T);
+  const double S = CAACoordinateTransformation::DegreesToRadians(50.08 + 1222.1138*T);
+  const double P = CAACoordinateTransformation::DegreesToRadians(238.96 + 144.9600*T);
+
+  //The arguments are all integer combinations of J, S & P with multipliers of 0 to 3, -1 to 2 and -6 to 6
+  //respectively, so build up the sines and cosines of the multiples from those of J, S & P using the angle
+  //addition formulae rather than calling sin and cos for every term
+  constexpr int nMaxJ = 3;
+  constexpr int nMinS = -1;
+  constexpr int nMaxS = 2;
+  constexpr int nMaxP = 6;
+  double sinJ[nMaxJ + 1] = {};
+  double cosJ[nMaxJ + 1] = {};
+  double sinS[nMaxS - nMinS + 1] = {};
+  double cosS[nMaxS - nMinS + 1] = {};
+  double sinP[(2*nMaxP) + 1] = {};
+  double cosP[(2*nMaxP) + 1] = {};
+  cosJ[0] = 1;
+  sinJ[1] = sin(J);
+  cosJ[1] = cos(J);
+  for (int k=2; k<=nMaxJ; k++)
+  {
+    sinJ[k] = (sinJ[k - 1] * cosJ[1]) + (cosJ[k - 1] * sinJ[1]);
+    cosJ[k] = (cosJ[k - 1] * cosJ[1]) - (sinJ[k - 1] * sinJ[1]);
+  }
+  const double sinS1 = sin(S);
+  const double cosS1 = cos(S);
+  cosS[0 - nMinS] = 1;
+  for (int k=1; k<=nMaxS; k++)
+  {
+    sinS[k - nMinS] = (sinS[k - 1 - nMinS] * cosS1) + (cosS[k - 1 - nMinS] * sinS1);
+    cosS[k - nMinS] = (cosS[k - 1 - nMinS] * cosS1) - (sinS[k - 1 - nMinS] * sinS1);
+  }
+  for (int k=-1; k>=nMinS; k--)
+  {
+    sinS[k - nMinS] = -sinS[-k - nMinS];
+    cosS[k - nMinS] = cosS[-k - nMinS];
+  }
+  const double sinP1 = sin(P);
+  const double cosP1 = cos(P);
+  cosP[nMaxP] = 1;
+  for (int k=1; k<=nMaxP; k++)
+  {
+    sinP[nMaxP + k] = (sinP[nMaxP + k - 1] * cosP1) + (cosP[nMaxP + k - 1] * sinP1);
+    cosP[nMaxP + k] = (cosP[nMaxP + k - 1] * cosP1) - (sinP[nMaxP + k - 1] * sinP1);
+    sinP[nMaxP - k] = -sinP[nMaxP + k];
+    cosP[nMaxP - k] = cosP[nMaxP + k];
+  }
+
+  //Sum all three series together so that the sine and cosine of each argument is only formed once
+  double L = 0;
+  double B = 0;
+  double R = 0;
+  constexpr const int nPlutoCoefficients = sizeof(g_PlutoArgumentCoefficients) / sizeof(PlutoCoefficient1);
+  for (int i=0; i<nPlutoCoefficients; i++)
+  {
+    const PlutoCoefficient1& argument = g_PlutoArgumentCoefficients[i];
+    const double sinJS = (sinJ[argument.J] * cosS[argument.S - nMinS]) + (cosJ[argument.J] * sinS[argument.S - nMinS]);
+    const double cosJS = (cosJ[argument.J] * cosS[argument.S - nMinS]) - (sinJ[argument.J] * sinS[argument.S - nMinS]);
+    const double sinAlpha = (sinJS * cosP[nMaxP + argument.P]) + (cosJS * sinP[nMaxP + argument.P]);
+    const double cosAlpha = (cosJS * cosP[nMaxP + argument.P]) - (sinJS * sinP[nMaxP + argument.P]);
+    L += ((g_PlutoLongitudeCoefficients[i].A * sinAlpha) + (g_PlutoLongitudeCoefficients[i].B * cosAlpha));
+    B += ((g_PlutoLatitudeCoefficients[i].A * sinAlpha) + (g_PlutoLatitudeCoefficients[i].B * cosAlpha));
+    R += ((g_PlutoRadiusCoefficients[i].A * sinAlpha) + (g_PlutoRadiusCoefficients[i].B * cosAlpha));
+  }
+
+  CAAPlutoDetails details;
+  details.EclipticLongitude = CAACoordinateTransformation::MapTo0To360Range((L / 1000000) + (238.958116 + 144.96*T));
+  details.EclipticLatitude = CAACoordinateTransformation::MapToMinus90To90Range((B / 1000000) - 3.908239);
+  details.RadiusVector = (R / 10000000) + 40.7241346;
+
+  return details;
+}
+
+void CAAPluto::Position(const double* pJD, CAAPlutoDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Position(pJD[i]);
+  }
+}
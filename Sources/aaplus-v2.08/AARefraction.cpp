@@ -28,16 +28,84 @@ to maintain a single distribution point for the source code.
 #include "AARefraction.h"
 #include "AACoordinateTransformation.h"
 #include <cmath>
+#include <cassert>
+#include <algorithm>
 using namespace std;
 
 
+//////////////////////////////////// Macros / Defines /////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26482)
+#endif //#ifdef _MSC_VER
+
+//The altitudes below which each formula returns a constant value, where the refraction is a maximum
+constexpr double AAREFRACTION_MINIMUM_APPARENT_ALTITUDE = -1.6962987799993996;
+constexpr double AAREFRACTION_MINIMUM_TRUE_ALTITUDE = -1.9006387000003735;
+
+constexpr double AAREFRACTION_TABLE_SPLIT = 10; //The altitude in degrees where the step of the tables changes
+constexpr double AAREFRACTION_TABLE_STEP1 = 0.05;
+constexpr double AAREFRACTION_TABLE_STEP2 = 0.5;
+constexpr double AAREFRACTION_TABLE_END = 90;
+
+
 /////////////////////////////////// Implementation ////////////////////////////
 
+//The factor applied to the refraction for the pressure in millibars and the temperature in degrees Celsius
+static double RefractionScale(double Pressure, double Temperature) noexcept
+{
+  return Pressure/1010 * 283/(273+Temperature);
+}
+
+//Bennett's formula (16.4) and Saemundsson's formula (16.6) and their derivatives with respect to the altitude,
+//before the scale factor is applied
+static double RefractionFromApparent(double Altitude) noexcept
+{
+  return (1 / (tan(CAACoordinateTransformation::DegreesToRadians(Altitude + 7.31/(Altitude + 4.4)))) + 0.0013515) / 60;
+}
+
+static double RefractionFromApparentDash(double Altitude) noexcept
+{
+  const double sinValue = sin(CAACoordinateTransformation::DegreesToRadians(Altitude + 7.31/(Altitude + 4.4)));
+  return -CAACoordinateTransformation::DegreesToRadians(1 - 7.31/((Altitude + 4.4)*(Altitude + 4.4))) / (sinValue*sinValue*60);
+}
+
+static double RefractionFromTrue(double Altitude) noexcept
+{
+  return (1.02 / (tan(CAACoordinateTransformation::DegreesToRadians(Altitude + 10.3/(Altitude + 5.11)))) + 0.0019279) / 60;
+}
+
+static double RefractionFromTrueDash(double Altitude) noexcept
+{
+  const double sinValue = sin(CAACoordinateTransformation::DegreesToRadians(Altitude + 10.3/(Altitude + 5.11)));
+  return -1.02 * CAACoordinateTransformation::DegreesToRadians(1 - 10.3/((Altitude + 5.11)*(Altitude + 5.11))) / (sinValue*sinValue*60);
+}
+
+//Solves Altitude = h + Scale*RefractionFromTrue(h) for the true altitude h using Newton's method, starting from
+//Bennett's formula which is already a close approximation to the solution, and returns the refraction
+static double InverseRefractionFromTrue(double Altitude, double Scale) noexcept
+{
+  const double MinimumRefraction = Scale * RefractionFromTrue(AAREFRACTION_MINIMUM_TRUE_ALTITUDE);
+  if (Altitude <= (AAREFRACTION_MINIMUM_TRUE_ALTITUDE + MinimumRefraction))
+    return MinimumRefraction;
+
+  double h = Altitude - (Scale * RefractionFromApparent(max(Altitude, AAREFRACTION_MINIMUM_APPARENT_ALTITUDE)));
+  for (int i=0; i<10; i++)
+  {
+    h = max(h, AAREFRACTION_MINIMUM_TRUE_ALTITUDE);
+    const double Delta = (h + (Scale * RefractionFromTrue(h)) - Altitude) / (1 + (Scale * RefractionFromTrueDash(h)));
+    h -= Delta;
+    if (fabs(Delta) < 1e-13)
+      break;
+  }
+  return Altitude - h;
+}
+
 double CAARefraction::RefractionFromApparent(double Altitude, double Pressure, double Temperature) noexcept
 {
   //return a constant value from this method if the altitude is below a specific value
-  if (Altitude <= -1.6962987799993996)
-    Altitude = -1.6962987799993996;
+  if (Altitude <= AAREFRACTION_MINIMUM_APPARENT_ALTITUDE)
+    Altitude = AAREFRACTION_MINIMUM_APPARENT_ALTITUDE;
 
   double value = 1 / (tan(CAACoordinateTransformation::DegreesToRadians(Altitude + 7.31/(Altitude + 4.4)))) + 0.0013515;
   value *= (Pressure/1010 * 283/(273+Temperature));
@@ -48,11 +116,174 @@ double CAARefraction::RefractionFromApparent(double Altitude, double Pressure, d
 double CAARefraction::RefractionFromTrue(double Altitude, double Pressure, double Temperature) noexcept
 {
   //return a constant value from this method if the altitude is below a specific value
-  if (Altitude <= -1.9006387000003735)
-    Altitude = -1.9006387000003735;
+  if (Altitude <= AAREFRACTION_MINIMUM_TRUE_ALTITUDE)
+    Altitude = AAREFRACTION_MINIMUM_TRUE_ALTITUDE;
 
   double value = 1.02 / (tan(CAACoordinateTransformation::DegreesToRadians(Altitude + 10.3/(Altitude + 5.11)))) + 0.0019279;
   value *= (Pressure/1010 * 283/(273+Temperature));
   value /= 60;
   return value;
 }
+
+void CAARefraction::RefractionFromApparent(const double* pAltitude, double* pResults, size_t nCount, double Pressure, double Temperature) noexcept
+{
+  //Validate our parameters
+  assert((pAltitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  const double Scale = RefractionScale(Pressure, Temperature);
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = Scale * ::RefractionFromApparent(max(pAltitude[i], AAREFRACTION_MINIMUM_APPARENT_ALTITUDE));
+}
+
+void CAARefraction::RefractionFromTrue(const double* pAltitude, double* pResults, size_t nCount, double Pressure, double Temperature) noexcept
+{
+  //Validate our parameters
+  assert((pAltitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  const double Scale = RefractionScale(Pressure, Temperature);
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = Scale * ::RefractionFromTrue(max(pAltitude[i], AAREFRACTION_MINIMUM_TRUE_ALTITUDE));
+}
+
+void CAARefractionTable::CTable::Sample(double Start, double End, const std::function<void(double X, double& Y, double& YDash)>& function)
+{
+  //Validate our parameters
+  assert(Start < AAREFRACTION_TABLE_SPLIT);
+  assert(End > AAREFRACTION_TABLE_SPLIT);
+
+  //Divide each interval into a whole number of steps no larger than the nominal step
+  m_Start = Start;
+  m_Split = AAREFRACTION_TABLE_SPLIT;
+  m_End = End;
+  m_nSplit = static_cast<size_t>(ceil((m_Split - m_Start) / AAREFRACTION_TABLE_STEP1));
+  m_Step1 = (m_Split - m_Start) / m_nSplit;
+  const size_t nSteps2 = static_cast<size_t>(ceil((m_End - m_Split) / AAREFRACTION_TABLE_STEP2));
+  m_Step2 = (m_End - m_Split) / nSteps2;
+  m_InverseStep1 = 1 / m_Step1;
+  m_InverseStep2 = 1 / m_Step2;
+
+  const size_t n = m_nSplit + nSteps2 + 1;
+  m_Y.resize(n);
+  m_YDash.resize(n);
+  for (size_t i=0; i<n; i++)
+  {
+    double X = m_End;
+    if (i < m_nSplit)
+      X = m_Start + (i * m_Step1);
+    else if (i < (n - 1))
+      X = m_Split + ((i - m_nSplit) * m_Step2);
+    function(X, m_Y[i], m_YDash[i]);
+  }
+}
+
+double CAARefractionTable::CTable::Evaluate(double X) const noexcept
+{
+  //Validate our parameters
+  assert(m_Y.size() >= 2);
+
+  //Find the interval containing X directly from the uniform steps of each part of the table
+  double u = 0;
+  double h = 0;
+  size_t i = 0;
+  if (X < m_Split)
+  {
+    h = m_Step1;
+    u = (X - m_Start) * m_InverseStep1;
+    i = min(static_cast<size_t>(u), m_nSplit - 1);
+  }
+  else
+  {
+    h = m_Step2;
+    u = (X - m_Split) * m_InverseStep2;
+    i = min(static_cast<size_t>(u), m_Y.size() - m_nSplit - 2);
+    u += m_nSplit;
+    i += m_nSplit;
+  }
+  const double t = u - i;
+  const double t2 = t*t;
+  const double t3 = t2*t;
+  const double h00 = 2*t3 - 3*t2 + 1;
+  const double h10 = t3 - 2*t2 + t;
+  const double h01 = -2*t3 + 3*t2;
+  const double h11 = t3 - t2;
+  return h00*m_Y[i] + h10*h*m_YDash[i] + h01*m_Y[i + 1] + h11*h*m_YDash[i + 1];
+}
+
+CAARefractionTable::CAARefractionTable(double Pressure, double Temperature) : m_Pressure(Pressure),
+                                                                             m_Temperature(Temperature)
+{
+  const double Scale = RefractionScale(Pressure, Temperature);
+  m_FromApparent.Sample(AAREFRACTION_MINIMUM_APPARENT_ALTITUDE, AAREFRACTION_TABLE_END, [Scale](double X, double& Y, double& YDash) noexcept
+  {
+    Y = Scale * ::RefractionFromApparent(X);
+    YDash = Scale * RefractionFromApparentDash(X);
+  });
+  m_FromTrue.Sample(AAREFRACTION_MINIMUM_TRUE_ALTITUDE, AAREFRACTION_TABLE_END, [Scale](double X, double& Y, double& YDash) noexcept
+  {
+    Y = Scale * ::RefractionFromTrue(X);
+    YDash = Scale * RefractionFromTrueDash(X);
+  });
+
+  //The inverse is tabulated against the apparent altitude, starting from the apparent altitude at which
+  //RefractionFromTrue becomes constant. If h is the true altitude then dR/dAltitude = R'(h) / (1 + R'(h))
+  const double Start = AAREFRACTION_MINIMUM_TRUE_ALTITUDE + (Scale * ::RefractionFromTrue(AAREFRACTION_MINIMUM_TRUE_ALTITUDE));
+  m_InverseFromTrue.Sample(Start, AAREFRACTION_TABLE_END, [Scale](double X, double& Y, double& YDash) noexcept
+  {
+    Y = ::InverseRefractionFromTrue(X, Scale);
+    const double Dash = Scale * RefractionFromTrueDash(max(X - Y, AAREFRACTION_MINIMUM_TRUE_ALTITUDE));
+    YDash = Dash / (1 + Dash);
+  });
+}
+
+double CAARefractionTable::RefractionFromApparent(double Altitude) const noexcept
+{
+  if (m_FromApparent.Contains(Altitude))
+    return m_FromApparent.Evaluate(Altitude);
+  return CAARefraction::RefractionFromApparent(Altitude, m_Pressure, m_Temperature);
+}
+
+double CAARefractionTable::RefractionFromTrue(double Altitude) const noexcept
+{
+  if (m_FromTrue.Contains(Altitude))
+    return m_FromTrue.Evaluate(Altitude);
+  return CAARefraction::RefractionFromTrue(Altitude, m_Pressure, m_Temperature);
+}
+
+double CAARefractionTable::InverseRefractionFromTrue(double Altitude) const noexcept
+{
+  if (m_InverseFromTrue.Contains(Altitude))
+    return m_InverseFromTrue.Evaluate(Altitude);
+  return ::InverseRefractionFromTrue(Altitude, RefractionScale(m_Pressure, m_Temperature));
+}
+
+void CAARefractionTable::RefractionFromApparent(const double* pAltitude, double* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert((pAltitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = RefractionFromApparent(pAltitude[i]);
+}
+
+void CAARefractionTable::RefractionFromTrue(const double* pAltitude, double* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert((pAltitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = RefractionFromTrue(pAltitude[i]);
+}
+
+void CAARefractionTable::InverseRefractionFromTrue(const double* pAltitude, double* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert((pAltitude != nullptr) || (nCount == 0));
+  assert((pResults != nullptr) || (nCount == 0));
+
+  for (size_t i=0; i<nCount; i++)
+    pResults[i] = InverseRefractionFromTrue(pAltitude[i]);
+}
@@ -62,6 +62,7 @@ to maintain a single distribution point for the source code.
 #include "AADynamicalTime.h"
 #include "AAInterpolate.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -227,7 +228,8 @@ void CAARiseTransitSet::CalculateTransitHelper(CAARiseTransitSetDetails& details
   }
 }
 
-CAARiseTransitSetDetails CAARiseTransitSet::Calculate(double JD, double Alpha1, double Delta1, double Alpha2, double Delta2, double Alpha3, double Delta3, double Longitude, double Latitude, double h0) noexcept
+CAARiseTransitSetDetails CAARiseTransitSet::CalculateDetails(double theta0, double deltaT, double cosH0, double M0, double Alpha1, double Delta1, double Alpha2, double Delta2, double Alpha3, double Delta3,
+                                                             double Longitude, double Latitude, double LatitudeRad, double h0) noexcept
 {
   //What will be the return value
   CAARiseTransitSetDetails details;
@@ -236,6 +238,25 @@ CAARiseTransitSetDetails CAARiseTransitSet::Calculate(double JD, double Alpha1,
   details.bTransitValid = true;
   details.bTransitAboveHorizon = false;
 
+  //Calculate M1 & M2
+  double M1 = 0;
+  double M2 = 0;
+  CalculateRiseSet(M0, cosH0, details, M1, M2);
+
+  //Do the main work
+  CalculateTransitHelper(details, theta0, deltaT, Alpha1, Alpha2, Alpha3, Longitude, M0);
+  CalculateRiseHelper(details, theta0, deltaT, Alpha1, Delta1, Alpha2, Delta2, Alpha3, Delta3, Longitude, Latitude, LatitudeRad, h0, M1);
+  CalculateSetHelper(details, theta0, deltaT, Alpha1, Delta1, Alpha2, Delta2, Alpha3, Delta3, Longitude, Latitude, LatitudeRad, h0, M2);
+
+  details.Rise = details.bRiseValid ? (M1 * 24) : 0.0;
+  details.Set = details.bSetValid ? (M2 * 24) : 0.0;
+  details.Transit = details.bTransitValid ? (M0 * 24) : 0.0;
+
+  return details;
+}
+
+CAARiseTransitSetDetails CAARiseTransitSet::Calculate(double JD, double Alpha1, double Delta1, double Alpha2, double Delta2, double Alpha3, double Delta3, double Longitude, double Latitude, double h0) noexcept
+{
   //Calculate the sidereal time
   double theta0 = CAASidereal::ApparentGreenwichSiderealTime(JD);
   theta0 *= 15; //Express it as degrees
@@ -254,24 +275,109 @@ CAARiseTransitSetDetails CAARiseTransitSet::Calculate(double JD, double Alpha1,
   const double cosH0 = (sin(h0Rad) - sin(LatitudeRad)*sin(Delta2Rad)) / (cos(LatitudeRad) * cos(Delta2Rad));
 
   //Calculate M0
-  double M0 = CalculateTransit(Alpha2, theta0, Longitude);
-
-  //Calculate M1 & M2
-  double M1 = 0;
-  double M2 = 0;
-  CalculateRiseSet(M0, cosH0, details, M1, M2);
+  const double M0 = CalculateTransit(Alpha2, theta0, Longitude);
 
   //Ensure the RA values are corrected for interpolation. Due to important Remark 2 by Meeus on Interopolation of RA values
   CorrectRAValuesForInterpolation(Alpha1, Alpha2, Alpha3);
 
-  //Do the main work
-  CalculateTransitHelper(details, theta0, deltaT, Alpha1, Alpha2, Alpha3, Longitude, M0);
-  CalculateRiseHelper(details, theta0, deltaT, Alpha1, Delta1, Alpha2, Delta2, Alpha3, Delta3, Longitude, Latitude, LatitudeRad, h0, M1);
-  CalculateSetHelper(details, theta0, deltaT, Alpha1, Delta1, Alpha2, Delta2, Alpha3, Delta3, Longitude, Latitude, LatitudeRad, h0, M2);
+  return CalculateDetails(theta0, deltaT, cosH0, M0, Alpha1, Delta1, Alpha2, Delta2, Alpha3, Delta3, Longitude, Latitude, LatitudeRad, h0);
+}
 
-  details.Rise = details.bRiseValid ? (M1 * 24) : 0.0;
-  details.Set = details.bSetValid ? (M2 * 24) : 0.0;
-  details.Transit = details.bTransitValid ? (M0 * 24) : 0.0;
+void CAARiseTransitSet::CalculateAlmanac(double JD, size_t nDays, const double* pAlpha, const double* pDelta, const double* pLongitudes, const double* pLatitudes, size_t nSites, double h0, CAARiseTransitSetDetails* pResults)
+{
+  //Validate our parameters
+  assert(pAlpha);
+  assert(pDelta);
+  assert(pLongitudes);
+  assert(pLatitudes);
+  assert(pResults);
+
+  //The site dependent values are the same for every day
+  vector<double> LatitudeRad(nSites);
+  vector<double> sinLatitude(nSites);
+  vector<double> cosLatitude(nSites);
+  for (size_t j=0; j<nSites; j++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    LatitudeRad[j] = CAACoordinateTransformation::DegreesToRadians(pLatitudes[j]);
+    sinLatitude[j] = sin(LatitudeRad[j]);
+    cosLatitude[j] = cos(LatitudeRad[j]);
+  }
+  const double sinh0 = sin(CAACoordinateTransformation::DegreesToRadians(h0));
+
+  vector<double> cosH0(nSites);
+  for (size_t i=0; i<nDays; i++)
+  {
+    //The sidereal time, deltat and the three day window of positions are shared by every site. Each position is used for three consecutive days
+    const double DayJD = JD + i;
+    const double theta0 = CAASidereal::ApparentGreenwichSiderealTime(DayJD) * 15;
+    const double deltaT = CAADynamicalTime::DeltaT(DayJD);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    double Alpha1 = pAlpha[i];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    double Alpha2 = pAlpha[i + 1];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    double Alpha3 = pAlpha[i + 2];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double Delta1 = pDelta[i];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double Delta2 = pDelta[i + 1];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double Delta3 = pDelta[i + 2];
+    const double Delta2Rad = CAACoordinateTransformation::DegreesToRadians(Delta2);
+    const double sinDelta2 = sin(Delta2Rad);
+    const double cosDelta2 = cos(Delta2Rad);
+    const double UncorrectedAlpha2 = Alpha2;
+    CorrectRAValuesForInterpolation(Alpha1, Alpha2, Alpha3);
+
+    //Calculate cosH0 for all the sites in one pass
+    for (size_t j=0; j<nSites; j++)
+      cosH0[j] = (sinh0 - sinLatitude[j]*sinDelta2) / (cosLatitude[j] * cosDelta2);
+
+    for (size_t j=0; j<nSites; j++)
+    {
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      const double Longitude = pLongitudes[j];
+      const double M0 = CalculateTransit(UncorrectedAlpha2, theta0, Longitude);
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      pResults[(i * nSites) + j] = CalculateDetails(theta0, deltaT, cosH0[j], M0, Alpha1, Delta1, Alpha2, Delta2, Alpha3, Delta3, Longitude, pLatitudes[j], LatitudeRad[j], h0);
+    }
+  }
+}
+
+vector<CAARiseTransitSetDetails> CAARiseTransitSet::CalculateAlmanac(double JD, size_t nDays, const std::function<CAA2DCoordinate(double JD)>& position, const double* pLongitudes, const double* pLatitudes, size_t nSites, double h0)
+{
+  //Calculate each position once, at 0h Dynamical Time from the day before the first day to the day after the last day
+  vector<double> Alpha(nDays + 2);
+  vector<double> Delta(nDays + 2);
+  for (size_t i=0; i<(nDays + 2); i++)
+  {
+    const CAA2DCoordinate Equatorial = position(JD - 1 + i);
+    Alpha[i] = Equatorial.X;
+    Delta[i] = Equatorial.Y;
+  }
+
+  //What will be the return value
+  vector<CAARiseTransitSetDetails> details(nDays * nSites);
+  CalculateAlmanac(JD, nDays, Alpha.data(), Delta.data(), pLongitudes, pLatitudes, nSites, h0, details.data());
 
   return details;
 }
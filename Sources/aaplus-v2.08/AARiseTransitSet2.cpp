@@ -35,318 +35,212 @@ to maintain a single distribution point for the source code.
 #include "AASun.h"
 #include "AAMoon.h"
 #include "AANutation.h"
+#include "AAEventFinder.h"
 #include <cmath>
 #include <cassert>
+#include <algorithm>
 using namespace std;
 
 
 ///////////////////////////// Implementation //////////////////////////////////
 
-void CAARiseTransitSet2::AddEvents(vector<CAARiseTransitSetDetails2>& events, double LastAltitudeForDetectingRiseSet, double AltitudeForDetectingRiseSet,
-                                   double LastAltitudeForInterpolation, double h0, const CAA2DCoordinate& Horizontal, double LastJD, double StepInterval, double LastBearing, 
-                                   Object object, double LastAltitudeForDetectingTwilight, double AltitudeForTwilight)
+//Returns the offset in degrees of a bearing from a meridian in the range -180 to +180, which is continuous as the object crosses the meridian
+static double MeridianOffset(double Bearing, double Meridian) noexcept
 {
-  if ((object == Object::SUN) && (LastAltitudeForDetectingTwilight != -90))
-  {
-    if ((LastAltitudeForDetectingTwilight < -18) && (AltitudeForTwilight >= -18)) //We have just ended astronomical twilight
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::EndAstronomicalTwilight;
-      const double fraction = (-18 - LastAltitudeForInterpolation) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
-
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
-
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
-    else if ((LastAltitudeForDetectingTwilight < -12) && (AltitudeForTwilight >= -12)) //We have just ended nautical twilight
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::EndNauticalTwilight;
-      const double fraction = (-12 - LastAltitudeForInterpolation) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
-
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
-
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
-    else if ((LastAltitudeForDetectingTwilight < -6) && (AltitudeForTwilight >= -6)) //We have just ended civil twilight
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::EndCivilTwilight;
-      const double fraction = (-6 - LastAltitudeForInterpolation) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
-
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
-
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
-    else if ((LastAltitudeForDetectingTwilight > -18) && (AltitudeForTwilight <= -18)) //We have just started astronomical twilight
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::StartAstronomicalTwilight;
-      const double fraction = (-18 - LastAltitudeForInterpolation) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
-
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
-
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
-    else if ((LastAltitudeForDetectingTwilight > -12) && (AltitudeForTwilight <= -12)) //We have just started nautical twilight
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::StartNauticalTwilight;
-      const double fraction = (-12 - LastAltitudeForInterpolation) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
-
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
-
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
-    else if ((LastAltitudeForDetectingTwilight > -6) && (AltitudeForTwilight <= -6)) //We have just started nautical twilight
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::StartCivilTwilight;
-      const double fraction = (-6 - LastAltitudeForInterpolation) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
+  const double Offset = CAACoordinateTransformation::MapTo0To360Range(Bearing - Meridian);
+  return (Offset > 180) ? (Offset - 360) : Offset;
+}
 
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
+void CAARiseTransitSet2::AddEvents(vector<CAARiseTransitSetDetails2>& events, const HorizontalFunction& horizontal, const vector<AltitudeThreshold>& thresholds, double LastJD, const CAA2DCoordinate& LastHorizontal, double Lasth0,
+                                   double JD, const CAA2DCoordinate& Horizontal, double h0)
+{
+  const size_t nFirstEvent = events.size();
 
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
-  }
-  if (LastAltitudeForDetectingRiseSet != -90)
+  //Look for every altitude threshold which has been crossed during this step
+  for (const auto& threshold : thresholds)
   {
-    if ((LastAltitudeForDetectingRiseSet < 0) && (AltitudeForDetectingRiseSet >= 0)) //We have just rose above the horizon
+    const double LastAltitude = LastHorizontal.Y - threshold.Altitude - (threshold.bRelativeToh0 ? Lasth0 : 0);
+    const double Altitude = Horizontal.Y - threshold.Altitude - (threshold.bRelativeToh0 ? h0 : 0);
+    CAARiseTransitSetDetails2 event;
+    if ((LastAltitude < 0) && (Altitude >= 0))
+      event.type = threshold.AscendingType;
+    else if ((LastAltitude > 0) && (Altitude <= 0))
+      event.type = threshold.DescendingType;
+    else
+      continue;
+
+    //Refine the time of the crossing and fill in the bearing at that time
+    auto AltitudeFunction = [&horizontal, &threshold](double JD2)
     {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::Rise;
-      const double fraction = (0 - LastAltitudeForInterpolation + h0) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
-
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
-
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
-    else if ((LastAltitudeForDetectingRiseSet > 0) && (AltitudeForDetectingRiseSet <= 0)) //We have just set below the horizon
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::Set;
-      const double fraction = (0 - LastAltitudeForInterpolation + h0) / (Horizontal.Y - LastAltitudeForInterpolation);
-      event.JD = LastJD + (fraction * StepInterval);
-
-      //Ensure the LastBearing and Horizontal.X values are correct for interpolation
-      double LastBearing2 = LastBearing;
-      double HorizontalX2 = Horizontal.X;
-      if (fabs(HorizontalX2 - LastBearing2) > 180)
-      {
-        if (HorizontalX2 > LastBearing2)
-          LastBearing2 += 360;
-        else
-          HorizontalX2 += 360;
-      }
-
-      event.Bearing = CAACoordinateTransformation::MapTo0To360Range(LastBearing2 + (fraction * (HorizontalX2 - LastBearing2)));
-      events.push_back(event);
-    }
+      double h02 = 0;
+      const CAA2DCoordinate Horizontal2 = horizontal(JD2, h02);
+      return Horizontal2.Y - threshold.Altitude - (threshold.bRelativeToh0 ? h02 : 0);
+    };
+    event.JD = CAAEventFinder::Root(AltitudeFunction, LastJD, JD, LastAltitude, Altitude);
+    double Eventh0 = 0;
+    event.Bearing = CAACoordinateTransformation::MapTo0To360Range(horizontal(event.JD, Eventh0).X);
+    event.Altitude = threshold.Altitude + (threshold.bRelativeToh0 ? Eventh0 : 0);
+    events.push_back(event);
   }
-  if (LastBearing != -1)
+
+  //Refines the time when the bearing crosses the meridian and adds the event with the geometric altitude at that time
+  auto AddTransitEvent = [&](CAARiseTransitSetDetails2::Type type, double Meridian)
   {
-    if ((LastBearing > 270) && (Horizontal.X >= 0) && (Horizontal.X <= 90)) //We have just crossed the southern meridian from east to west
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::SouthernTransit;
-      const double fraction = (360 - LastBearing) / (Horizontal.X + (360 - LastBearing));
-      event.JD = LastJD + (fraction * StepInterval);
-      event.GeometricAltitude = LastAltitudeForInterpolation + (fraction * (Horizontal.Y - LastAltitudeForInterpolation));
-      event.bAboveHorizon = (AltitudeForDetectingRiseSet > 0);
-      events.push_back(event);
-    }
-    else if ((LastBearing < 90) && (Horizontal.X >= 270) && (Horizontal.X <= 360)) //We have just crossed the southern meridian from west to east
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::SouthernTransit;
-      const double fraction = LastBearing / (360 - Horizontal.X + LastBearing);
-      event.JD = LastJD + (fraction * StepInterval);
-      event.GeometricAltitude = LastAltitudeForInterpolation + (fraction * (Horizontal.Y - LastAltitudeForInterpolation));
-      event.bAboveHorizon = (AltitudeForDetectingRiseSet > 0);
-      events.push_back(event);
-    }
-    else if ((LastBearing < 180) && (Horizontal.X >= 180)) //We have just crossed the northern meridian from west to east
+    auto Offset = [&horizontal, Meridian](double JD2)
     {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::NorthernTransit;
-      const double fraction = (180 - LastBearing) / (Horizontal.X - LastBearing);
-      event.JD = LastJD + (fraction * StepInterval);
-      event.GeometricAltitude = LastAltitudeForInterpolation + (fraction * (Horizontal.Y - LastAltitudeForInterpolation));
-      event.bAboveHorizon = (AltitudeForDetectingRiseSet > 0);
-      events.push_back(event);
-    }
-    else if ((LastBearing > 180) && (Horizontal.X <= 180)) //We have just crossed the northern meridian from east to west
-    {
-      CAARiseTransitSetDetails2 event;
-      event.type = CAARiseTransitSetDetails2::Type::NorthernTransit;
-      const double fraction = ((LastBearing - 180) / (LastBearing - Horizontal.X));
-      event.JD = LastJD + (fraction * StepInterval);
-      event.GeometricAltitude = LastAltitudeForInterpolation + (fraction * (Horizontal.Y - LastAltitudeForInterpolation));
-      event.bAboveHorizon = (AltitudeForDetectingRiseSet > 0);
-      events.push_back(event);
-    }
-  }
+      double h02 = 0;
+      return MeridianOffset(horizontal(JD2, h02).X, Meridian);
+    };
+    CAARiseTransitSetDetails2 event;
+    event.type = type;
+    event.JD = CAAEventFinder::Root(Offset, LastJD, JD, MeridianOffset(LastHorizontal.X, Meridian), MeridianOffset(Horizontal.X, Meridian));
+    double Eventh0 = 0;
+    const CAA2DCoordinate EventHorizontal = horizontal(event.JD, Eventh0);
+    event.GeometricAltitude = EventHorizontal.Y;
+    event.bAboveHorizon = ((EventHorizontal.Y - Eventh0) > 0);
+    events.push_back(event);
+  };
+
+  if ((LastHorizontal.X > 270) && (Horizontal.X >= 0) && (Horizontal.X <= 90)) //We have just crossed the southern meridian from east to west
+    AddTransitEvent(CAARiseTransitSetDetails2::Type::SouthernTransit, 0);
+  else if ((LastHorizontal.X < 90) && (Horizontal.X >= 270) && (Horizontal.X <= 360)) //We have just crossed the southern meridian from west to east
+    AddTransitEvent(CAARiseTransitSetDetails2::Type::SouthernTransit, 0);
+  else if ((LastHorizontal.X < 180) && (Horizontal.X >= 180)) //We have just crossed the northern meridian from west to east
+    AddTransitEvent(CAARiseTransitSetDetails2::Type::NorthernTransit, 180);
+  else if ((LastHorizontal.X > 180) && (Horizontal.X <= 180)) //We have just crossed the northern meridian from east to west
+    AddTransitEvent(CAARiseTransitSetDetails2::Type::NorthernTransit, 180);
+
+  //Several events can occur in the one step, so ensure they are reported in time order
+  sort(events.begin() + nFirstEvent, events.end(), [](const CAARiseTransitSetDetails2& a, const CAARiseTransitSetDetails2& b) noexcept { return a.JD < b.JD; });
 }
 
-vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::Calculate(double StartJD, double EndJD, Object object, double Longitude, double Latitude, double h0, double Height, double StepInterval, bool bHighPrecision)
+vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::CalculateEvents(double StartJD, double EndJD, double StepInterval, const HorizontalFunction& horizontal, bool bTwilight, const vector<double>& Altitudes)
 {
   //What will be the return value
   vector<CAARiseTransitSetDetails2> events;
 
-  const double LongtitudeAsHourAngle = CAACoordinateTransformation::DegreesToHours(Longitude);
+  //Build up the table of altitude thresholds to detect, sorted by altitude
+  vector<AltitudeThreshold> thresholds;
+  thresholds.reserve(Altitudes.size() + 4);
+  thresholds.push_back({ 0, true, CAARiseTransitSetDetails2::Type::Rise, CAARiseTransitSetDetails2::Type::Set });
+  if (bTwilight)
+  {
+    thresholds.push_back({ -18, false, CAARiseTransitSetDetails2::Type::EndAstronomicalTwilight, CAARiseTransitSetDetails2::Type::StartAstronomicalTwilight });
+    thresholds.push_back({ -12, false, CAARiseTransitSetDetails2::Type::EndNauticalTwilight, CAARiseTransitSetDetails2::Type::StartNauticalTwilight });
+    thresholds.push_back({ -6, false, CAARiseTransitSetDetails2::Type::EndCivilTwilight, CAARiseTransitSetDetails2::Type::StartCivilTwilight });
+  }
+  for (const auto& Altitude : Altitudes)
+    thresholds.push_back({ Altitude, false, CAARiseTransitSetDetails2::Type::AscendingAltitude, CAARiseTransitSetDetails2::Type::DescendingAltitude });
+  stable_sort(thresholds.begin(), thresholds.end(), [](const AltitudeThreshold& a, const AltitudeThreshold& b) noexcept { return a.Altitude < b.Altitude; });
+
+  //The dates are calculated from the step number rather than accumulated, so that they fall exactly on the grid
+  //used by the series steppers
+  long nStep = 0;
   double JD = StartJD;
   double LastJD = 0;
-  double LastAltitudeForDetectingRiseSet = -90;
-  double LastAltitudeForInterpolation = -90;
-  double LastAltitudeForDetectingTwilight = -90;
-  double LastBearing = -1;
+  CAA2DCoordinate LastHorizontal;
+  double Lasth0 = 0;
+  bool bFirst = true;
   while (JD < EndJD)
   {
+    double h0 = 0;
+    const CAA2DCoordinate Horizontal = horizontal(JD, h0);
+
+    //Call the helper method to add any found events
+    if (!bFirst)
+      AddEvents(events, horizontal, thresholds, LastJD, LastHorizontal, Lasth0, JD, Horizontal, h0);
+
+    //Prepare for the next loop
+    LastHorizontal = Horizontal;
+    Lasth0 = h0;
+    LastJD = JD;
+    bFirst = false;
+    ++nStep;
+    JD = StartJD + (nStep * StepInterval);
+  }
+
+  return events;
+}
+
+vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::Calculate(double StartJD, double EndJD, Object object, double Longitude, double Latitude, double h0, double Height, double StepInterval, bool bHighPrecision, const vector<double>& Altitudes)
+{
+  const double LongtitudeAsHourAngle = CAACoordinateTransformation::DegreesToHours(Longitude);
+  const CAASiderealTime sidereal(StartJD - StepInterval, EndJD + StepInterval);
+  const CAAObserver observer(Longitude, Latitude, Height);
+  CAASunStepper sun;
+  CAANutationStepper nutation;
+  if (object == Object::SUN)
+    sun = CAASunStepper(StartJD, StepInterval, bHighPrecision);
+  else if (object == Object::MOON)
+    nutation = CAANutationStepper(StartJD, StepInterval);
+  auto horizontal = [&sidereal, &observer, &sun, &nutation, object, Latitude, h0, bHighPrecision, LongtitudeAsHourAngle](double JD, double& Objecth0)
+  {
+    const CAATopocentricEpoch epoch(JD, sidereal.ApparentGreenwichSiderealTime(JD));
     CAAEllipticalPlanetaryDetails details;
     CAA2DCoordinate Topo;
     switch (object)
     {
       case Object::SUN:
       {
-        const double Long = CAASun::ApparentEclipticLongitude(JD, bHighPrecision);
-        const double Lat = CAASun::ApparentEclipticLatitude(JD, bHighPrecision);
-        const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(Long, Lat, CAANutation::TrueObliquityOfEcliptic(JD));
-        const double SunRad = CAAEarth::RadiusVector(JD, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(Equatorial.X, Equatorial.Y, SunRad, Longitude, Latitude, Height, JD);
+        const CAASunApparentPositionDetails SunPosition = sun.Calculate(JD);
+        Topo = CAAParallax::Equatorial2Topocentric(SunPosition.ApparentRightAscension, SunPosition.ApparentDeclination, SunPosition.RadiusVector, observer, epoch);
         break;
       }
       case Object::MOON:
       {
         const double Long = CAAMoon::EclipticLongitude(JD);
         const double Lat = CAAMoon::EclipticLatitude(JD);
-        const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(Long, Lat, CAANutation::TrueObliquityOfEcliptic(JD));
+        const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(Long, Lat, nutation.TrueObliquityOfEcliptic(JD));
         const double MoonRad = CAAMoon::RadiusVector(JD) / 149597871; //Convert Kms to AUs
-        Topo = CAAParallax::Equatorial2Topocentric(Equatorial.X, Equatorial.Y, MoonRad, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(Equatorial.X, Equatorial.Y, MoonRad, observer, epoch);
         break;
       }
       case Object::MERCURY:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::MERCURY, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       case Object::VENUS:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::VENUS, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       case Object::MARS:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::MARS, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       case Object::JUPITER:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::JUPITER, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       case Object::SATURN:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::SATURN, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       case Object::URANUS:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::URANUS, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       case Object::NEPTUNE:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::NEPTUNE, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       case Object::PLUTO:
       {
         details = CAAElliptical::Calculate(JD, CAAElliptical::EllipticalObject::PLUTO, bHighPrecision);
-        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, Longitude, Latitude, Height, JD);
+        Topo = CAAParallax::Equatorial2Topocentric(details.ApparentGeocentricRA, details.ApparentGeocentricDeclination, details.ApparentGeocentricDistance, observer, epoch);
         break;
       }
       default:
@@ -355,95 +249,50 @@ vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::Calculate(double StartJD,
         break;
       }
     }
-    const double AST = CAASidereal::ApparentGreenwichSiderealTime(JD);
-    const double LocalHourAngle = AST - LongtitudeAsHourAngle - Topo.X;
+    const double LocalHourAngle = epoch.ApparentGreenwichSiderealTime - LongtitudeAsHourAngle - Topo.X;
     const CAA2DCoordinate Horizontal = CAACoordinateTransformation::Equatorial2Horizontal(LocalHourAngle, Topo.Y, Latitude);
-    const double AltitudeForDetectingRiseSet = (Horizontal.Y - h0);
-
-    //Call the helper method to add any found events
-    AddEvents(events, LastAltitudeForDetectingRiseSet, AltitudeForDetectingRiseSet, LastAltitudeForInterpolation, h0, Horizontal, LastJD, StepInterval, LastBearing, object, LastAltitudeForDetectingTwilight, Horizontal.Y);
-
-    //Prepare for the next loop
-    LastAltitudeForDetectingRiseSet = AltitudeForDetectingRiseSet;
-    LastAltitudeForInterpolation = Horizontal.Y;
-    LastAltitudeForDetectingTwilight = Horizontal.Y;
-    LastBearing = Horizontal.X;
-    LastJD = JD;
-    JD += StepInterval;
-  }
+    Objecth0 = h0;
+    return Horizontal;
+  };
 
-  return events;
+  return CalculateEvents(StartJD, EndJD, StepInterval, horizontal, object == Object::SUN, Altitudes);
 }
 
 //The higher accuracy version for the moon where the "standard altitude" is not treated as a constant
-vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::CalculateMoon(double StartJD, double EndJD, double Longitude, double Latitude, double Height, double StepInterval)
+vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::CalculateMoon(double StartJD, double EndJD, double Longitude, double Latitude, double Height, double StepInterval, const vector<double>& Altitudes)
 {
-  //What will be the return value
-  vector<CAARiseTransitSetDetails2> events;
-
   const double LongtitudeAsHourAngle = CAACoordinateTransformation::DegreesToHours(Longitude);
-  double JD = StartJD;
-  double LastJD = 0;
-  double LastAltitudeForDetectingRiseSet = -90;
-  double LastAltitudeForInterpolation = -90;
-  double LastBearing = -1;
-  while (JD < EndJD)
+  const CAASiderealTime sidereal(StartJD - StepInterval, EndJD + StepInterval);
+  const CAAObserver observer(Longitude, Latitude, Height);
+  CAANutationStepper nutation(StartJD, StepInterval);
+  auto horizontal = [&sidereal, &observer, &nutation, Latitude, LongtitudeAsHourAngle](double JD, double& h0)
   {
+    const CAATopocentricEpoch epoch(JD, sidereal.ApparentGreenwichSiderealTime(JD));
     const double Long = CAAMoon::EclipticLongitude(JD);
     const double Lat = CAAMoon::EclipticLatitude(JD);
-    const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(Long, Lat, CAANutation::TrueObliquityOfEcliptic(JD));
+    const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(Long, Lat, nutation.TrueObliquityOfEcliptic(JD));
     const double MoonRad = CAAMoon::RadiusVector(JD);
-    const CAA2DCoordinate Topo = CAAParallax::Equatorial2Topocentric(Equatorial.X, Equatorial.Y, MoonRad / 149597871, Longitude, Latitude, Height, JD);
-    const double AST = CAASidereal::ApparentGreenwichSiderealTime(JD);
-    const double LocalHourAngle = AST - LongtitudeAsHourAngle - Topo.X;
-    const CAA2DCoordinate Horizontal = CAACoordinateTransformation::Equatorial2Horizontal(LocalHourAngle, Topo.Y, Latitude);
-    const double h0 = 0.7275 * CAAMoon::RadiusVectorToHorizontalParallax(MoonRad) - CAACoordinateTransformation::DMSToDegrees(0, 34, 0);
-    const double AltitudeForDetectingRiseSet = (Horizontal.Y - h0);
-
-    //Call the helper method to add any found events
-    AddEvents(events, LastAltitudeForDetectingRiseSet, AltitudeForDetectingRiseSet, LastAltitudeForInterpolation, h0, Horizontal, LastJD, StepInterval, LastBearing, Object::MOON, 0, 0);
-
-    //Prepare for the next loop
-    LastAltitudeForDetectingRiseSet = AltitudeForDetectingRiseSet;
-    LastAltitudeForInterpolation = Horizontal.Y;
-    LastBearing = Horizontal.X;
-    LastJD = JD;
-    JD += StepInterval;
-  }
+    const CAA2DCoordinate Topo = CAAParallax::Equatorial2Topocentric(Equatorial.X, Equatorial.Y, MoonRad / 149597871, observer, epoch);
+    const double LocalHourAngle = epoch.ApparentGreenwichSiderealTime - LongtitudeAsHourAngle - Topo.X;
+    h0 = 0.7275 * CAAMoon::RadiusVectorToHorizontalParallax(MoonRad) - CAACoordinateTransformation::DMSToDegrees(0, 34, 0);
+    return CAACoordinateTransformation::Equatorial2Horizontal(LocalHourAngle, Topo.Y, Latitude);
+  };
 
-  return events;
+  return CalculateEvents(StartJD, EndJD, StepInterval, horizontal, false, Altitudes);
 }
 
 
 //A version for a stationary object such as a star
-vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::CalculateStationary(double StartJD, double EndJD, double Alpha, double Delta, double Longitude, double Latitude, double h0, double StepInterval)
+vector<CAARiseTransitSetDetails2> CAARiseTransitSet2::CalculateStationary(double StartJD, double EndJD, double Alpha, double Delta, double Longitude, double Latitude, double h0, double StepInterval, const vector<double>& Altitudes)
 {
-  //What will be the return value
-  vector<CAARiseTransitSetDetails2> events;
-
   const double LongtitudeAsHourAngle = CAACoordinateTransformation::DegreesToHours(Longitude);
-  double JD = StartJD;
-  double LastJD = 0;
-  double LastAltitudeForDetectingRiseSet = -90;
-  double LastAltitudeForInterpolation = -90;
-  double LastBearing = -1;
-  while (JD < EndJD)
+  const CAASiderealTime sidereal(StartJD - StepInterval, EndJD + StepInterval);
+  auto horizontal = [&sidereal, Alpha, Delta, Latitude, h0, LongtitudeAsHourAngle](double JD, double& Objecth0)
   {
-    const double AST = CAASidereal::ApparentGreenwichSiderealTime(JD);
-    const double LocalHourAngle = AST - LongtitudeAsHourAngle - Alpha;
-    const CAA2DCoordinate Horizontal = CAACoordinateTransformation::Equatorial2Horizontal(LocalHourAngle, Delta, Latitude);
-    const double AltitudeForDetectingRiseSet = (Horizontal.Y - h0);
+    const double LocalHourAngle = sidereal.ApparentGreenwichSiderealTime(JD) - LongtitudeAsHourAngle - Alpha;
+    Objecth0 = h0;
+    return CAACoordinateTransformation::Equatorial2Horizontal(LocalHourAngle, Delta, Latitude);
+  };
 
-    //Call the helper method to add any found event
-    AddEvents(events, LastAltitudeForDetectingRiseSet, AltitudeForDetectingRiseSet, LastAltitudeForInterpolation, h0, Horizontal, LastJD, StepInterval, LastBearing, Object::STAR, 0, 0);
-
-    //Prepare for the next loop
-    LastAltitudeForDetectingRiseSet = AltitudeForDetectingRiseSet;
-    LastAltitudeForInterpolation = Horizontal.Y;
-    LastBearing = Horizontal.X;
-    LastJD = JD;
-    JD += StepInterval;
-  }
-
-  return events;
+  return CalculateEvents(StartJD, EndJD, StepInterval, horizontal, false, Altitudes);
 }
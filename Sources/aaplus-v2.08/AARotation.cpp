@@ -0,0 +1,227 @@
+/*
+Module : AARotation.cpp
+Purpose: Implementation for 3x3 rotation matrices and quaternions used to change between coordinate frames
+Created: 18-10-2026
+History: None
+
+*/
+
+
+////////////////////// Includes ///////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AARotation.h"
+#include "AACoordinateTransformation.h"
+#include "AANutation.h"
+#include <cmath>
+#include <cassert>
+using namespace std;
+
+
+////////////////////// Implementation /////////////////////////////////////////
+
+CAARotationMatrix CAARotationMatrix::RotationX(double Angle) noexcept
+{
+  const double sinAngle = sin(Angle);
+  const double cosAngle = cos(Angle);
+  return CAARotationMatrix(1, 0, 0, 0, cosAngle, sinAngle, 0, -sinAngle, cosAngle);
+}
+
+CAARotationMatrix CAARotationMatrix::RotationY(double Angle) noexcept
+{
+  const double sinAngle = sin(Angle);
+  const double cosAngle = cos(Angle);
+  return CAARotationMatrix(cosAngle, 0, -sinAngle, 0, 1, 0, sinAngle, 0, cosAngle);
+}
+
+CAARotationMatrix CAARotationMatrix::RotationZ(double Angle) noexcept
+{
+  const double sinAngle = sin(Angle);
+  const double cosAngle = cos(Angle);
+  return CAARotationMatrix(cosAngle, sinAngle, 0, -sinAngle, cosAngle, 0, 0, 0, 1);
+}
+
+CAARotationMatrix CAARotationMatrix::Precession(double JD0, double JD) noexcept
+{
+  //The rigorous precession of equatorial coordinates from the mean equinox of JD0 to that of JD, using the same
+  //angles as CAAPrecession::PrecessEquatorial (Meeus's formulae 21.2 & 21.3)
+  const double T = (JD0 - 2451545.0) / 36525;
+  const double Tsquared = T*T;
+  const double t = (JD - JD0) / 36525;
+  const double tsquared = t*t;
+  const double tcubed  = tsquared * t;
+
+  const double sigma = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(0, 0, (2306.2181 + 1.39656*T - 0.000139*Tsquared)*t + (0.30188 - 0.000344*T)*tsquared + 0.017998*tcubed));
+  const double zeta = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(0, 0, (2306.2181 + 1.39656*T - 0.000139*Tsquared)*t + (1.09468 + 0.000066*T)*tsquared + 0.018203*tcubed));
+  const double phi = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(0, 0, (2004.3109 - 0.8533*T - 0.000217*Tsquared)*t -  (0.42665 + 0.000217*T)*tsquared - 0.041833*tcubed));
+
+  return RotationZ(-zeta) * RotationY(phi) * RotationZ(-sigma);
+}
+
+CAARotationMatrix CAARotationMatrix::Nutation(double JD) noexcept
+{
+  //From the mean equator and equinox of JD to the true equator and equinox of JD
+  const double MeanObliquity = CAACoordinateTransformation::DegreesToRadians(CAANutation::MeanObliquityOfEcliptic(JD));
+  const double NutationInLongitude = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(0, 0, CAANutation::NutationInLongitude(JD)));
+  const double NutationInObliquity = CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(0, 0, CAANutation::NutationInObliquity(JD)));
+
+  return RotationX(-(MeanObliquity + NutationInObliquity)) * RotationZ(-NutationInLongitude) * RotationX(MeanObliquity);
+}
+
+void CAARotationMatrix::Apply(const CAA3DCoordinate* pValues, CAA3DCoordinate* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert(pValues);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = *this * pValues[i];
+  }
+}
+
+void CAARotationMatrix::Apply(const double* pX, const double* pY, const double* pZ, double* pXResult, double* pYResult, double* pZResult, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert(pX);
+  assert(pY);
+  assert(pZ);
+  assert(pXResult);
+  assert(pYResult);
+  assert(pZResult);
+
+  //Take local copies of the matrix so that the compiler can keep them in registers and vectorize the loop
+  const double m00 = M[0][0];
+  const double m01 = M[0][1];
+  const double m02 = M[0][2];
+  const double m10 = M[1][0];
+  const double m11 = M[1][1];
+  const double m12 = M[1][2];
+  const double m20 = M[2][0];
+  const double m21 = M[2][1];
+  const double m22 = M[2][2];
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double X = pX[i];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double Y = pY[i];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const double Z = pZ[i];
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pXResult[i] = (m00*X) + (m01*Y) + (m02*Z);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pYResult[i] = (m10*X) + (m11*Y) + (m12*Z);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pZResult[i] = (m20*X) + (m21*Y) + (m22*Z);
+  }
+}
+
+CAAQuaternion CAAQuaternion::FromAxisAngle(const CAA3DCoordinate& Axis, double Angle) noexcept
+{
+  //A rotation of a vector (rather than of the coordinate frame) by Angle radians about Axis
+  const double Length = sqrt((Axis.X*Axis.X) + (Axis.Y*Axis.Y) + (Axis.Z*Axis.Z));
+  assert(Length > 0);
+  const double s = sin(Angle / 2) / Length;
+  return CAAQuaternion(cos(Angle / 2), Axis.X*s, Axis.Y*s, Axis.Z*s);
+}
+
+CAAQuaternion CAAQuaternion::FromRotationMatrix(const CAARotationMatrix& matrix) noexcept
+{
+  //Use Shepperd's method, which picks the largest of the four components to divide by for numerical stability.
+  //Note that the matrix must be a proper rotation, so for example the horizontal frame of
+  //CAAFrameTransformation which is a reflection cannot be represented
+  const double Trace = matrix.M[0][0] + matrix.M[1][1] + matrix.M[2][2];
+  CAAQuaternion q;
+  if ((Trace >= matrix.M[0][0]) && (Trace >= matrix.M[1][1]) && (Trace >= matrix.M[2][2]))
+  {
+    const double s = 2 * sqrt(1 + Trace);
+    q = CAAQuaternion(s / 4, (matrix.M[2][1] - matrix.M[1][2]) / s, (matrix.M[0][2] - matrix.M[2][0]) / s, (matrix.M[1][0] - matrix.M[0][1]) / s);
+  }
+  else if ((matrix.M[0][0] >= matrix.M[1][1]) && (matrix.M[0][0] >= matrix.M[2][2]))
+  {
+    const double s = 2 * sqrt(1 + matrix.M[0][0] - matrix.M[1][1] - matrix.M[2][2]);
+    q = CAAQuaternion((matrix.M[2][1] - matrix.M[1][2]) / s, s / 4, (matrix.M[0][1] + matrix.M[1][0]) / s, (matrix.M[0][2] + matrix.M[2][0]) / s);
+  }
+  else if (matrix.M[1][1] >= matrix.M[2][2])
+  {
+    const double s = 2 * sqrt(1 + matrix.M[1][1] - matrix.M[0][0] - matrix.M[2][2]);
+    q = CAAQuaternion((matrix.M[0][2] - matrix.M[2][0]) / s, (matrix.M[0][1] + matrix.M[1][0]) / s, s / 4, (matrix.M[1][2] + matrix.M[2][1]) / s);
+  }
+  else
+  {
+    const double s = 2 * sqrt(1 + matrix.M[2][2] - matrix.M[0][0] - matrix.M[1][1]);
+    q = CAAQuaternion((matrix.M[1][0] - matrix.M[0][1]) / s, (matrix.M[0][2] + matrix.M[2][0]) / s, (matrix.M[1][2] + matrix.M[2][1]) / s, s / 4);
+  }
+  return q.Normalize();
+}
+
+CAAQuaternion CAAQuaternion::Normalize() const noexcept
+{
+  const double Length = sqrt((W*W) + (X*X) + (Y*Y) + (Z*Z));
+  assert(Length > 0);
+  return CAAQuaternion(W / Length, X / Length, Y / Length, Z / Length);
+}
+
+CAARotationMatrix CAAQuaternion::ToRotationMatrix() const noexcept
+{
+  const double WW = W*W;
+  const double XX = X*X;
+  const double YY = Y*Y;
+  const double ZZ = Z*Z;
+  return CAARotationMatrix(WW + XX - YY - ZZ, 2*((X*Y) - (W*Z)), 2*((X*Z) + (W*Y)),
+                           2*((X*Y) + (W*Z)), WW - XX + YY - ZZ, 2*((Y*Z) - (W*X)),
+                           2*((X*Z) - (W*Y)), 2*((Y*Z) + (W*X)), WW - XX - YY + ZZ);
+}
+
+CAA3DCoordinate CAAQuaternion::Rotate(const CAA3DCoordinate& value) const noexcept
+{
+  //Evaluates q * v * conjugate(q) using the expansion v + 2w(u x v) + 2u x (u x v), where u is the vector part of q
+  const double tX = 2 * ((Y*value.Z) - (Z*value.Y));
+  const double tY = 2 * ((Z*value.X) - (X*value.Z));
+  const double tZ = 2 * ((X*value.Y) - (Y*value.X));
+  CAA3DCoordinate result;
+  result.X = value.X + (W*tX) + ((Y*tZ) - (Z*tY));
+  result.Y = value.Y + (W*tY) + ((Z*tX) - (X*tZ));
+  result.Z = value.Z + (W*tZ) + ((X*tY) - (Y*tX));
+  return result;
+}
+
+CAAQuaternion CAAQuaternion::Slerp(const CAAQuaternion& other, double t) const noexcept
+{
+  //Spherical linear interpolation along the shorter arc between the two rotations
+  double Dot = (W*other.W) + (X*other.X) + (Y*other.Y) + (Z*other.Z);
+  CAAQuaternion end(other);
+  if (Dot < 0)
+  {
+    Dot = -Dot;
+    end = CAAQuaternion(-other.W, -other.X, -other.Y, -other.Z);
+  }
+
+  //Fall back to linear interpolation when the rotations are very close, to avoid dividing by sin(Theta) ~ 0
+  double s0 = 1 - t;
+  double s1 = t;
+  if (Dot < 0.9995)
+  {
+    const double Theta = acos(Dot);
+    const double sinTheta = sin(Theta);
+    s0 = sin((1 - t) * Theta) / sinTheta;
+    s1 = sin(t * Theta) / sinTheta;
+  }
+  return CAAQuaternion((s0*W) + (s1*end.W), (s0*X) + (s1*end.X), (s0*Y) + (s1*end.Y), (s0*Z) + (s1*end.Z)).Normalize();
+}
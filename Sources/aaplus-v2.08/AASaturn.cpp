@@ -41,6 +41,7 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AASaturn.h"
 #include "AACoordinateTransformation.h"
+#include "AAElliptical.h"
 #ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
 #include "AAVSOP87D_SAT.h"
 #endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
@@ -941,3 +942,56 @@ double CAASaturn::RadiusVector(double JD, bool bHighPrecision) noexcept
   
   return (R0 + R1*rho + R2*rhosquared + R3*rhocubed + R4*rho4 + R5*rho5) / 100000000;
 }
+
+CAASaturnEpoch::CAASaturnEpoch(double jd, bool highPrecision) noexcept : CAASaturnEpoch(CAAEarthEpoch(jd, highPrecision))
+{
+}
+
+CAASaturnEpoch::CAASaturnEpoch(const CAAEarthEpoch& earthEpoch, double PreviousLightTravelTime) noexcept : Earth(earthEpoch),
+                                                                                                      LightTravelTime(0),
+                                                                                                      SaturnJD(0),
+                                                                                                      EclipticLongitude(0),
+                                                                                                      EclipticLatitude(0),
+                                                                                                      RadiusVector(0),
+                                                                                                      X(0),
+                                                                                                      Y(0),
+                                                                                                      Z(0)
+{
+  const double JD = Earth.JD;
+  const bool bHighPrecision = Earth.bHighPrecision;
+
+  //Calculate the position of the Sun
+  const double sunlong = CAACoordinateTransformation::MapTo0To360Range(Earth.EclipticLongitude + 180);
+  const double sunlongrad = CAACoordinateTransformation::DegreesToRadians(sunlong);
+  const double beta = -Earth.EclipticLatitude;
+  const double betarad = CAACoordinateTransformation::DegreesToRadians(beta);
+  const double R = Earth.RadiusVector;
+
+  //Calculate the light travel time from Saturn to the Earth, starting from the previous light time if one is provided.
+  //The iteration continues until the light time changes by no more than 2e-6 days from the previous value
+  LightTravelTime = (PreviousLightTravelTime != 0) ? PreviousLightTravelTime : CAAElliptical::DistanceToLightTime(9);
+  SaturnJD = JD - LightTravelTime;
+  bool bIterate = true;
+  while (bIterate)
+  {
+    //Calculate the position of Saturn
+    EclipticLongitude = CAASaturn::EclipticLongitude(SaturnJD, bHighPrecision);
+    const double lrad = CAACoordinateTransformation::DegreesToRadians(EclipticLongitude);
+    EclipticLatitude = CAASaturn::EclipticLatitude(SaturnJD, bHighPrecision);
+    const double brad = CAACoordinateTransformation::DegreesToRadians(EclipticLatitude);
+    RadiusVector = CAASaturn::RadiusVector(SaturnJD, bHighPrecision);
+
+    X = RadiusVector*cos(brad)*cos(lrad) + R*cos(sunlongrad);
+    Y = RadiusVector*cos(brad)*sin(lrad) + R*sin(sunlongrad);
+    Z = RadiusVector*sin(brad) + R*sin(betarad);
+    LightTravelTime = CAAElliptical::DistanceToLightTime(sqrt(X*X + Y*Y + Z*Z));
+
+    //Prepare for the next loop around
+    bIterate = (fabs(LightTravelTime - PreviousLightTravelTime) > 2e-6); //2e-6 corresponds to 0.17 of a second
+    if (bIterate)
+    {
+      SaturnJD = JD - LightTravelTime;
+      PreviousLightTravelTime = LightTravelTime;
+    }
+  }
+}
@@ -35,12 +35,12 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AASaturnMoons.h"
 #include "AASaturn.h"
-#include "AASun.h"
 #include "AAEarth.h"
 #include "AAElliptical.h"
 #include "AACoordinateTransformation.h"
 #include "AAPrecession.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -75,43 +75,13 @@ void CAASaturnMoons::HelperSubroutine(double e, double lambdadash, double p, dou
   lambda = lambdadash + C + u - g - psi;
 }
 
-CAASaturnMoonsDetails CAASaturnMoons::CalculateHelper(double JD, double sunlongrad, double betarad, double R, bool bHighPrecision) noexcept
+CAASaturnMoonsDetails CAASaturnMoons::CalculateHelper(double JD, double x, double y, double z, double LightTravelTime) noexcept
 {
   //What will be the return value
   CAASaturnMoonsDetails details;
 
-  //Calculate the position of Saturn decreased by the light travel time from Saturn to the specified position
-  double DELTA = 9;
-  double PreviousLightTravelTime = 0;
-  double LightTravelTime = CAAElliptical::DistanceToLightTime(DELTA);
-  double x = 0;
-  double y = 0;
-  double z = 0;
-  double JD1 = JD - LightTravelTime;
-  bool   bIterate = true;
-  while (bIterate)
-  {
-    //Calculate the position of Saturn
-    const double l = CAASaturn::EclipticLongitude(JD1, bHighPrecision);
-    const double lrad = CAACoordinateTransformation::DegreesToRadians(l);
-    const double b = CAASaturn::EclipticLatitude(JD1, bHighPrecision);
-    const double brad = CAACoordinateTransformation::DegreesToRadians(b);
-    const double r = CAASaturn::RadiusVector(JD1, bHighPrecision);
-
-    x = r*cos(brad)*cos(lrad) + R*cos(sunlongrad);
-    y = r*cos(brad)*sin(lrad) + R*sin(sunlongrad);
-    z = r*sin(brad) + R*sin(betarad);
-    DELTA = sqrt(x*x + y*y + z*z);
-    LightTravelTime = CAAElliptical::DistanceToLightTime(DELTA);
-
-    //Prepare for the next loop around
-    bIterate = (fabs(LightTravelTime - PreviousLightTravelTime) > 2e-6); //2e-6 corresponds to 0.17 of a second
-    if (bIterate)
-    {
-      JD1 = JD - LightTravelTime;
-      PreviousLightTravelTime = LightTravelTime;
-    }
-  }
+  //The position of Saturn has already been decreased by the light travel time to the specified position
+  const double DELTA = sqrt(x*x + y*y + z*z);
 
   //Calculate Saturn's Longitude and Latitude
   double lambda0 = atan2(y, x);
@@ -540,48 +510,22 @@ CAASaturnMoonsDetails CAASaturnMoons::CalculateHelper(double JD, double sunlongr
 
 CAASaturnMoonsDetails CAASaturnMoons::Calculate(double JD, bool bHighPrecision) noexcept
 {
-  //Calculate the position of the Sun
-  const double sunlong = CAASun::GeometricEclipticLongitude(JD, bHighPrecision);
-  const double sunlongrad = CAACoordinateTransformation::DegreesToRadians(sunlong);
-  const double beta = CAASun::GeometricEclipticLatitude(JD, bHighPrecision);
-  const double betarad = CAACoordinateTransformation::DegreesToRadians(beta);
-  const double R = CAAEarth::RadiusVector(JD, bHighPrecision);
-
-  //Calculate the the light travel time from Saturn to the Earth
-  double DELTA = 9;
-  double PreviousEarthLightTravelTime = 0;
-  double EarthLightTravelTime = CAAElliptical::DistanceToLightTime(DELTA);
-  double JD1 = JD - EarthLightTravelTime;
-  bool bIterate = true;
-  double x = 0;
-  double y = 0;
-  double z = 0;
-  while (bIterate)
-  {
-    //Calculate the position of Jupiter
-    const double l = CAASaturn::EclipticLongitude(JD1, bHighPrecision);
-    const double lrad = CAACoordinateTransformation::DegreesToRadians(l);
-    const double b = CAASaturn::EclipticLatitude(JD1, bHighPrecision);
-    const double brad = CAACoordinateTransformation::DegreesToRadians(b);
-    const double r = CAASaturn::RadiusVector(JD1, bHighPrecision);
-
-    x = r*cos(brad)*cos(lrad) + R*cos(sunlongrad);
-    y = r*cos(brad)*sin(lrad) + R*sin(sunlongrad);
-    z = r*sin(brad) + R*sin(betarad);
-    DELTA = sqrt(x*x + y*y + z*z);
-    EarthLightTravelTime = CAAElliptical::DistanceToLightTime(DELTA);
+  return Calculate(CAAEarthEpoch(JD, bHighPrecision));
+}
 
-    //Prepare for the next loop around
-    bIterate = (fabs(EarthLightTravelTime - PreviousEarthLightTravelTime) > 2e-6); //2e-6 corresponds to 0.17 of a second
-    if (bIterate)
-    {
-      JD1 = JD - EarthLightTravelTime;
-      PreviousEarthLightTravelTime = EarthLightTravelTime;
-    }
-  }
+CAASaturnMoonsDetails CAASaturnMoons::Calculate(const CAAEarthEpoch& epoch) noexcept
+{
+  return Calculate(CAASaturnEpoch(epoch));
+}
+
+CAASaturnMoonsDetails CAASaturnMoons::Calculate(const CAASaturnEpoch& epoch) noexcept
+{
+  const double JD = epoch.Earth.JD;
+  const bool bHighPrecision = epoch.Earth.bHighPrecision;
+  const double EarthLightTravelTime = epoch.LightTravelTime;
 
   //Calculate the details as seen from the earth
-  CAASaturnMoonsDetails details1 = CalculateHelper(JD, sunlongrad, betarad, R, bHighPrecision);
+  CAASaturnMoonsDetails details1 = CalculateHelper(JD, epoch.X, epoch.Y, epoch.Z, EarthLightTravelTime);
   FillInPhenomenaDetails(details1.Satellite1);
   FillInPhenomenaDetails(details1.Satellite2);
   FillInPhenomenaDetails(details1.Satellite3);
@@ -592,20 +536,48 @@ CAASaturnMoonsDetails CAASaturnMoons::Calculate(double JD, bool bHighPrecision)
   FillInPhenomenaDetails(details1.Satellite8);
 
   //Calculate the the light travel time from Saturn to the Sun
-  JD1 = JD - EarthLightTravelTime;
-  const double l = CAASaturn::EclipticLongitude(JD1, bHighPrecision);
-  const double lrad = CAACoordinateTransformation::DegreesToRadians(l);
-  const double b = CAASaturn::EclipticLatitude(JD1, bHighPrecision);
-  const double brad = CAACoordinateTransformation::DegreesToRadians(b);
-  const double r = CAASaturn::RadiusVector(JD1, bHighPrecision);
-  x = r*cos(brad)*cos(lrad);
-  y = r*cos(brad)*sin(lrad);
-  z = r*sin(brad);
-  DELTA = sqrt(x*x + y*y + z*z);
-  const double SunLightTravelTime = CAAElliptical::DistanceToLightTime(DELTA);
+  const double JD1 = JD - EarthLightTravelTime;
+  double l = CAASaturn::EclipticLongitude(JD1, bHighPrecision);
+  double lrad = CAACoordinateTransformation::DegreesToRadians(l);
+  double b = CAASaturn::EclipticLatitude(JD1, bHighPrecision);
+  double brad = CAACoordinateTransformation::DegreesToRadians(b);
+  double r = CAASaturn::RadiusVector(JD1, bHighPrecision);
+  double x = r*cos(brad)*cos(lrad);
+  double y = r*cos(brad)*sin(lrad);
+  double z = r*sin(brad);
+  const double SunLightTravelTime = CAAElliptical::DistanceToLightTime(sqrt(x*x + y*y + z*z));
+
+  //Calculate the position of Saturn as seen from the Sun, decreased by the light travel time from Saturn to the Sun
+  const double SunJD = JD + SunLightTravelTime - EarthLightTravelTime;
+  double PreviousLightTravelTime = 0;
+  double LightTravelTime = CAAElliptical::DistanceToLightTime(9);
+  double JD2 = SunJD - LightTravelTime;
+  bool bIterate = true;
+  while (bIterate)
+  {
+    //Calculate the position of Saturn
+    l = CAASaturn::EclipticLongitude(JD2, bHighPrecision);
+    lrad = CAACoordinateTransformation::DegreesToRadians(l);
+    b = CAASaturn::EclipticLatitude(JD2, bHighPrecision);
+    brad = CAACoordinateTransformation::DegreesToRadians(b);
+    r = CAASaturn::RadiusVector(JD2, bHighPrecision);
+
+    x = r*cos(brad)*cos(lrad);
+    y = r*cos(brad)*sin(lrad);
+    z = r*sin(brad);
+    LightTravelTime = CAAElliptical::DistanceToLightTime(sqrt(x*x + y*y + z*z));
+
+    //Prepare for the next loop around
+    bIterate = (fabs(LightTravelTime - PreviousLightTravelTime) > 2e-6); //2e-6 corresponds to 0.17 of a second
+    if (bIterate)
+    {
+      JD2 = SunJD - LightTravelTime;
+      PreviousLightTravelTime = LightTravelTime;
+    }
+  }
 
   //Calculate the details as seen from the Sun
-  CAASaturnMoonsDetails details2 = CalculateHelper(JD + SunLightTravelTime - EarthLightTravelTime, sunlongrad, betarad, 0, bHighPrecision);
+  CAASaturnMoonsDetails details2 = CalculateHelper(SunJD, x, y, z, LightTravelTime);
   FillInPhenomenaDetails(details2.Satellite1);
   FillInPhenomenaDetails(details2.Satellite2);
   FillInPhenomenaDetails(details2.Satellite3);
@@ -636,6 +608,65 @@ CAASaturnMoonsDetails CAASaturnMoons::Calculate(double JD, bool bHighPrecision)
   return details1;
 }
 
+void CAASaturnMoons::Calculate(const double* pJD, CAASaturnMoonsDetails* pResults, size_t nCount, bool bHighPrecision) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  //The light time iteration for each date starts from the light time found for the previous date, which for
+  //closely spaced dates means Saturn is usually only evaluated once per date
+  double PreviousLightTravelTime = 0;
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const CAASaturnEpoch epoch(CAAEarthEpoch(pJD[i], bHighPrecision), PreviousLightTravelTime);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Calculate(epoch);
+    PreviousLightTravelTime = epoch.LightTravelTime;
+  }
+}
+
+void CAASaturnMoons::Calculate(const CAAEarthEpoch* pEpochs, CAASaturnMoonsDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pEpochs);
+  assert(pResults);
+
+  double PreviousLightTravelTime = 0;
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const CAASaturnEpoch epoch(pEpochs[i], PreviousLightTravelTime);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Calculate(epoch);
+    PreviousLightTravelTime = epoch.LightTravelTime;
+  }
+}
+
+void CAASaturnMoons::Calculate(const CAASaturnEpoch* pEpochs, CAASaturnMoonsDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pEpochs);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = Calculate(pEpochs[i]);
+  }
+}
+
 void CAASaturnMoons::Rotations(double X, double Y, double Z, double c1, double s1, double c2, double s2, double lambda0, double beta0, double& A4, double& B4, double& C4) noexcept
 {
   //Rotation towards the plane of the ecliptic
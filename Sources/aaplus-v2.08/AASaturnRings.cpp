@@ -41,15 +41,35 @@ to maintain a single distribution point for the source code.
 #include "AAFK5.h"
 #include "AANutation.h"
 #include "AACoordinateTransformation.h"
-#include "AAElliptical.h"
+#include "AAEventFinder.h"
 #include <cmath>
+#include <cassert>
+#include <algorithm>
 using namespace std;
 
 
+///////////////////////////////// Macros / Defines ////////////////////////////
+
+//The step used to bracket the crossings and extrema of the ring plane by the Sun. Bdash follows Saturn's 29.5
+//year orbit so a month is ample
+constexpr double AASATURNRINGS_SUN_STEP = 30;
+
+//The Earth can only cross the ring plane while the geocentric longitude of Saturn is within a few degrees of the
+//heliocentric one, as their difference is at most asin(R / (r - R)) or about 7.3 degrees, plus under a degree
+//from the geocentric latitude. At Saturn's slowest heliocentric motion of 0.030 degrees a day this bounds the
+//crossings by the Earth to within 270 days of a crossing by the Sun, which is rounded up to a year
+constexpr double AASATURNRINGS_CROSSING_WINDOW = 365.25;
+
+//The largest step used to sample B within each window, as the crossings by the Earth can be a few weeks apart
+constexpr double AASATURNRINGS_CROSSING_STEP = 1;
+
+
 //////////////////////////////// Implementation ///////////////////////////////
 
-CAASaturnRingDetails CAASaturnRings::Calculate(double JD, bool bHighPrecision) noexcept
+static CAASaturnRingDetails CalculateFromEpoch(const CAASaturnEpoch& epoch) noexcept
 {
+  const double JD = epoch.Earth.JD;
+
   //What will be the return value
   CAASaturnRingDetails details;
 
@@ -63,53 +83,30 @@ CAASaturnRingDetails CAASaturnRings::Calculate(double JD, bool bHighPrecision) n
   const double omegarad = CAACoordinateTransformation::DegreesToRadians(omega);
 
   //Step 2. Calculate the heliocentric longitude, latitude and radius vector of the Earth in the FK5 system
-  double l0 = CAAEarth::EclipticLongitude(JD, bHighPrecision);
-  double b0 = CAAEarth::EclipticLatitude(JD, bHighPrecision);
+  double l0 = epoch.Earth.EclipticLongitude;
+  double b0 = epoch.Earth.EclipticLatitude;
   l0 += CAAFK5::CorrectionInLongitude(l0, b0, JD);
   const double l0rad = CAACoordinateTransformation::DegreesToRadians(l0);
   b0 += CAAFK5::CorrectionInLatitude(l0, JD);
   const double b0rad = CAACoordinateTransformation::DegreesToRadians(b0);
-  const double R = CAAEarth::RadiusVector(JD, bHighPrecision);
-
-  //Step 3. Calculate the corresponding coordinates l,b,r for Saturn but for the instance t-lightraveltime
-  double DELTA = 9;
-  double PreviousEarthLightTravelTime = 0;
-  double EarthLightTravelTime = CAAElliptical::DistanceToLightTime(DELTA);
-  double JD1 = JD - EarthLightTravelTime;
-  bool   bIterate = true;
-  double x = 0;
-  double y = 0;
-  double z = 0;
-  double l = 0;
-  double b = 0;
-  double r = 0;
-  while (bIterate)
-  {
-    //Calculate the position of Saturn
-    l = CAASaturn::EclipticLongitude(JD1, bHighPrecision);
-    b = CAASaturn::EclipticLatitude(JD1, bHighPrecision);
-    l += CAAFK5::CorrectionInLongitude(l, b, JD1);
-    b += CAAFK5::CorrectionInLatitude(l, JD1);
-
-    const double lrad = CAACoordinateTransformation::DegreesToRadians(l);
-    const double brad = CAACoordinateTransformation::DegreesToRadians(b);
-    r = CAASaturn::RadiusVector(JD1, bHighPrecision);
-
-    //Step 4
-    x = r*cos(brad)*cos(lrad) - R*cos(l0rad);
-    y = r*cos(brad)*sin(lrad) - R*sin(l0rad);
-    z = r*sin(brad) - R*sin(b0rad);
-    DELTA = sqrt(x*x + y*y + z*z);
-    EarthLightTravelTime = CAAElliptical::DistanceToLightTime(DELTA);
-
-    //Prepare for the next loop around
-    bIterate = (fabs(EarthLightTravelTime - PreviousEarthLightTravelTime) > 2e-6); //2e-6 corresponds to 0.17 of a second
-    if (bIterate)
-    {
-      JD1 = JD - EarthLightTravelTime;
-      PreviousEarthLightTravelTime = EarthLightTravelTime;
-    }
-  }
+  const double R = epoch.Earth.RadiusVector;
+
+  //Step 3. Calculate the corresponding coordinates l,b,r for Saturn but for the instance t-lightraveltime. The light
+  //time iteration has already been performed by CAASaturnEpoch so only the FK5 correction remains to be applied
+  const double JD1 = epoch.SaturnJD;
+  double l = epoch.EclipticLongitude;
+  double b = epoch.EclipticLatitude;
+  l += CAAFK5::CorrectionInLongitude(l, b, JD1);
+  b += CAAFK5::CorrectionInLatitude(l, JD1);
+  const double lrad = CAACoordinateTransformation::DegreesToRadians(l);
+  const double brad = CAACoordinateTransformation::DegreesToRadians(b);
+  const double r = epoch.RadiusVector;
+
+  //Step 4
+  const double x = r*cos(brad)*cos(lrad) - R*cos(l0rad);
+  const double y = r*cos(brad)*sin(lrad) - R*sin(l0rad);
+  const double z = r*sin(brad) - R*sin(b0rad);
+  const double DELTA = sqrt(x*x + y*y + z*z);
 
   //Step 5. Calculate Saturn's geocentric Longitude and Latitude
   double lambda = atan2(y, x);
@@ -140,8 +137,8 @@ CAASaturnRingDetails CAASaturnRings::Calculate(double JD, bool bHighPrecision) n
    details.DeltaU = 360 - details.DeltaU;
 
   //Step 10. Calculate the Nutations 
-  const double Obliquity = CAANutation::TrueObliquityOfEcliptic(JD);
-  const double NutationInLongitude = CAANutation::NutationInLongitude(JD);
+  const double Obliquity = epoch.Earth.MeanObliquity + CAACoordinateTransformation::DMSToDegrees(0, 0, epoch.Earth.NutationInObliquity);
+  const double NutationInLongitude = epoch.Earth.NutationInLongitude;
 
   //Step 11. Calculate the Ecliptical longitude and latitude of the northern pole of the ring plane
   double lambda0 = omega - 90;
@@ -173,3 +170,179 @@ CAASaturnRingDetails CAASaturnRings::Calculate(double JD, bool bHighPrecision) n
 
   return details;
 }
+
+CAASaturnRingDetails CAASaturnRings::Calculate(double JD, bool bHighPrecision) noexcept
+{
+  return Calculate(CAAEarthEpoch(JD, bHighPrecision));
+}
+
+CAASaturnRingDetails CAASaturnRings::Calculate(const CAAEarthEpoch& epoch) noexcept
+{
+  return CalculateFromEpoch(CAASaturnEpoch(epoch));
+}
+
+CAASaturnRingDetails CAASaturnRings::Calculate(const CAASaturnEpoch& epoch) noexcept
+{
+  return CalculateFromEpoch(epoch);
+}
+
+void CAASaturnRings::Calculate(const double* pJD, CAASaturnRingDetails* pResults, size_t nCount, bool bHighPrecision) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  //The light time iteration for each date starts from the light time found for the previous date, which for
+  //closely spaced dates means Saturn is usually only evaluated once per date
+  double PreviousLightTravelTime = 0;
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const CAASaturnEpoch epoch(CAAEarthEpoch(pJD[i], bHighPrecision), PreviousLightTravelTime);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = CalculateFromEpoch(epoch);
+    PreviousLightTravelTime = epoch.LightTravelTime;
+  }
+}
+
+void CAASaturnRings::Calculate(const CAAEarthEpoch* pEpochs, CAASaturnRingDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pEpochs);
+  assert(pResults);
+
+  double PreviousLightTravelTime = 0;
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    const CAASaturnEpoch epoch(pEpochs[i], PreviousLightTravelTime);
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = CalculateFromEpoch(epoch);
+    PreviousLightTravelTime = epoch.LightTravelTime;
+  }
+}
+
+void CAASaturnRings::Calculate(const CAASaturnEpoch* pEpochs, CAASaturnRingDetails* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pEpochs);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = CalculateFromEpoch(pEpochs[i]);
+  }
+}
+
+static void AddEvents(const vector<CAAEventFinderDetails>& found, bool bSun, double StartJD, double EndJD, bool bHighPrecision, vector<CAASaturnRingEventDetails>& events)
+{
+  for (const auto& detail : found)
+  {
+    if ((detail.JD < StartJD) || (detail.JD >= EndJD))
+      continue;
+
+    CAASaturnRingEventDetails event;
+    event.JD = detail.JD;
+    switch (detail.type)
+    {
+      case CAAEventFinderDetails::Type::AscendingRoot:
+      {
+        event.type = bSun ? CAASaturnRingEventDetails::Type::SunCrossingNorthward : CAASaturnRingEventDetails::Type::EarthCrossingNorthward;
+        break;
+      }
+      case CAAEventFinderDetails::Type::DescendingRoot:
+      {
+        event.type = bSun ? CAASaturnRingEventDetails::Type::SunCrossingSouthward : CAASaturnRingEventDetails::Type::EarthCrossingSouthward;
+        break;
+      }
+      case CAAEventFinderDetails::Type::Maximum:
+      {
+        event.type = bSun ? CAASaturnRingEventDetails::Type::SunMaximum : CAASaturnRingEventDetails::Type::EarthMaximum;
+        break;
+      }
+      case CAAEventFinderDetails::Type::Minimum:
+      {
+        event.type = bSun ? CAASaturnRingEventDetails::Type::SunMinimum : CAASaturnRingEventDetails::Type::EarthMinimum;
+        break;
+      }
+      default:
+      {
+        assert(false);
+        break;
+      }
+    }
+    const CAASaturnRingDetails details = CAASaturnRings::Calculate(event.JD, bHighPrecision);
+    event.B = details.B;
+    event.Bdash = details.Bdash;
+    events.push_back(event);
+  }
+}
+
+vector<CAASaturnRingEventDetails> CAASaturnRings::CalculateEvents(double StartJD, double EndJD, double StepInterval, bool bCrossings, bool bExtrema, bool bHighPrecision)
+{
+  //Validate our parameters
+  assert(StepInterval > 0);
+
+  //What will be the return value
+  vector<CAASaturnRingEventDetails> events;
+
+  //The samplers use the batch version of Calculate so that each light time iteration starts from the previous date
+  vector<CAASaturnRingDetails> details;
+  auto Sampler = [&details, bHighPrecision](const double* pJD, double* pValues, size_t nCount, bool bSun)
+  {
+    details.resize(nCount);
+    Calculate(pJD, details.data(), nCount, bHighPrecision);
+    for (size_t i=0; i<nCount; i++)
+    {
+    #ifdef _MSC_VER
+      #pragma warning(suppress : 26481)
+    #endif //#ifdef _MSC_VER
+      pValues[i] = bSun ? details[i].Bdash : details[i].B;
+    }
+  };
+  auto Bdash = [&Sampler](const double* pJD, double* pValues, size_t nCount) { Sampler(pJD, pValues, nCount, true); };
+  auto B = [&Sampler](const double* pJD, double* pValues, size_t nCount) { Sampler(pJD, pValues, nCount, false); };
+
+  //First find the crossings and extrema of Bdash on a coarse grid. The crossings are also needed just outside of
+  //the range, since they bound the crossings by the Earth which may still fall inside it
+  const double Margin = bCrossings ? AASATURNRINGS_CROSSING_WINDOW : 0;
+  const vector<CAAEventFinderDetails> SunEvents = CAAEventFinder::Calculate(StartJD - Margin, EndJD + Margin, AASATURNRINGS_SUN_STEP, CAAEventFinder::BatchFunction(Bdash), bCrossings, bExtrema);
+  AddEvents(SunEvents, true, StartJD, EndJD, bHighPrecision, events);
+
+  //Then only search for the crossings of B within a window around each crossing of Bdash, where a fine step is
+  //used since the Earth can cross the ring plane up to three times in a few months
+  if (bCrossings)
+  {
+    const double CrossingStep = min(StepInterval, AASATURNRINGS_CROSSING_STEP);
+    for (const auto& SunEvent : SunEvents)
+    {
+      if ((SunEvent.type != CAAEventFinderDetails::Type::AscendingRoot) && (SunEvent.type != CAAEventFinderDetails::Type::DescendingRoot))
+        continue;
+      const double WindowStartJD = max(StartJD, SunEvent.JD - AASATURNRINGS_CROSSING_WINDOW);
+      const double WindowEndJD = min(EndJD, SunEvent.JD + AASATURNRINGS_CROSSING_WINDOW);
+      if (WindowStartJD < WindowEndJD)
+        AddEvents(CAAEventFinder::Calculate(WindowStartJD, WindowEndJD, CrossingStep, CAAEventFinder::BatchFunction(B), true, false), false, StartJD, EndJD, bHighPrecision, events);
+    }
+  }
+
+  //The parallax of the Earth gives B an annual oscillation of a few degrees on top of the motion of Bdash, so it
+  //has a maximum and minimum in most years. These are sampled over the whole range at the requested step
+  if (bExtrema)
+    AddEvents(CAAEventFinder::Calculate(StartJD, EndJD, StepInterval, CAAEventFinder::BatchFunction(B), false, true), false, StartJD, EndJD, bHighPrecision, events);
+
+  //Put the events back into time order
+  stable_sort(events.begin(), events.end(), [](const CAASaturnRingEventDetails& a, const CAASaturnRingEventDetails& b) noexcept { return a.JD < b.JD; });
+
+  return events;
+}
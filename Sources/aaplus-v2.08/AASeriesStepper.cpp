@@ -0,0 +1,262 @@
+/*
+Module : AASeriesStepper.cpp
+Purpose: Implementation for the incremental evaluation of trigonometric series at equally spaced times
+Created: 18-10-2026
+History: None
+
+*/
+
+
+////////////////////// Includes ///////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AASeriesStepper.h"
+#include <cmath>
+#include <cassert>
+using namespace std;
+
+
+////////////////////// Macros / Defines ///////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26481 26482)
+#endif //#ifdef _MSC_VER
+
+constexpr int AASERIESSTEPPER_MAX_ORDER = 4;
+
+
+////////////////////// Implementation /////////////////////////////////////////
+
+CAASeriesStepper::CAASeriesStepper(double TimeUnit, double StepInterval, int nAnchorInterval) noexcept : m_TimeUnit(TimeUnit),
+                                                                                                         m_StepInterval(StepInterval),
+                                                                                                         m_nAnchorInterval(nAnchorInterval)
+{
+  //Validate our parameters
+  assert(TimeUnit > 0);
+  assert(StepInterval != 0);
+  assert(nAnchorInterval > 0);
+}
+
+void CAASeriesStepper::AddTerm(double Amplitude, bool bSine, int nPower, const double* pPhase, int nPhaseSize)
+{
+  //Validate our parameters
+  assert(pPhase);
+  assert((nPhaseSize >= 1) && (nPhaseSize <= (AASERIESSTEPPER_MAX_ORDER + 1)));
+  assert(nPower >= 0);
+  assert(!m_bAnchored);
+
+  //Consecutive terms of the same kind share a block, which keeps the summation order of the series
+  const int nOrder = nPhaseSize - 1;
+  if (m_Blocks.empty() || (m_Blocks.back().nPower != nPower) || (m_Blocks.back().nOrder != nOrder) || (m_Blocks.back().bSine != bSine))
+  {
+    Block block;
+    block.nPower = nPower;
+    block.nOrder = nOrder;
+    block.bSine = bSine;
+    m_Blocks.push_back(block);
+  }
+  Block& block = m_Blocks.back();
+  block.Amplitudes.push_back(Amplitude);
+  for (int i=0; i<=nOrder; i++)
+    block.Phases.push_back(pPhase[i]);
+  block.Rotors.resize(block.Rotors.size() + (2 * (nOrder + 1)));
+}
+
+void CAASeriesStepper::Anchor(double JD)
+{
+  m_StartJD = JD;
+  m_bAnchored = true;
+  AnchorAtStep(0);
+}
+
+void CAASeriesStepper::AnchorAtStep(long nStep) noexcept
+{
+  m_nStep = nStep;
+  m_nAnchorStep = nStep;
+
+  //The powers of T at the anchor and of the step in units of T
+  const double T = (JD() - 2451545) / m_TimeUnit;
+  const double h = m_StepInterval / m_TimeUnit;
+  double TPowers[AASERIESSTEPPER_MAX_ORDER + 1] = { 1, 0, 0, 0, 0 };
+  double hPowers[AASERIESSTEPPER_MAX_ORDER + 1] = { 1, 0, 0, 0, 0 };
+  for (int i=1; i<=AASERIESSTEPPER_MAX_ORDER; i++)
+  {
+    TPowers[i] = TPowers[i - 1] * T;
+    hPowers[i] = hPowers[i - 1] * h;
+  }
+  constexpr const double Binomials[AASERIESSTEPPER_MAX_ORDER + 1][AASERIESSTEPPER_MAX_ORDER + 1] = { { 1, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0 }, { 1, 2, 1, 0, 0 }, { 1, 3, 3, 1, 0 }, { 1, 4, 6, 4, 1 } };
+
+  for (auto& block : m_Blocks)
+  {
+    const int nOrder = block.nOrder;
+    const size_t nTerms = block.Amplitudes.size();
+    for (size_t i=0; i<nTerms; i++)
+    {
+      const double* pPhase = block.Phases.data() + (i * (nOrder + 1));
+      double* pRotors = block.Rotors.data() + (i * 2 * (nOrder + 1));
+
+      //The phase at the anchor, summed in the same order as the direct evaluation of the series
+      double Phase = pPhase[0];
+      for (int m=1; m<=nOrder; m++)
+        Phase += (pPhase[m] * TPowers[m]);
+
+      //Write the phase as the polynomial a0 + a1*n + ... in the step number n, from which the forward differences
+      //follow using the Stirling numbers of the second kind
+      double a[AASERIESSTEPPER_MAX_ORDER + 1] = { 0, 0, 0, 0, 0 };
+      for (int j=1; j<=nOrder; j++)
+      {
+        double Coefficient = 0;
+        for (int m=j; m<=nOrder; m++)
+          Coefficient += (Binomials[m][j] * pPhase[m] * TPowers[m - j]);
+        a[j] = Coefficient * hPowers[j];
+      }
+      const double Differences[AASERIESSTEPPER_MAX_ORDER + 1] = { Phase,
+                                                                  a[1] + a[2] + a[3] + a[4],
+                                                                  (2 * a[2]) + (6 * a[3]) + (14 * a[4]),
+                                                                  (6 * a[3]) + (36 * a[4]),
+                                                                  24 * a[4] };
+      for (int k=0; k<=nOrder; k++)
+      {
+        pRotors[2 * k] = cos(Differences[k]);
+        pRotors[(2 * k) + 1] = sin(Differences[k]);
+      }
+    }
+  }
+}
+
+void CAASeriesStepper::Step() noexcept
+{
+  //Validate our parameters
+  assert(m_bAnchored);
+
+  ++m_nStep;
+  if ((m_nStep - m_nAnchorStep) >= m_nAnchorInterval)
+  {
+    AnchorAtStep(m_nStep);
+    return;
+  }
+
+  //Advance each phase by its first difference and each difference by the next one up
+  for (auto& block : m_Blocks)
+  {
+    const int nOrder = block.nOrder;
+    const size_t nRotors = block.Rotors.size();
+    double* pRotors = block.Rotors.data();
+    if (nOrder == 1)
+    {
+      //The linear phases of VSOP87 and most of ELP2000 are just a rotation by a fixed angle
+      for (size_t i=0; i<nRotors; i+=4)
+      {
+        const double c = pRotors[i];
+        const double s = pRotors[i + 1];
+        const double dc = pRotors[i + 2];
+        const double ds = pRotors[i + 3];
+        pRotors[i] = (c * dc) - (s * ds);
+        pRotors[i + 1] = (s * dc) + (c * ds);
+      }
+    }
+    else
+    {
+      for (size_t i=0; i<nRotors; i+=(2 * (nOrder + 1)))
+      {
+        for (int k=0; k<nOrder; k++)
+        {
+          const size_t j = i + (2 * k);
+          const double c = pRotors[j];
+          const double s = pRotors[j + 1];
+          const double dc = pRotors[j + 2];
+          const double ds = pRotors[j + 3];
+          pRotors[j] = (c * dc) - (s * ds);
+          pRotors[j + 1] = (s * dc) + (c * ds);
+        }
+      }
+    }
+  }
+}
+
+double CAASeriesStepper::Value() const noexcept
+{
+  //Validate our parameters
+  assert(m_bAnchored);
+
+  const double T = (JD() - 2451545) / m_TimeUnit;
+  double Result = 0;
+  for (const auto& block : m_Blocks)
+  {
+    const size_t nTerms = block.Amplitudes.size();
+    const size_t nStride = 2 * (block.nOrder + 1);
+    const double* pRotors = block.Rotors.data() + (block.bSine ? 1 : 0);
+    double BlockResult = 0;
+    for (size_t i=0; i<nTerms; i++)
+      BlockResult += (block.Amplitudes[i] * pRotors[i * nStride]);
+    double TTerm = 1;
+    for (int i=0; i<block.nPower; i++)
+      TTerm *= T;
+    Result += (BlockResult * TTerm);
+  }
+
+  return Result;
+}
+
+double CAASeriesStepper::Evaluate(double JD) const noexcept
+{
+  //Sum the series directly, which is used for dates which are not on the grid of steps
+  const double T = (JD - 2451545) / m_TimeUnit;
+  double TPowers[AASERIESSTEPPER_MAX_ORDER + 1] = { 1, 0, 0, 0, 0 };
+  for (int i=1; i<=AASERIESSTEPPER_MAX_ORDER; i++)
+    TPowers[i] = TPowers[i - 1] * T;
+
+  double Result = 0;
+  for (const auto& block : m_Blocks)
+  {
+    const int nOrder = block.nOrder;
+    const size_t nTerms = block.Amplitudes.size();
+    double BlockResult = 0;
+    for (size_t i=0; i<nTerms; i++)
+    {
+      const double* pPhase = block.Phases.data() + (i * (nOrder + 1));
+      double Phase = pPhase[0];
+      for (int m=1; m<=nOrder; m++)
+        Phase += (pPhase[m] * TPowers[m]);
+      BlockResult += (block.Amplitudes[i] * (block.bSine ? sin(Phase) : cos(Phase)));
+    }
+    double TTerm = 1;
+    for (int i=0; i<block.nPower; i++)
+      TTerm *= T;
+    Result += (BlockResult * TTerm);
+  }
+
+  return Result;
+}
+
+double CAASeriesStepper::Calculate(double JD)
+{
+  //The first date requested becomes the start of the grid of steps
+  if (!m_bAnchored)
+  {
+    Anchor(JD);
+    return Value();
+  }
+
+  //Step the series if the date is the current or next point on the grid
+  const double Tolerance = fabs(m_StepInterval) * 1e-6;
+  const double CurrentJD = CAASeriesStepper::JD();
+  if (fabs(JD - CurrentJD) <= Tolerance)
+    return Value();
+  if (fabs(JD - (CurrentJD + m_StepInterval)) <= Tolerance)
+  {
+    Step();
+    return Value();
+  }
+
+  //Re-anchor if the date is any other point on the grid (for example when a date has been skipped), so that stepping
+  //resumes from there. Only dates which are off the grid, such as those used to refine an event between two steps,
+  //fall back to the direct sum so that they do not disturb the stepping
+  const long nStep = lround((JD - m_StartJD) / m_StepInterval);
+  if (fabs(JD - (m_StartJD + (nStep * m_StepInterval))) <= Tolerance)
+  {
+    AnchorAtStep(nStep);
+    return Value();
+  }
+  return Evaluate(JD);
+}
@@ -29,6 +29,7 @@ to maintain a single distribution point for the source code.
 #include "AANutation.h"
 #include "AADate.h"
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
@@ -64,12 +65,132 @@ double CAASidereal::MeanGreenwichSiderealTime(double JD) noexcept
   return CAACoordinateTransformation::MapTo0To24Range(Value);
 }
 
-double CAASidereal::ApparentGreenwichSiderealTime(double JD) noexcept
+double CAASidereal::EquationOfTheEquinoxes(double JD) noexcept
 {
   const double MeanObliquity = CAANutation::MeanObliquityOfEcliptic(JD);
   const double TrueObliquity = MeanObliquity + CAANutation::NutationInObliquity(JD) / 3600;
   const double NutationInLongitude = CAANutation::NutationInLongitude(JD);
 
-  const double Value = MeanGreenwichSiderealTime(JD) + (NutationInLongitude  * cos(CAACoordinateTransformation::DegreesToRadians(TrueObliquity)) / 54000);
+  return NutationInLongitude * cos(CAACoordinateTransformation::DegreesToRadians(TrueObliquity)) / 54000;
+}
+
+double CAASidereal::ApparentGreenwichSiderealTime(double JD) noexcept
+{
+  const double Value = MeanGreenwichSiderealTime(JD) + EquationOfTheEquinoxes(JD);
   return CAACoordinateTransformation::MapTo0To24Range(Value);
 }
+
+void CAASidereal::MeanGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = MeanGreenwichSiderealTime(pJD[i]);
+  }
+}
+
+void CAASidereal::ApparentGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = ApparentGreenwichSiderealTime(pJD[i]);
+  }
+}
+
+CAASiderealTime::CAASiderealTime(double StartJD, double EndJD, double GridInterval) : m_StartJD(StartJD),
+                                                                                       m_GridInterval(GridInterval)
+{
+  //Validate our parameters
+  assert(EndJD >= StartJD);
+  assert(GridInterval > 0);
+
+  //Cache the equation of the equinoxes at each grid point, with an extra point before and two after the range so that every interval in the range has a full 4 point stencil
+  m_StartJD -= GridInterval;
+  const size_t nPoints = static_cast<size_t>(ceil((EndJD - StartJD) / GridInterval)) + 4;
+  m_EquationOfTheEquinoxes.resize(nPoints);
+  for (size_t i=0; i<nPoints; i++)
+    m_EquationOfTheEquinoxes[i] = CAASidereal::EquationOfTheEquinoxes(m_StartJD + (i * GridInterval));
+}
+
+double CAASiderealTime::MeanGreenwichSiderealTime(double JD) noexcept
+{
+  //Split the days since J2000 into whole and fractional days. The whole days are then only multiplied by the excess of
+  //360.98564736629 over 360 degrees, which keeps the size of the intermediate values (and hence the rounding errors) small
+  const double D = JD - 2451545;
+  const double WholeDays = floor(D);
+  const double FractionalDays = D - WholeDays;
+  const double T = D / 36525;
+  const double TSquared = T*T;
+  const double TCubed = TSquared*T;
+  const double Value = 280.46061837 + fmod(0.98564736629*WholeDays, 360) + (360.98564736629*FractionalDays) + (0.000387933*TSquared) - (TCubed/38710000);
+
+  return CAACoordinateTransformation::DegreesToHours(CAACoordinateTransformation::MapTo0To360Range(Value));
+}
+
+void CAASiderealTime::MeanGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = MeanGreenwichSiderealTime(pJD[i]);
+  }
+}
+
+double CAASiderealTime::EquationOfTheEquinoxes(double JD) const noexcept
+{
+  //Fall back to the full calculation outside of the cached range
+  const double X = (JD - m_StartJD) / m_GridInterval;
+  const size_t nPoints = m_EquationOfTheEquinoxes.size();
+  if ((nPoints < 4) || (X < 1) || (X > (nPoints - 2)))
+    return CAASidereal::EquationOfTheEquinoxes(JD);
+
+  //4 point Lagrange interpolation about the interval containing JD
+  size_t nIndex = static_cast<size_t>(X);
+  if (nIndex > (nPoints - 3))
+    nIndex = nPoints - 3;
+  const double p = X - nIndex;
+  const double Y0 = m_EquationOfTheEquinoxes[nIndex - 1];
+  const double Y1 = m_EquationOfTheEquinoxes[nIndex];
+  const double Y2 = m_EquationOfTheEquinoxes[nIndex + 1];
+  const double Y3 = m_EquationOfTheEquinoxes[nIndex + 2];
+  return (-p*(p - 1)*(p - 2)*Y0/6) + ((p + 1)*(p - 1)*(p - 2)*Y1/2) - ((p + 1)*p*(p - 2)*Y2/2) + ((p + 1)*p*(p - 1)*Y3/6);
+}
+
+double CAASiderealTime::ApparentGreenwichSiderealTime(double JD) const noexcept
+{
+  return CAACoordinateTransformation::MapTo0To24Range(MeanGreenwichSiderealTime(JD) + EquationOfTheEquinoxes(JD));
+}
+
+void CAASiderealTime::ApparentGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) const noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = ApparentGreenwichSiderealTime(pJD[i]);
+  }
+}
@@ -47,12 +47,92 @@ to maintain a single distribution point for the source code.
 #include "AAEarth.h"
 #include "AAFK5.h"
 #include "AANutation.h"
+#include "AAEquationOfTime.h"
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+#include "AAVSOP87D_EAR.h"
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
 #include <cmath>
+#include <cassert>
 using namespace std;
 
 
+//////////////////////////// Macros / Defines /////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 26446 26482)
+#endif //#ifdef _MSC_VER
+
+struct VariationCoefficient
+{
+  double A;
+  int    nPower; //The power of tau which multiplies the term
+  double B;      //In degrees
+  double C;      //In degrees per millennium
+};
+
+const VariationCoefficient g_VariationCoefficients[] =
+{
+  { 118.568, 0, 87.5287,  359993.7286  },
+  { 2.476,   0, 85.0561,  719987.4571  },
+  { 1.376,   0, 27.8502,  4452671.1152 },
+  { 0.119,   0, 73.1375,  450368.8564  },
+  { 0.114,   0, 337.2264, 329644.6718  },
+  { 0.086,   0, 222.5400, 659289.3436  },
+  { 0.078,   0, 162.8136, 9224659.7915 },
+  { 0.054,   0, 82.5823,  1079981.1857 },
+  { 0.052,   0, 171.5189, 225184.4282  },
+  { 0.034,   0, 30.3214,  4092677.3866 },
+  { 0.033,   0, 119.8105, 337181.4711  },
+  { 0.023,   0, 247.5418, 299295.6151  },
+  { 0.023,   0, 325.1526, 315559.5560  },
+  { 0.021,   0, 155.1241, 675553.2846  },
+  { 7.311,   1, 333.4515, 359993.7286  },
+  { 0.305,   1, 330.9814, 719987.4571  },
+  { 0.010,   1, 328.5170, 1079981.1857 },
+  { 0.309,   2, 241.4518, 359993.7286  },
+  { 0.021,   2, 205.0482, 719987.4571  },
+  { 0.004,   2, 297.8610, 4452671.1152 },
+  { 0.010,   3, 154.7066, 359993.7286  }
+};
+
+
 //////////////////////////// Implementation ///////////////////////////////////
 
+//Completes the apparent position of the Sun from the heliocentric position of the Earth (L & B in degrees), the
+//nutation and the variation of the Sun's longitude (in arcseconds, only used if bHighPrecision is true), in the
+//same order of operations as ApparentEclipticLongitude, ApparentEclipticLatitude & CAAEquationOfTime::Calculate
+static CAASunApparentPositionDetails SunApparentPosition(double JD, double L, double B, double R, double NutationInLongitude, double NutationInObliquity, double Variation, bool bHighPrecision) noexcept
+{
+  CAASunApparentPositionDetails details;
+  details.RadiusVector = R;
+  details.NutationInLongitude = NutationInLongitude;
+
+  //Convert to the geocentric position of the Sun in the FK5 system
+  const double Longitude = CAACoordinateTransformation::MapTo0To360Range(L + 180);
+  const double Latitude = -B;
+  details.ApparentEclipticLongitude = Longitude + CAAFK5::CorrectionInLongitude(Longitude, Latitude, JD);
+  details.ApparentEclipticLatitude = Latitude + CAAFK5::CorrectionInLatitude(Longitude, JD);
+
+  //Apply the correction in longitude due to nutation
+  details.ApparentEclipticLongitude += CAACoordinateTransformation::DMSToDegrees(0, 0, NutationInLongitude);
+
+  //Apply the correction in longitude due to aberration
+  if (bHighPrecision)
+    details.ApparentEclipticLongitude -= (0.005775518 * R * CAACoordinateTransformation::DMSToDegrees(0, 0, Variation));
+  else
+    details.ApparentEclipticLongitude -= CAACoordinateTransformation::DMSToDegrees(0, 0, 20.4898 / R);
+
+  //Convert to the true equator and equinox of date
+  details.TrueObliquity = CAANutation::MeanObliquityOfEcliptic(JD) + CAACoordinateTransformation::DMSToDegrees(0, 0, NutationInObliquity);
+  const CAA2DCoordinate Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(details.ApparentEclipticLongitude, details.ApparentEclipticLatitude, details.TrueObliquity);
+  details.ApparentRightAscension = Equatorial.X;
+  details.ApparentDeclination = Equatorial.Y;
+  details.EquationOfTime = CAAEquationOfTime::Calculate(JD, details.ApparentRightAscension, NutationInLongitude, details.TrueObliquity);
+
+  return details;
+}
+
+
 double CAASun::GeometricEclipticLongitude(double JD, bool bHighPrecision) noexcept
 {
   return CAACoordinateTransformation::MapTo0To360Range(CAAEarth::EclipticLongitude(JD, bHighPrecision) + 180);
@@ -179,29 +259,83 @@ double CAASun::VariationGeometricEclipticLongitude(double JD) noexcept
   const double tau = (D / 365250);
   const double tau2 = tau * tau;
   const double tau3 = tau2 * tau;
+  const double tauPowers[4] = { 1, tau, tau2, tau3 };
 
-  const double deltaLambda = 3548.193
-                             + 118.568 * sin(CAACoordinateTransformation::DegreesToRadians(87.5287 + 359993.7286 * tau))
-                             + 2.476 * sin(CAACoordinateTransformation::DegreesToRadians(85.0561 + 719987.4571 * tau))
-                             + 1.376 * sin(CAACoordinateTransformation::DegreesToRadians(27.8502 + 4452671.1152 * tau))
-                             + 0.119 * sin(CAACoordinateTransformation::DegreesToRadians(73.1375 + 450368.8564 * tau))
-                             + 0.114 * sin(CAACoordinateTransformation::DegreesToRadians(337.2264 + 329644.6718 * tau))
-                             + 0.086 * sin(CAACoordinateTransformation::DegreesToRadians(222.5400 + 659289.3436 * tau))
-                             + 0.078 * sin(CAACoordinateTransformation::DegreesToRadians(162.8136 + 9224659.7915 * tau))
-                             + 0.054 * sin(CAACoordinateTransformation::DegreesToRadians(82.5823 + 1079981.1857 * tau))
-                             + 0.052 * sin(CAACoordinateTransformation::DegreesToRadians(171.5189 + 225184.4282 * tau))
-                             + 0.034 * sin(CAACoordinateTransformation::DegreesToRadians(30.3214 + 4092677.3866 * tau))
-                             + 0.033 * sin(CAACoordinateTransformation::DegreesToRadians(119.8105 + 337181.4711 * tau))
-                             + 0.023 * sin(CAACoordinateTransformation::DegreesToRadians(247.5418 + 299295.6151 * tau))
-                             + 0.023 * sin(CAACoordinateTransformation::DegreesToRadians(325.1526 + 315559.5560 * tau))
-                             + 0.021 * sin(CAACoordinateTransformation::DegreesToRadians(155.1241 + 675553.2846 * tau))
-                             + 7.311 * tau * sin(CAACoordinateTransformation::DegreesToRadians(333.4515 + 359993.7286 * tau))
-                             + 0.305 * tau * sin(CAACoordinateTransformation::DegreesToRadians(330.9814 + 719987.4571 * tau))
-                             + 0.010 * tau * sin(CAACoordinateTransformation::DegreesToRadians(328.5170 + 1079981.1857 * tau))
-                             + 0.309 * tau2 * sin(CAACoordinateTransformation::DegreesToRadians(241.4518 + 359993.7286 * tau))
-                             + 0.021 * tau2 * sin(CAACoordinateTransformation::DegreesToRadians(205.0482 + 719987.4571 * tau))
-                             + 0.004 * tau2 * sin(CAACoordinateTransformation::DegreesToRadians(297.8610 + 4452671.1152 * tau))
-                             + 0.010 * tau3 * sin(CAACoordinateTransformation::DegreesToRadians(154.7066 + 359993.7286 * tau));
+  double deltaLambda = 3548.193;
+  for (const auto& coefficient : g_VariationCoefficients)
+    deltaLambda += coefficient.A * tauPowers[coefficient.nPower] * sin(CAACoordinateTransformation::DegreesToRadians(coefficient.B + coefficient.C * tau));
 
   return deltaLambda;
 }
+
+CAASunApparentPositionDetails CAASun::ApparentPosition(double JD, bool bHighPrecision) noexcept
+{
+  const double L = CAAEarth::EclipticLongitude(JD, bHighPrecision);
+  const double B = CAAEarth::EclipticLatitude(JD, bHighPrecision);
+  const double R = CAAEarth::RadiusVector(JD, bHighPrecision);
+  const double Variation = bHighPrecision ? VariationGeometricEclipticLongitude(JD) : 0;
+  return SunApparentPosition(JD, L, B, R, CAANutation::NutationInLongitude(JD), CAANutation::NutationInObliquity(JD), Variation, bHighPrecision);
+}
+
+void CAASun::ApparentPosition(const double* pJD, CAASunApparentPositionDetails* pResults, size_t nCount, bool bHighPrecision) noexcept
+{
+  //Validate our parameters
+  assert(pJD);
+  assert(pResults);
+
+  for (size_t i=0; i<nCount; i++)
+  {
+  #ifdef _MSC_VER
+    #pragma warning(suppress : 26481)
+  #endif //#ifdef _MSC_VER
+    pResults[i] = ApparentPosition(pJD[i], bHighPrecision);
+  }
+}
+
+CAASunStepper::CAASunStepper(double StartJD, double StepInterval, bool bHighPrecision) : m_bHighPrecision(bHighPrecision),
+                                                                                         m_Nutation(StartJD, StepInterval)
+{
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  if (bHighPrecision)
+  {
+    m_L = CAAVSOP87D_Earth::L_Stepper(StartJD, StepInterval);
+    m_B = CAAVSOP87D_Earth::B_Stepper(StartJD, StepInterval);
+    m_R = CAAVSOP87D_Earth::R_Stepper(StartJD, StepInterval);
+  }
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  if (bHighPrecision)
+  {
+    m_Variation = CAASeriesStepper(365250, StepInterval);
+    for (const auto& coefficient : g_VariationCoefficients)
+    {
+      const double Phase[2] = { CAACoordinateTransformation::DegreesToRadians(coefficient.B), CAACoordinateTransformation::DegreesToRadians(coefficient.C) };
+      m_Variation.AddTerm(coefficient.A, true, coefficient.nPower, Phase, 2);
+    }
+    m_Variation.Anchor(StartJD);
+  }
+}
+
+CAASunApparentPositionDetails CAASunStepper::Calculate(double JD)
+{
+  //The heliocentric position of the Earth
+  double L = 0;
+  double B = 0;
+  double R = 0;
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  if (m_bHighPrecision)
+  {
+    L = CAACoordinateTransformation::MapTo0To360Range(CAACoordinateTransformation::RadiansToDegrees(m_L.Calculate(JD)));
+    B = CAACoordinateTransformation::MapToMinus90To90Range(CAACoordinateTransformation::RadiansToDegrees(m_B.Calculate(JD)));
+    R = m_R.Calculate(JD);
+  }
+  else
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  {
+    L = CAAEarth::EclipticLongitude(JD, m_bHighPrecision);
+    B = CAAEarth::EclipticLatitude(JD, m_bHighPrecision);
+    R = CAAEarth::RadiusVector(JD, m_bHighPrecision);
+  }
+  const double Variation = m_bHighPrecision ? (3548.193 + m_Variation.Calculate(JD)) : 0;
+
+  return SunApparentPosition(JD, L, B, R, m_Nutation.NutationInLongitude(JD), m_Nutation.NutationInObliquity(JD), Variation, m_bHighPrecision);
+}
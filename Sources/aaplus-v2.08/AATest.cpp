@@ -7,6 +7,8 @@
 #include <cassert>
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <random>
 using namespace std;
 
 
@@ -604,6 +606,13 @@ int main()
   ELP2000 = CAAELP2000::EclipticRectangularCoordinatesJ2000(2429000.5);
   ELP2000 = CAAELP2000::EclipticRectangularCoordinatesJ2000(2409000.5);
   ELP2000 = CAAELP2000::EclipticRectangularCoordinatesJ2000(2389000.5);
+
+  //Test out the CAAELP2000Stepper class, stepping the Moon's longitude every hour for 10 days
+  CAAELP2000Stepper MoonStepper(2469000.5, 1.0 / 24);
+  double fSteppedLongitude = 0;
+  for (int i=0; i<=240; i++)
+    fSteppedLongitude = MoonStepper.EclipticLongitude(2469000.5 + (i / 24.0));
+  printf("Moon ecliptic longitude 10 days after JD 2469000.5 using CAAELP2000Stepper: %f, exact: %f\n", fSteppedLongitude, CAAELP2000::EclipticLongitude(2469010.5));
 #endif
 
 #ifndef AAPLUS_NO_ELPMPP02
@@ -1185,6 +1194,7 @@ int main()
     printf("Max northern declination of the Moon (using CAAMoonMaxDeclinations) (UTC) at declination %f, %d-%d-%d %02d:%02d:%02d\n", MoonDecValue, static_cast<int>(year), static_cast<int>(month), static_cast<int>(day), static_cast<int>(hour), static_cast<int>(minute), static_cast<int>(second));
   }
 
+#ifndef AAPLUS_NO_ELPMPP02
   constexpr std::array<std::pair<CAAMoonMaxDeclinations2::Algorithm, const char*>, 6> algos
   { {
     { CAAMoonMaxDeclinations2::Algorithm::MeeusTruncated,   "MeeusTruncated"   },
@@ -1194,6 +1204,13 @@ int main()
     { CAAMoonMaxDeclinations2::Algorithm::ELPMPP02DE405,    "ELPMPP02DE405"    },
     { CAAMoonMaxDeclinations2::Algorithm::ELPMPP02DE406,    "ELPMPP02DE406"    }
   } };
+#else
+  constexpr std::array<std::pair<CAAMoonMaxDeclinations2::Algorithm, const char*>, 2> algos
+  { {
+    { CAAMoonMaxDeclinations2::Algorithm::MeeusTruncated,   "MeeusTruncated"   },
+    { CAAMoonMaxDeclinations2::Algorithm::ELP2000,          "ELP2000"          }
+  } };
+#endif //#ifndef AAPLUS_NO_ELPMPP02
 
   //Calculate the max declinations for the Moon for 2019 using CAAMoonMaxDeclinations2
   for (const auto& algo : algos)
@@ -1237,6 +1254,37 @@ int main()
     }
   }
 
+  //Calculate the perihelion and aphelion of the Earth for 2019 using the generic CAAEventFinder class
+  std::vector<CAAEventFinderDetails> events4 = CAAEventFinder::Calculate(CAADynamicalTime::UTC2TT(2458484.5), CAADynamicalTime::UTC2TT(2458848.5), 1, [](double JD) { return CAAEarth::RadiusVector(JD, false); }, false, true);
+  for (const auto& event : events4)
+  {
+    const CAADate date_time(CAADynamicalTime::TT2UTC(event.JD), true);
+    long year = 0;
+    long month = 0;
+    long day = 0;
+    long hour = 0;
+    long minute = 0;
+    double second = 0;
+    date_time.Get(year, month, day, hour, minute, second);
+    printf("%s of the Earth (using CAAEventFinder) (UTC) at distance %f AU, %d-%d-%d %02d:%02d:%02d\n", (event.type == CAAEventFinderDetails::Type::Minimum) ? "Perihelion" : "Aphelion", event.Value, static_cast<int>(year), static_cast<int>(month), static_cast<int>(day), static_cast<int>(hour), static_cast<int>(minute), static_cast<int>(second));
+  }
+
+  //Calculate the phases, apsides and nodal passages of the Moon for January 2019 using the CAALunations class
+  std::vector<CAALunationEventDetails> events5 = CAALunations::Calculate(CAADynamicalTime::UTC2TT(2458484.5), CAADynamicalTime::UTC2TT(2458515.5));
+  for (const auto& event : events5)
+  {
+    const char* pszEvents[] = { "", "New Moon", "First Quarter", "Full Moon", "Last Quarter", "Perigee", "Apogee", "Ascending node", "Descending node" };
+    const CAADate date_time(CAADynamicalTime::TT2UTC(event.JD), true);
+    long year = 0;
+    long month = 0;
+    long day = 0;
+    long hour = 0;
+    long minute = 0;
+    double second = 0;
+    date_time.Get(year, month, day, hour, minute, second);
+    printf("%s of the Moon (using CAALunations) (UTC) with k %.2f, %d-%d-%d %02d:%02d:%02d\n", pszEvents[static_cast<int>(event.type)], event.k, static_cast<int>(year), static_cast<int>(month), static_cast<int>(day), static_cast<int>(hour), static_cast<int>(minute), static_cast<int>(second));
+  }
+
   //Print out an ASCII graphic of the moon phase for the month of April 2012 for 
   //the location of Wexford, Ireland. Thanks to Roger Dahl for providing this 
   //nice addition to AA+
@@ -1499,6 +1547,13 @@ int main()
   date.Set(333, 2, 6, 6, 0, 0, false);
   DeltaT = CAADynamicalTime::DeltaT(date.Julian());
   UNREFERENCED_PARAMETER(DeltaT);
+  const double DeltaTJDs[] = { 2443192.65118, 1842713.75, 2457754.5, 2488069.5 };
+  double DeltaTs[4];
+  CAADynamicalTime::DeltaT(DeltaTJDs, DeltaTs, 4);
+  double UTCs[4];
+  CAADynamicalTime::TT2UTC(DeltaTJDs, UTCs, 4);
+  for (int i=0; i<4; i++)
+    printf("DeltaT(%f)=%f, TT2UTC=%f\n", DeltaTJDs[i], DeltaTs[i], UTCs[i]);
 
   //Test out the AAGlobe class
   const double rhosintheta = CAAGlobe::RhoSinThetaPrime(33.356111, 1706);
@@ -1525,6 +1580,17 @@ int main()
   const double Distance5 = CAAGlobe::DistanceBetweenPoints(CAACoordinateTransformation::DMSToDegrees(89, 59, 0), 0, CAACoordinateTransformation::DMSToDegrees(89, 59, 0), 90);
   UNREFERENCED_PARAMETER(Distance5);
 
+  //Test out the batch versions of the AAGlobe class for the two sites of example 11.c and the observatory of example 11.a
+  const double SiteLatitudes[3] = { CAACoordinateTransformation::DMSToDegrees(48, 50, 11), CAACoordinateTransformation::DMSToDegrees(38, 55, 17), 33.356111 };
+  const double SiteLongitudes[3] = { CAACoordinateTransformation::DMSToDegrees(2, 20, 14, false), CAACoordinateTransformation::DMSToDegrees(77, 3, 56), CAACoordinateTransformation::DMSToDegrees(116, 51, 45) };
+  const double SiteHeights[3] = { 0, 0, 1706 };
+  double SiteDistances[9];
+  CAAGlobe::DistanceMatrix(SiteLatitudes, SiteLongitudes, SiteDistances, 3);
+  printf("Distance from Paris to Washington: %f km, Paris to Palomar: %f km, Washington to Palomar: %f km\n", SiteDistances[1], SiteDistances[2], SiteDistances[5]);
+  std::array<CAAObserver, 3> SiteObservers;
+  CAAGlobe::Observers(SiteLongitudes, SiteLatitudes, SiteHeights, SiteObservers.data(), SiteObservers.size());
+  printf("Palomar rho sin theta': %f, rho cos theta': %f\n", SiteObservers[2].RhoSinThetaPrime, SiteObservers[2].RhoCosThetaPrime);
+
 
   //Test out the AASidereal class
   date.Set(1987, 4, 10, 0, 0, 0, true);
@@ -1535,6 +1601,16 @@ int main()
   MST = CAASidereal::MeanGreenwichSiderealTime(date.Julian());
   UNREFERENCED_PARAMETER(MST);
 
+  //Test out the CAASiderealTime class, evaluating the sidereal time every hour for a day in one call
+  const CAASiderealTime sidereal(date.Julian(), date.Julian() + 1);
+  std::array<double, 24> SiderealJDs{};
+  std::array<double, 24> SiderealTimes{};
+  for (size_t i=0; i<SiderealJDs.size(); i++)
+    SiderealJDs[i] = date.Julian() + (i / 24.0);
+  sidereal.ApparentGreenwichSiderealTime(SiderealJDs.data(), SiderealTimes.data(), SiderealJDs.size());
+  printf("Apparent sidereal time on 10 April 1987 at 19:21 UT using CAASiderealTime: %f, exact: %f\n", SiderealTimes[0], CAASidereal::ApparentGreenwichSiderealTime(date.Julian()));
+  printf("Apparent sidereal time 23 hours later: %f\n", SiderealTimes[23]);
+
   //Test out the AACoordinateTransformation class
   const CAA2DCoordinate Ecliptic = CAACoordinateTransformation::Equatorial2Ecliptic(CAACoordinateTransformation::DMSToDegrees(7, 45, 18.946), CAACoordinateTransformation::DMSToDegrees(28, 01, 34.26), 23.4392911);
   Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(Ecliptic.X, Ecliptic.Y, 23.4392911);
@@ -1551,6 +1627,16 @@ int main()
   const double alpha2 = CAACoordinateTransformation::MapTo0To24Range(AST - Equatorial3.X - LongtitudeAsHourAngle);
   UNREFERENCED_PARAMETER(alpha2);
 
+  //Test out the CAAFrameTransformation class by converting the same star and Polaris to horizontal coordinates in one call
+  const CAAFrameTransformation equatorial2Horizontal = CAAFrameTransformation::Equatorial2Horizontal(CAACoordinateTransformation::HoursToRadians(AST - LongtitudeAsHourAngle), CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(38, 55, 17)));
+  const std::array<double, 2> StarAlphas{ CAACoordinateTransformation::HoursToRadians(Alpha), CAACoordinateTransformation::HoursToRadians(CAACoordinateTransformation::DMSToDegrees(2, 31, 49.09)) };
+  const std::array<double, 2> StarDeltas{ CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(6, 43, 11.61, false)), CAACoordinateTransformation::DegreesToRadians(CAACoordinateTransformation::DMSToDegrees(89, 15, 50.8)) };
+  std::array<double, 2> StarAzimuths{};
+  std::array<double, 2> StarAltitudes{};
+  equatorial2Horizontal.Transform(StarAlphas.data(), StarDeltas.data(), StarAzimuths.data(), StarAltitudes.data(), StarAlphas.size());
+  printf("Venus horizontal coordinates using CAAFrameTransformation: A=%f h=%f, scalar: A=%f h=%f\n", CAACoordinateTransformation::RadiansToDegrees(StarAzimuths[0]), CAACoordinateTransformation::RadiansToDegrees(StarAltitudes[0]), Horizontal.X, Horizontal.Y);
+  printf("Polaris horizontal coordinates using CAAFrameTransformation: A=%f h=%f\n", CAACoordinateTransformation::RadiansToDegrees(StarAzimuths[1]), CAACoordinateTransformation::RadiansToDegrees(StarAltitudes[1]));
+
   //Test out the CAANutation class (on its own)
   date.Set(1987, 4, 10, 0, 0, 0, true);
   double Obliquity = CAANutation::MeanObliquityOfEcliptic(date.Julian());
@@ -1560,6 +1646,20 @@ int main()
   double NutationInEcliptic = CAANutation::NutationInObliquity(date.Julian());
   UNREFERENCED_PARAMETER(NutationInEcliptic);
 
+  //Test out the CAANutationStepper class, stepping the nutation every 6 hours for 100 days
+  CAANutationStepper nutationStepper(date.Julian(), 0.25);
+  for (int i=1; i<=400; i++)
+    NutationInLongitude = nutationStepper.NutationInLongitude(date.Julian() + (i * 0.25));
+  printf("Nutation in longitude 100 days after 10 April 1987 using CAANutationStepper: %f, exact: %f\n", NutationInLongitude, CAANutation::NutationInLongitude(date.Julian() + 100));
+
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  //Test out the CVSOP87Stepper class, stepping the heliocentric longitude of the Earth every day for a year
+  CVSOP87Stepper EarthLStepper(CAAVSOP87D_Earth::L_Stepper(date.Julian(), 1));
+  for (int i=0; i<365; i++)
+    EarthLStepper.Step();
+  printf("Earth heliocentric longitude 365 days after 10 April 1987 using CVSOP87Stepper: %f, exact: %f\n", EarthLStepper.Value(), CAAVSOP87D_Earth::L(date.Julian() + 365));
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+
   //Test out the CAAParallactic class
   const double HourAngle = CAAParallactic::ParallacticAngle(-3, 10, 20);
   UNREFERENCED_PARAMETER(HourAngle);
@@ -1577,6 +1677,16 @@ int main()
   const double R3 = CAARefraction::RefractionFromApparent(90);
   UNREFERENCED_PARAMETER(R3);
 
+  //Test out the CAARefractionTable class, converting the apparent altitudes of the Sun's limb at sunset in example 16.a back to true altitudes
+  const CAARefractionTable RefractionTable(1010, 10);
+  const std::array<double, 3> ApparentAltitudes{ 0.5, 0.5 + CAACoordinateTransformation::DMSToDegrees(0, 32, 0), 45 };
+  std::array<double, 3> Refractions{};
+  RefractionTable.InverseRefractionFromTrue(ApparentAltitudes.data(), Refractions.data(), ApparentAltitudes.size());
+  for (size_t i=0; i<ApparentAltitudes.size(); i++)
+    printf("Apparent altitude %f, refraction from table %f\", true altitude %f, refraction of true altitude %f\"\n", ApparentAltitudes[i], Refractions[i] * 3600, ApparentAltitudes[i] - Refractions[i],
+           CAARefraction::RefractionFromTrue(ApparentAltitudes[i] - Refractions[i]) * 3600);
+  printf("Refraction at apparent altitude 0.5 from table %f\", exact %f\"\n", RefractionTable.RefractionFromApparent(0.5) * 3600, R1 * 3600);
+
   //Test out the CAAAngularSeparation class
   const double AngularSeparation = CAAAngularSeparation::Separation(CAACoordinateTransformation::DMSToDegrees(14, 15, 39.7), CAACoordinateTransformation::DMSToDegrees(19, 10, 57),
                                                                     CAACoordinateTransformation::DMSToDegrees(13, 25, 11.6), CAACoordinateTransformation::DMSToDegrees(11, 9, 41, false));
@@ -1648,6 +1758,21 @@ int main()
   PA7.Y += Aberration.Y;
   const CAA2DCoordinate Aberration2 = CAAAberration::EquatorialAberration(PA7.X, PA7.Y, 2462088.69, true);
   UNREFERENCED_PARAMETER(Aberration2);
+
+  //Test out the CAAAberrationEpoch class, correcting Theta Persei and Polaris for aberration at the same instant
+  const CAAAberrationEpoch aberrationEpoch(2462088.69, false);
+  const std::array<double, 2> AberrationAlphas{ PA7.X, CAACoordinateTransformation::DMSToDegrees(2, 31, 49.09) };
+  const std::array<double, 2> AberrationDeltas{ PA7.Y, CAACoordinateTransformation::DMSToDegrees(89, 15, 50.8) };
+  std::array<CAA2DCoordinate, 2> Aberrations{};
+  CAAAberration::EquatorialAberration(AberrationAlphas.data(), AberrationDeltas.data(), aberrationEpoch, Aberrations.data(), Aberrations.size());
+  printf("Theta Persei aberration using CAAAberrationEpoch: RA=%fs Dec=%f\", Polaris: RA=%fs Dec=%f\"\n", Aberrations[0].X * 3600, Aberrations[0].Y * 3600, Aberrations[1].X * 3600, Aberrations[1].Y * 3600);
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  CAA3DCoordinate EarthPosition;
+  CAA3DCoordinate EarthVelocity3;
+  CAAVSOP87A_Earth::PositionAndVelocity(2462088.69, EarthPosition, EarthVelocity3);
+  printf("Earth heliocentric position and velocity using CAAVSOP87A_Earth::PositionAndVelocity: X=%f Y=%f Z=%f X'=%f Y'=%f Z'=%f\n", EarthPosition.X, EarthPosition.Y, EarthPosition.Z, EarthVelocity3.X, EarthVelocity3.Y, EarthVelocity3.Z);
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  const CAA2DCoordinate PA7J2000 = PA7;
   PA7 = CAAPrecession::PrecessEquatorial(PA7.X, PA7.Y, 2451545, 2462088.69);
 
   Obliquity = CAANutation::MeanObliquityOfEcliptic(2462088.69);
@@ -1658,6 +1783,15 @@ int main()
   PA7.X += CAACoordinateTransformation::DMSToDegrees(0, 0, AlphaNutation/15);
   PA7.Y += CAACoordinateTransformation::DMSToDegrees(0, 0, DeltaNutation);
 
+  //Do the same reduction from the mean equinox of J2000 to the true equinox of date as a single rotation matrix
+  const CAAFrameTransformation J2000ToTrueOfDate(CAARotationMatrix::Nutation(2462088.69) * CAARotationMatrix::Precession(2451545, 2462088.69));
+  const double AlphaJ2000 = CAACoordinateTransformation::HoursToRadians(PA7J2000.X);
+  const double DeltaJ2000 = CAACoordinateTransformation::DegreesToRadians(PA7J2000.Y);
+  double AlphaTrue = 0;
+  double DeltaTrue = 0;
+  J2000ToTrueOfDate.Transform(&AlphaJ2000, &DeltaJ2000, &AlphaTrue, &DeltaTrue, 1);
+  printf("Theta Persei true position using CAARotationMatrix: RA=%f Dec=%f, using Meeus's formulae: RA=%f Dec=%f\n", CAACoordinateTransformation::RadiansToHours(AlphaTrue), CAACoordinateTransformation::RadiansToDegrees(DeltaTrue), PA7.X, PA7.Y);
+
 
   //Try out the AA kepler class
   const double E0 = CAAKepler::Calculate(5, 0.1, 100);
@@ -1760,6 +1894,17 @@ int main()
   SunLat2 = CAASun::ApparentEclipticLatitude(2448908.5, true);
   Equatorial = CAACoordinateTransformation::Ecliptic2Equatorial(SunLong, SunLat, CAANutation::TrueObliquityOfEcliptic(2448908.5));
 
+  //Test out CAASun::ApparentPosition, first for a single date and then for the following 10 days in one call
+  const CAASunApparentPositionDetails SunPosition = CAASun::ApparentPosition(2448908.5, true);
+  printf("Sun apparent position using CAASun::ApparentPosition: Long=%f Lat=%f R=%f RA=%f Dec=%f Obliquity=%f NutationInLongitude=%f EquationOfTime=%f\n", SunPosition.ApparentEclipticLongitude, SunPosition.ApparentEclipticLatitude,
+         SunPosition.RadiusVector, SunPosition.ApparentRightAscension, SunPosition.ApparentDeclination, SunPosition.TrueObliquity, SunPosition.NutationInLongitude, SunPosition.EquationOfTime);
+  std::array<double, 10> SunJDs{};
+  std::array<CAASunApparentPositionDetails, 10> SunPositions{};
+  for (size_t i=0; i<SunJDs.size(); i++)
+    SunJDs[i] = 2448909.5 + i;
+  CAASun::ApparentPosition(SunJDs.data(), SunPositions.data(), SunJDs.size(), true);
+  printf("Sun apparent position 10 days later: RA=%f Dec=%f\n", SunPositions[9].ApparentRightAscension, SunPositions[9].ApparentDeclination);
+
   const CAA3DCoordinate SunCoord = CAASun::EquatorialRectangularCoordinatesMeanEquinox(2448908.5, false);
   UNREFERENCED_PARAMETER(SunCoord);
   const CAA3DCoordinate SunCoord2 = CAASun::EquatorialRectangularCoordinatesMeanEquinox(2448908.5, true);
@@ -1871,6 +2016,8 @@ int main()
   UNREFERENCED_PARAMETER(PlutoLat);
   const double PlutoRadius = CAAPluto::RadiusVector(2448908.5);
   UNREFERENCED_PARAMETER(PlutoRadius);
+  const CAAPlutoDetails PlutoPosition = CAAPluto::Position(2448908.5);
+  printf("Pluto position using CAAPluto::Position: L=%f B=%f R=%f\n", PlutoPosition.EclipticLongitude, PlutoPosition.EclipticLatitude, PlutoPosition.RadiusVector);
 
 
   //Test out the CAAMoon class
@@ -1967,6 +2114,15 @@ int main()
   UNREFERENCED_PARAMETER(MoonApogee);
   double MoonApogee2 = CAAMoonPerigeeApogee::TrueApogee(-148.5);
   UNREFERENCED_PARAMETER(MoonApogee2);
+  const double MoonApogee3 = CAAMoonPerigeeApogee::TrueApogee(-148.5, true);
+  printf("Apogee of the Moon in October 1988 (JDE): Meeus %f, refined using ELP2000 %f\n", MoonApogee2, MoonApogee3);
+  const double ApogeeK = -148.5;
+  double RefinedApogee = 0;
+  double FastApogee = 0;
+  CAAMoonPerigeeApogee::TrueApogee(&ApogeeK, &RefinedApogee, 1, true, &FastApogee);
+  printf("Apogee of the Moon in October 1988 from the batch method (JDE): Meeus %f, refined using ELP2000 %f\n", FastApogee, RefinedApogee);
+  assert(fabs(FastApogee - MoonApogee2) < 1e-6);
+  assert(fabs(RefinedApogee - MoonApogee3) < 1e-6);
   double MoonApogeeParallax = CAAMoonPerigeeApogee::ApogeeParallax(-148.5);
   double MoonApogeeDistance = CAAMoon::HorizontalParallaxToRadiusVector(MoonApogeeParallax);
   UNREFERENCED_PARAMETER(MoonApogeeDistance);
@@ -2552,6 +2708,40 @@ int main()
   UNREFERENCED_PARAMETER(Y5);
   const double Y6 = CAAInterpolate::LagrangeInterpolate(90, static_cast<int>(X1.size()), X1.data(), Y1.data());
   UNREFERENCED_PARAMETER(Y6);
+  const CAABarycentricInterpolator barycentric(X1.data(), Y1.data(), X1.size());
+  const double Y7 = barycentric.Evaluate(30);
+  UNREFERENCED_PARAMETER(Y7);
+
+  const CAAChebyshevSeries chebyshev = CAAChebyshevSeries::Fit([](double JD) noexcept { return CAANutation::NutationInLongitude(JD); }, 2448908.5, 2448908.5 + 30, 24);
+  const double ChebyshevNutation = chebyshev.Evaluate(2448914.5);
+  UNREFERENCED_PARAMETER(ChebyshevNutation);
+  const double ChebyshevNutationRate = chebyshev.Derivative().Evaluate(2448914.5);
+  UNREFERENCED_PARAMETER(ChebyshevNutationRate);
+
+  //Check the derivative and integral of a Chebyshev fit of sin(x) against cos(x) and cos(A) - cos(x), as the integral
+  //is zero at A
+  const CAAChebyshevSeries chebyshevSin = CAAChebyshevSeries::Fit([](double X) noexcept { return sin(X); }, 0.5, 2.5, 20);
+  const CAAChebyshevSeries chebyshevSinDerivative = chebyshevSin.Derivative();
+  const CAAChebyshevSeries chebyshevSinIntegral = chebyshevSin.Integral();
+  double ChebyshevDerivativeError = 0;
+  double ChebyshevIntegralError = 0;
+  for (int i=0; i<=20; i++)
+  {
+    const double X = 0.5 + (i * 0.1);
+    ChebyshevDerivativeError = max(ChebyshevDerivativeError, fabs(chebyshevSinDerivative.Evaluate(X) - cos(X)));
+    ChebyshevIntegralError = max(ChebyshevIntegralError, fabs(chebyshevSinIntegral.Evaluate(X) - (cos(0.5) - cos(X))));
+  }
+  const bool bChebyshevDerivativeOK = (ChebyshevDerivativeError < 1e-10);
+  const bool bChebyshevIntegralOK = (ChebyshevIntegralError < 1e-12);
+  printf("Chebyshev fit of sin(x): derivative %s, integral %s\n", bChebyshevDerivativeOK ? "OK" : "FAIL", bChebyshevIntegralOK ? "OK" : "FAIL");
+  assert(bChebyshevDerivativeOK);
+  assert(bChebyshevIntegralOK);
+
+#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
+  const CAACubicHermiteInterpolator hermite = CAACubicHermiteInterpolator::Sample(2448908.5, 2448908.5 + 30, 1, CAAVSOP87D_Earth::L, CAAVSOP87D_Earth::L_DASH, true);
+  const double EarthL = hermite.Evaluate(2448914.25);
+  UNREFERENCED_PARAMETER(EarthL);
+#endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
 
 
   //Print out the rise, transit and set times for all the Planets, Sun, Moon on March 20 1988 at Boston using the new CAARiseTransitSet2 class
@@ -2568,6 +2758,44 @@ int main()
   PrintBostonRiseTransitSetTimesMoon();
   PrintBostonRiseTransitSetTimesSirius();
 
+  //Print out the golden hour times for the Sun on March 20 1988 at Boston using the user defined altitude thresholds of the CAARiseTransitSet2 class
+  events = CAARiseTransitSet2::Calculate(CAADynamicalTime::UTC2TT(2447240.5), CAADynamicalTime::UTC2TT(2447241.5), CAARiseTransitSet2::Object::SUN, 71.0833, 42.3333, -0.8333, 0, 0.04, false, { 6 });
+  for (const auto& event : events)
+  {
+    if ((event.type == CAARiseTransitSetDetails2::Type::AscendingAltitude) || (event.type == CAARiseTransitSetDetails2::Type::DescendingAltitude))
+    {
+      const CAADate date_time(CAADynamicalTime::TT2UTC(event.JD), true);
+      long year = 0;
+      long month = 0;
+      long day = 0;
+      long hour = 0;
+      long minute = 0;
+      double second = 0;
+      date_time.Get(year, month, day, hour, minute, second);
+      printf("Boston %s of golden hour (Sun at altitude %f) (UTC) at bearing %f, %d-%d-%d %02d:%02d:%02d\n", (event.type == CAARiseTransitSetDetails2::Type::AscendingAltitude) ? "End" : "Start", event.Altitude, event.Bearing, static_cast<int>(year), static_cast<int>(month), static_cast<int>(day), static_cast<int>(hour), static_cast<int>(minute), static_cast<int>(second));
+    }
+  }
+
+  //Print out a week long sunrise and sunset almanac for Boston and Wexford starting on March 20 1988 using CAARiseTransitSet::CalculateAlmanac
+  constexpr std::array<double, 2> AlmanacLongitudes{ { 71.0833, 6.4575 } };
+  constexpr std::array<double, 2> AlmanacLatitudes{ { 42.3333, 52.3367 } };
+  constexpr std::array<const char*, 2> AlmanacSites{ { "Boston", "Wexford" } };
+  const std::vector<CAARiseTransitSetDetails> almanac = CAARiseTransitSet::CalculateAlmanac(2447240.5, 7, [](double JD)
+  {
+    const double Long = CAASun::ApparentEclipticLongitude(JD, false);
+    const double Lat = CAASun::ApparentEclipticLatitude(JD, false);
+    return CAACoordinateTransformation::Ecliptic2Equatorial(Long, Lat, CAANutation::TrueObliquityOfEcliptic(JD));
+  }, AlmanacLongitudes.data(), AlmanacLatitudes.data(), AlmanacSites.size(), -0.8333);
+  for (size_t i=0; i<7; i++)
+  {
+    for (size_t j=0; j<AlmanacSites.size(); j++)
+    {
+      const CAARiseTransitSetDetails& details = almanac[(i * AlmanacSites.size()) + j];
+      const CAADate date(2447240.5 + i, true);
+      printf("%s Sun almanac for %d-%d-%d (UT), Rise: %f (valid %d), Transit: %f (valid %d), Set: %f (valid %d)\n", AlmanacSites[j], static_cast<int>(date.Year()), static_cast<int>(date.Month()), static_cast<int>(date.Day()), details.Rise, static_cast<int>(details.bRiseValid), details.Transit, static_cast<int>(details.bTransitValid), details.Set, static_cast<int>(details.bSetValid));
+    }
+  }
+
   //Calculate the time of moon set for 11th of August 2009 UTC for Palomar Observatory
   constexpr const int YYYY = 2009;
   constexpr const int MM = 8;
@@ -2697,6 +2925,16 @@ int main()
   const CAA2DCoordinate Topocentric = CAAParallax::Equatorial2Topocentric(CAACoordinateTransformation::DMSToDegrees(22, 38, 7.25), -15.771083, 0.37276, CAACoordinateTransformation::DMSToDegrees(7, 47, 27)*15, CAACoordinateTransformation::DMSToDegrees(33, 21, 22), 1706, 2452879.63681);
   UNREFERENCED_PARAMETER(Topocentric);
 
+  //Mars as seen from Palomar (Meeus's example 40.a) and from two other observatories using one epoch for all three
+  const std::array<CAAObserver, 3> Observatories{ CAAObserver(CAACoordinateTransformation::DMSToDegrees(7, 47, 27)*15, CAACoordinateTransformation::DMSToDegrees(33, 21, 22), 1706),
+                                                  CAAObserver(70.7366, -30.2407, 2663),
+                                                  CAAObserver(-17.8792, 28.7606, 2396) };
+  const CAATopocentricEpoch MarsEpoch(2452879.63681);
+  std::array<CAA2DCoordinate, 3> ObservatoryTopocentric;
+  CAAParallax::Equatorial2Topocentric(CAACoordinateTransformation::DMSToDegrees(22, 38, 7.25), -15.771083, 0.37276, Observatories.data(), MarsEpoch, ObservatoryTopocentric.data(), Observatories.size());
+  for (size_t i=0; i<ObservatoryTopocentric.size(); i++)
+    printf("Mars topocentric position for observatory %d: RA=%f Dec=%f\n", static_cast<int>(i), ObservatoryTopocentric[i].X, ObservatoryTopocentric[i].Y);
+
 
   const double distance2 = CAAParallax::ParallaxToDistance(CAACoordinateTransformation::DMSToDegrees(0, 59, 27.7));
   const double parallax2 = CAAParallax::DistanceToParallax(distance2);
@@ -2739,6 +2977,22 @@ int main()
   const CAAPhysicalJupiterDetails JupiterDetails2 = CAAPhysicalJupiter::Calculate(2448972.50068, true);
   UNREFERENCED_PARAMETER(JupiterDetails2);
 
+  //The physical ephemerides for the same date can share the Earth epoch, and the batch versions calculate a run of dates
+  const CAAEarthEpoch EarthEpoch(2448935.500683, false);
+  const CAAPhysicalMarsDetails MarsDetails3 = CAAPhysicalMars::Calculate(EarthEpoch);
+  printf("Mars central meridian from Earth epoch: %f, P: %f\n", MarsDetails3.w, MarsDetails3.P);
+  const CAAPhysicalSunDetails PhysicalSunDetails = CAAPhysicalSun::Calculate(EarthEpoch);
+  printf("Sun L0 from Earth epoch: %f, B0: %f, P: %f\n", PhysicalSunDetails.L0, PhysicalSunDetails.B0, PhysicalSunDetails.P);
+  double PhysicalJDs[4];
+  for (int i=0; i<4; i++)
+    PhysicalJDs[i] = 2448935.500683 + (i / 1440.0);
+  CAAPhysicalMarsDetails MarsBatch[4];
+  CAAPhysicalMars::Calculate(PhysicalJDs, MarsBatch, 4, false);
+  CAAPhysicalJupiterDetails JupiterBatch[4];
+  CAAPhysicalJupiter::Calculate(PhysicalJDs, JupiterBatch, 4, false);
+  for (int i=0; i<4; i++)
+    printf("JD: %f, Mars central meridian: %f, Jupiter System I central meridian: %f\n", PhysicalJDs[i], MarsBatch[i].w, JupiterBatch[i].Apparentw1);
+
   //The example as given in the book
   const CAAGalileanMoonsDetails GalileanDetails = CAAGalileanMoons::Calculate(2448972.50068, false);
   UNREFERENCED_PARAMETER(GalileanDetails);
@@ -2817,6 +3071,103 @@ int main()
   const CAASaturnRingDetails saturnrings2 = CAASaturnRings::Calculate(2448972.50068, true);
   UNREFERENCED_PARAMETER(saturnrings2);
 
+  //The ring plane crossings of 1995 & 1996, when the Earth crossed the ring plane three times
+  std::vector<CAASaturnRingEventDetails> ringEvents = CAASaturnRings::CalculateEvents(CAADynamicalTime::UTC2TT(2449718.5), CAADynamicalTime::UTC2TT(2450448.5), 10, true, false);
+  for (const auto& event : ringEvents)
+  {
+    const char* pszEvents[] = { "", "Earth crosses northward", "Earth crosses southward", "Sun crosses northward", "Sun crosses southward" };
+    const CAADate date_time(CAADynamicalTime::TT2UTC(event.JD), true);
+    long year = 0;
+    long month = 0;
+    long day = 0;
+    long hour = 0;
+    long minute = 0;
+    double second = 0;
+    date_time.Get(year, month, day, hour, minute, second);
+    printf("Saturn ring plane crossing: %s (UTC) %d-%d-%d %02d:%02d:%02d, B: %f, B': %f\n", pszEvents[static_cast<int>(event.type)], static_cast<int>(year), static_cast<int>(month), static_cast<int>(day), static_cast<int>(hour), static_cast<int>(minute), static_cast<int>(second), event.B, event.Bdash);
+  }
+
+  //The rings and satellites of Saturn for the same dates can share the light time corrected position of Saturn
+  const CAASaturnEpoch SaturnEpoch(2451439.50074, false);
+  const CAASaturnRingDetails saturnrings3 = CAASaturnRings::Calculate(SaturnEpoch);
+  printf("Saturn rings from Saturn epoch, B: %f, B': %f, P: %f\n", saturnrings3.B, saturnrings3.Bdash, saturnrings3.P);
+  const CAASaturnMoonsDetails saturnMoons3 = CAASaturnMoons::Calculate(SaturnEpoch);
+  printf("Titan from Saturn epoch, X: %f, Y: %f\n", saturnMoons3.Satellite6.ApparentRectangularCoordinates.X, saturnMoons3.Satellite6.ApparentRectangularCoordinates.Y);
+
+  //The conjunctions within a degree between the Sun, Moon, the bright planets and Regulus during 2023
+  std::vector<CAAConjunctionBody> conjunctionBodies;
+  conjunctionBodies.emplace_back(CAAConjunctionBody::Object::SUN);
+  conjunctionBodies.emplace_back(CAAConjunctionBody::Object::MERCURY);
+  conjunctionBodies.emplace_back(CAAConjunctionBody::Object::VENUS);
+  conjunctionBodies.emplace_back(CAAConjunctionBody::Object::MARS);
+  conjunctionBodies.emplace_back(CAAConjunctionBody::Object::JUPITER);
+  conjunctionBodies.emplace_back(CAAConjunctionBody::Object::SATURN);
+  conjunctionBodies.emplace_back(CAAConjunctionBody::Object::MOON);
+  conjunctionBodies.emplace_back(10.139532, 11.967208);
+  const std::vector<CAAConjunctionDetails> conjunctions = CAAConjunctions::Calculate(CAADynamicalTime::UTC2TT(2459945.5), CAADynamicalTime::UTC2TT(2460310.5), conjunctionBodies, 1, 0.5, true);
+  for (const auto& conjunction : conjunctions)
+  {
+    const char* pszBodies[] = { "Sun", "Mercury", "Venus", "Mars", "Jupiter", "Saturn", "Moon", "Regulus" };
+    const CAADate date_time(CAADynamicalTime::TT2UTC(conjunction.JD), true);
+    long year = 0;
+    long month = 0;
+    long day = 0;
+    long hour = 0;
+    long minute = 0;
+    double second = 0;
+    date_time.Get(year, month, day, hour, minute, second);
+    printf("Conjunction of %s and %s (UTC) %d-%d-%d %02d:%02d:%02d, Separation: %f, Position Angle: %f\n", pszBodies[conjunction.Body1], pszBodies[conjunction.Body2], static_cast<int>(year), static_cast<int>(month), static_cast<int>(day), static_cast<int>(hour), static_cast<int>(minute), static_cast<int>(second), conjunction.Separation, conjunction.PositionAngle);
+  }
+
+  //The occultations of the bright zodiacal stars visible from Boston during 2023
+  const double OccultationAlphas[] = { 4.598677, 10.139532, 13.419883, 16.490128, 3.791419 };
+  const double OccultationDeltas[] = { 16.509301, 11.967208, -11.161322, -26.432002, 24.105136 };
+  const char* pszOccultationStars[] = { "Aldebaran", "Regulus", "Spica", "Antares", "Alcyone" };
+  const CAAStarIndex occultationStars(OccultationAlphas, OccultationDeltas, 5);
+  const std::vector<CAAObserver> occultationObservers(1, CAAObserver(71.0636, 42.3581, 10));
+  const std::vector<CAAOccultationDetails> occultations = CAAOccultations::Calculate(CAADynamicalTime::UTC2TT(2459945.5), CAADynamicalTime::UTC2TT(2460310.5), occultationStars, occultationObservers);
+  for (const auto& occultation : occultations)
+  {
+    if (occultation.MoonAltitude < 0)
+      continue;
+    const CAADate date_time(CAADynamicalTime::TT2UTC(occultation.JD), true);
+    long year = 0;
+    long month = 0;
+    long day = 0;
+    long hour = 0;
+    long minute = 0;
+    double second = 0;
+    date_time.Get(year, month, day, hour, minute, second);
+    printf("Occultation of %s, %s (UTC) %d-%d-%d %02d:%02d:%02d, Position Angle: %f, Moon Altitude: %f\n", pszOccultationStars[occultation.Star], (occultation.type == CAAOccultationDetails::Type::Disappearance) ? "Disappearance" : "Reappearance", static_cast<int>(year), static_cast<int>(month), static_cast<int>(day), static_cast<int>(hour), static_cast<int>(minute), static_cast<int>(second), occultation.PositionAngle, occultation.MoonAltitude);
+  }
+
+  //Check that no contact is reported twice for a dense catalogue of random stars, which includes stars whose closest
+  //approach is close to a node of the tabulated path of the Moon
+  mt19937_64 occultationGenerator(1);
+  uniform_real_distribution<double> occultationDistribution(0, 1);
+  const size_t nRandomStars = 400000;
+  vector<double> RandomAlphas(nRandomStars);
+  vector<double> RandomDeltas(nRandomStars);
+  for (size_t i=0; i<nRandomStars; i++)
+  {
+    RandomAlphas[i] = 24 * occultationDistribution(occultationGenerator);
+    RandomDeltas[i] = CAACoordinateTransformation::RadiansToDegrees(asin((2 * occultationDistribution(occultationGenerator)) - 1));
+  }
+  const CAAStarIndex randomStars(RandomAlphas.data(), RandomDeltas.data(), nRandomStars);
+  const std::vector<CAAOccultationDetails> randomOccultations = CAAOccultations::Calculate(CAADynamicalTime::UTC2TT(2459945.5), CAADynamicalTime::UTC2TT(2460310.5), randomStars, occultationObservers);
+  size_t nDuplicateContacts = 0;
+  for (size_t i=0; i<randomOccultations.size(); i++)
+  {
+    //The contacts are in date order, so any duplicate of a contact follows it within a few minutes
+    for (size_t j=i+1; (j<randomOccultations.size()) && ((randomOccultations[j].JD - randomOccultations[i].JD) < 0.5); j++)
+    {
+      if ((randomOccultations[j].Star == randomOccultations[i].Star) && (randomOccultations[j].Observer == randomOccultations[i].Observer) && (randomOccultations[j].type == randomOccultations[i].type))
+        ++nDuplicateContacts;
+    }
+  }
+  printf("Occultations of %d random stars from Boston during 2023: %s\n", static_cast<int>(nRandomStars), (nDuplicateContacts == 0) ? "No duplicate contacts" : "FAIL, duplicate contacts found");
+  assert(nDuplicateContacts == 0);
+
   /*
   //Code to write out the Saturn Ring values for a specific range
   CAADate Datex(2024, 4, 1, true);
@@ -2843,6 +3194,15 @@ int main()
   UNREFERENCED_PARAMETER(ApproxK);
   const double NewMoonJD = CAAMoonPhases::TruePhase(-283);
   UNREFERENCED_PARAMETER(NewMoonJD);
+  const double NewMoonJD2 = CAAMoonPhases::TruePhase(-283, true);
+  printf("New Moon of February 1977 (JDE): Meeus %f, refined using ELP2000 & VSOP87 %f\n", NewMoonJD, NewMoonJD2);
+  const double PhaseK[2] = { -283, -282.75 };
+  double RefinedPhaseJD[2] = { 0, 0 };
+  double FastPhaseJD[2] = { 0, 0 };
+  CAAMoonPhases::TruePhase(PhaseK, RefinedPhaseJD, 2, true, FastPhaseJD);
+  printf("New Moon & First Quarter of February 1977 from the batch method (JDE): Meeus %f & %f, refined using ELP2000 & VSOP87 %f & %f\n", FastPhaseJD[0], FastPhaseJD[1], RefinedPhaseJD[0], RefinedPhaseJD[1]);
+  assert(fabs(FastPhaseJD[0] - NewMoonJD) < 1e-6);
+  assert(fabs(RefinedPhaseJD[0] - NewMoonJD2) < 1e-6);
 
   ApproxK = CAAMoonPhases::K(1952.88);
   double LastQuarterJD = CAAMoonPhases::TruePhase(-583 + 0.75);
@@ -3838,5 +4198,16 @@ int main()
   UNREFERENCED_PARAMETER(fZDash);
 #endif //#ifndef AAPLUS_VSOP87_NO_HIGH_PRECISION
 
+  //Show the cost breakdown of a high precision planetary position when the instrumentation counters are compiled in
+  if (CAAInstrumentation::Enabled())
+  {
+    CAAInstrumentation::Reset();
+    CAAElliptical::Calculate(2448976.5, CAAElliptical::EllipticalObject::VENUS, true);
+    const CAAInstrumentationCounters counters = CAAInstrumentation::Snapshot();
+    printf("Instrumentation VSOP87 Calls:%llu Terms:%llu Ticks:%llu\n", static_cast<unsigned long long>(counters.VSOP87.Calls), static_cast<unsigned long long>(counters.VSOP87.Terms), static_cast<unsigned long long>(counters.VSOP87.Ticks));
+    printf("Instrumentation Nutation Calls:%llu Terms:%llu Ticks:%llu\n", static_cast<unsigned long long>(counters.Nutation.Calls), static_cast<unsigned long long>(counters.Nutation.Terms), static_cast<unsigned long long>(counters.Nutation.Ticks));
+    printf("Instrumentation Elliptical Calls:%llu Light-time iterations:%llu Ticks:%llu\n", static_cast<unsigned long long>(counters.EllipticalLightTime.Calls), static_cast<unsigned long long>(counters.EllipticalLightTime.Terms), static_cast<unsigned long long>(counters.EllipticalLightTime.Ticks));
+  }
+
   return 0;
 }
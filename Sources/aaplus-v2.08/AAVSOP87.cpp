@@ -25,6 +25,7 @@ to maintain a single distribution point for the source code.
 #include "stdafx.h"
 #include "AAVSOP87.h"
 #include "AACoordinateTransformation.h"
+#include "AAInstrumentation.h"
 #include <cmath>
 #include <cassert>
 using namespace std;
@@ -47,11 +48,15 @@ double CVSOP87::Calculate(double JD, const VSOP87Coefficient2* pTable, int nTabl
 //Validate our parameters
   assert(pTable != nullptr);
 
+  AAPLUS_INSTRUMENT_CALL(VSOP87);
+  AAPLUS_INSTRUMENT_SCOPE(VSOP87);
+
   const double T = (JD - 2451545) / 365250;
   double TTerm = T;
   double Result = 0;
   for (int i = 0; i<nTableSize; i++)
   {
+    AAPLUS_INSTRUMENT_TERMS(VSOP87, pTable[i].nCoefficientsSize);
     double TempResult = 0;
     for (int j = 0; j < pTable[i].nCoefficientsSize; j++)
 #ifdef _MSC_VER
@@ -80,12 +85,16 @@ double CVSOP87::Calculate_Dash(double JD, const VSOP87Coefficient2* pTable, int
 //Validate our parameters
   assert(pTable != nullptr);
 
+  AAPLUS_INSTRUMENT_CALL(VSOP87);
+  AAPLUS_INSTRUMENT_SCOPE(VSOP87);
+
   const double T = (JD - 2451545) / 365250;
   double TTerm1 = 1;
   double TTerm2 = T;
   double Result = 0;
   for (int i = 0; i<nTableSize; i++)
   {
+    AAPLUS_INSTRUMENT_TERMS(VSOP87, pTable[i].nCoefficientsSize);
     double tempPart1 = 0;
     double tempPart2 = 0;
     for (int j = 0; j < pTable[i].nCoefficientsSize; j++)
@@ -116,3 +125,88 @@ double CVSOP87::Calculate_Dash(double JD, const VSOP87Coefficient2* pTable, int
   //The value returned is in per days
   return Result / 365250;
 }
+
+void CVSOP87::Calculate_Dash(double JD, const VSOP87Coefficient2* pTable, int nTableSize, double& Value, double& Dash) noexcept
+{
+//Validate our parameters
+  assert(pTable != nullptr);
+
+  AAPLUS_INSTRUMENT_CALL(VSOP87);
+  AAPLUS_INSTRUMENT_SCOPE(VSOP87);
+
+  const double T = (JD - 2451545) / 365250;
+  double TTerm = T;
+  double TTerm1 = 1;
+  double TTerm2 = T;
+  Value = 0;
+  double Result = 0;
+  for (int i = 0; i<nTableSize; i++)
+  {
+    AAPLUS_INSTRUMENT_TERMS(VSOP87, pTable[i].nCoefficientsSize);
+    double TempResult = 0;
+    double tempPart1 = 0;
+    double tempPart2 = 0;
+    for (int j = 0; j < pTable[i].nCoefficientsSize; j++)
+    {
+#ifdef _MSC_VER
+#pragma warning(suppress : 26489)
+#endif //#ifdef _MSC_VER
+      const VSOP87Coefficient& coefficient = pTable[i].pCoefficients[j];
+      const double B_CT = coefficient.B + coefficient.C*T;
+      const double cosB_CT = cos(B_CT);
+      TempResult += coefficient.A * cosB_CT;
+      tempPart1 += i * coefficient.A * cosB_CT;
+      tempPart2 += coefficient.A * coefficient.C * sin(B_CT);
+    }
+    if (i)
+    {
+      TempResult *= TTerm;
+      TTerm *= T;
+      tempPart1 *= TTerm1;
+      tempPart2 *= TTerm2;
+      TTerm1 *= T;
+      TTerm2 *= T;
+    }
+    Value += TempResult;
+    Result += (tempPart1 - tempPart2);
+  }
+
+  //The rate returned is in per days
+  Dash = Result / 365250;
+}
+
+CVSOP87Stepper::CVSOP87Stepper(const VSOP87Coefficient2* pTable, int nTableSize, bool bAngle, double StartJD, double StepInterval, int nAnchorInterval) : m_Series(365250, StepInterval, nAnchorInterval),
+                                                                                                                                                         m_bAngle(bAngle)
+{
+  //Validate our parameters
+  assert(pTable != nullptr);
+
+  //The table for each power of T becomes a block of the series
+  for (int i=0; i<nTableSize; i++)
+  {
+    for (int j=0; j<pTable[i].nCoefficientsSize; j++)
+    {
+#ifdef _MSC_VER
+#pragma warning(suppress : 26489)
+#endif //#ifdef _MSC_VER
+      const double Phase[2] = { pTable[i].pCoefficients[j].B, pTable[i].pCoefficients[j].C };
+#ifdef _MSC_VER
+#pragma warning(suppress : 26489)
+#endif //#ifdef _MSC_VER
+      m_Series.AddTerm(pTable[i].pCoefficients[j].A, false, i, Phase, 2);
+    }
+  }
+  m_Series.Anchor(StartJD);
+}
+
+double CVSOP87Stepper::Calculate(double JD)
+{
+  const double Result = m_Series.Calculate(JD);
+  return m_bAngle ? CAACoordinateTransformation::MapTo0To2PIRange(Result) : Result;
+}
+
+double CVSOP87Stepper::Value() const noexcept
+{
+  const double Result = m_Series.Value();
+  return m_bAngle ? CAACoordinateTransformation::MapTo0To2PIRange(Result) : Result;
+}
@@ -3706,3 +3706,10 @@ double CAAVSOP87A_Earth::Z_DASH(double JD) noexcept
 {
   return CVSOP87::Calculate_Dash(JD, g_VSOP87A_Z_EARTH, sizeof(g_VSOP87A_Z_EARTH)/sizeof(VSOP87Coefficient2));
 }
+
+void CAAVSOP87A_Earth::PositionAndVelocity(double JD, CAA3DCoordinate& Position, CAA3DCoordinate& Velocity) noexcept
+{
+  CVSOP87::Calculate_Dash(JD, g_VSOP87A_X_EARTH, sizeof(g_VSOP87A_X_EARTH)/sizeof(VSOP87Coefficient2), Position.X, Velocity.X);
+  CVSOP87::Calculate_Dash(JD, g_VSOP87A_Y_EARTH, sizeof(g_VSOP87A_Y_EARTH)/sizeof(VSOP87Coefficient2), Position.Y, Velocity.Y);
+  CVSOP87::Calculate_Dash(JD, g_VSOP87A_Z_EARTH, sizeof(g_VSOP87A_Z_EARTH)/sizeof(VSOP87Coefficient2), Position.Z, Velocity.Z);
+}
@@ -2588,3 +2588,18 @@ double CAAVSOP87D_Earth::R_DASH(double JD) noexcept
 {
   return CVSOP87::Calculate_Dash(JD, g_VSOP87D_R_EARTH, sizeof(g_VSOP87D_R_EARTH)/sizeof(VSOP87Coefficient2));
 }
+
+CVSOP87Stepper CAAVSOP87D_Earth::L_Stepper(double StartJD, double StepInterval)
+{
+  return CVSOP87Stepper(g_VSOP87D_L_EARTH, sizeof(g_VSOP87D_L_EARTH)/sizeof(VSOP87Coefficient2), true, StartJD, StepInterval);
+}
+
+CVSOP87Stepper CAAVSOP87D_Earth::B_Stepper(double StartJD, double StepInterval)
+{
+  return CVSOP87Stepper(g_VSOP87D_B_EARTH, sizeof(g_VSOP87D_B_EARTH)/sizeof(VSOP87Coefficient2), true, StartJD, StepInterval);
+}
+
+CVSOP87Stepper CAAVSOP87D_Earth::R_Stepper(double StartJD, double StepInterval)
+{
+  return CVSOP87Stepper(g_VSOP87D_R_EARTH, sizeof(g_VSOP87D_R_EARTH)/sizeof(VSOP87Coefficient2), false, StartJD, StepInterval);
+}
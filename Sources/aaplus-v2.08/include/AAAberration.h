@@ -36,10 +36,40 @@ to maintain a single distribution point for the source code.
 
 #include "AA2DCoordinate.h"
 #include "AA3DCoordinate.h"
+#include <cstddef>
 
 
 /////////////////////// Classes ///////////////////////////////////////////////
 
+//The velocity of the Earth and the position of the Sun at an instant, which are shared by all of the aberration
+//corrections at that instant
+class AAPLUS_EXT_CLASS CAAAberrationEpoch
+{
+public:
+//Constructors / Destructors
+  CAAAberrationEpoch() noexcept : JD(0),
+                                  SunLongitude(0),
+                                  Eccentricity(0),
+                                  Perihelion(0)
+  {
+  };
+  CAAAberrationEpoch(double jd, bool bHighPrecision) noexcept;
+  CAAAberrationEpoch(const CAAAberrationEpoch&) = default;
+  CAAAberrationEpoch(CAAAberrationEpoch&&) = default;
+  ~CAAAberrationEpoch() = default;
+
+//Methods
+  CAAAberrationEpoch& operator=(const CAAAberrationEpoch&) = default;
+  CAAAberrationEpoch& operator=(CAAAberrationEpoch&&) = default;
+
+//Member variables
+  double JD;
+  CAA3DCoordinate EarthVelocity; //As returned from CAAAberration::EarthVelocity
+  double SunLongitude;           //The geometric ecliptic longitude of the Sun in radians
+  double Eccentricity;           //The eccentricity of the Earth's orbit
+  double Perihelion;             //The longitude of the perihelion of the Earth's orbit in radians
+};
+
 class AAPLUS_EXT_CLASS CAAAberration
 {
 public:
@@ -47,6 +77,11 @@ public:
   static CAA3DCoordinate EarthVelocity(double JD, bool bHighPrecision) noexcept;
   static CAA2DCoordinate EclipticAberration(double Alpha, double Delta, double JD, bool bHighPrecision) noexcept;
   static CAA2DCoordinate EquatorialAberration(double Lambda, double Beta, double JD, bool bHighPrecision) noexcept;
+  static CAA2DCoordinate EclipticAberration(double Lambda, double Beta, const CAAAberrationEpoch& epoch) noexcept;
+  static CAA2DCoordinate EquatorialAberration(double Alpha, double Delta, const CAAAberrationEpoch& epoch) noexcept;
+  static void EclipticAberration(const double* pLambda, const double* pBeta, const CAAAberrationEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept;
+  static void EquatorialAberration(const double* pAlpha, const double* pDelta, const CAAAberrationEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept;
+  static CAA2DCoordinate EquatorialAberration(double Alpha, double Delta, const CAA3DCoordinate& EarthVelocity) noexcept;
 };
 
 
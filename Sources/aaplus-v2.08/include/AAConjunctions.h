@@ -0,0 +1,127 @@
+/*
+Module : AAConjunctions.h
+Purpose: Implementation for a search for the conjunctions and close approaches between any number of bodies
+Created: 18-10-2026
+History: None
+
+The apparent geocentric positions of every body are tabulated once at each node of a coarse grid of dates and held
+as unit vectors, using the truncated theories for the planets. The separations of all the pairs of bodies at each
+node then follow from dot products, so the expensive part of the search grows with the number of bodies rather
+than with the number of pairs. A local minimum of the separation at a node brackets a close approach, which is
+only refined when the minimum could be within the requested separation given how far each body moves between
+nodes. The refinement uses CAAEventFinder::Extremum with the full apparent positions, where bHighPrecision
+selects the full VSOP87 theory for the planets. The positions of the Moon are geocentric and so do not include
+the parallax of the observer, and the positions of the stars do not include proper motion.
+
+*/
+
+
+/////////////////////// Macros / Defines //////////////////////////////////////
+
+#if _MSC_VER > 1000
+#pragma once
+#endif //#if _MSC_VER > 1000
+
+#ifndef __AACONJUNCTIONS_H__
+#define __AACONJUNCTIONS_H__
+
+#ifndef AAPLUS_EXT_CLASS
+#define AAPLUS_EXT_CLASS
+#endif //#ifndef AAPLUS_EXT_CLASS
+
+
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AA2DCoordinate.h"
+#include <cstddef>
+#include <vector>
+
+
+/////////////////////// Classes ///////////////////////////////////////////////
+
+class AAPLUS_EXT_CLASS CAAConjunctionBody
+{
+public:
+//Enums
+  enum class Object
+  {
+    SUN,
+    MERCURY,
+    VENUS,
+    MARS,
+    JUPITER,
+    SATURN,
+    URANUS,
+    NEPTUNE,
+    PLUTO,
+    MOON,
+    STAR
+  };
+
+//Constructors / Destructors
+  CAAConjunctionBody() noexcept : object(Object::SUN),
+                                  Alpha(0),
+                                  Delta(0)
+  {
+  };
+  CAAConjunctionBody(Object objectType) noexcept : object(objectType),
+                                                   Alpha(0),
+                                                   Delta(0)
+  {
+  };
+  CAAConjunctionBody(double alpha, double delta) noexcept : object(Object::STAR),
+                                                            Alpha(alpha),
+                                                            Delta(delta)
+  {
+  };
+  CAAConjunctionBody(const CAAConjunctionBody&) = default;
+  CAAConjunctionBody(CAAConjunctionBody&&) = default;
+  ~CAAConjunctionBody() = default;
+
+//Methods
+  CAAConjunctionBody& operator=(const CAAConjunctionBody&) = default;
+  CAAConjunctionBody& operator=(CAAConjunctionBody&&) = default;
+
+//Member variables
+  Object object;
+  double Alpha; //For a star, the right ascension for the mean equator and equinox of J2000.0 in hours
+  double Delta; //For a star, the declination for the mean equator and equinox of J2000.0 in degrees
+};
+
+class AAPLUS_EXT_CLASS CAAConjunctionDetails
+{
+public:
+//Constructors / Destructors
+  CAAConjunctionDetails() noexcept : Body1(0),
+                                     Body2(0),
+                                     JD(0),
+                                     Separation(0),
+                                     PositionAngle(0)
+  {
+  };
+  CAAConjunctionDetails(const CAAConjunctionDetails&) = default;
+  CAAConjunctionDetails(CAAConjunctionDetails&&) = default;
+  ~CAAConjunctionDetails() = default;
+
+//Methods
+  CAAConjunctionDetails& operator=(const CAAConjunctionDetails&) = default;
+  CAAConjunctionDetails& operator=(CAAConjunctionDetails&&) = default;
+
+//Member variables
+  size_t Body1; //The index of the first body in the array of bodies searched
+  size_t Body2; //The index of the second body, which is always greater than Body1
+  double JD; //When the separation is a minimum in TT
+  double Separation; //The minimum separation in degrees
+  double PositionAngle; //The position angle of the first body relative to the second, measured eastwards from north in the range 0 - 360 degrees
+};
+
+class AAPLUS_EXT_CLASS CAAConjunctions
+{
+public:
+//Static methods
+  static std::vector<CAAConjunctionDetails> Calculate(double StartJD, double EndJD, const std::vector<CAAConjunctionBody>& bodies, double MaxSeparation, double StepInterval = 0.5, bool bHighPrecision = false);
+  static CAA2DCoordinate ApparentPosition(const CAAConjunctionBody& body, double JD, bool bHighPrecision) noexcept;
+};
+
+
+#endif //#ifndef __AACONJUNCTIONS_H__
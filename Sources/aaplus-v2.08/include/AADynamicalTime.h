@@ -33,6 +33,11 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAADynamicalTime
@@ -57,6 +62,23 @@ public:
   static double TT2UT1(double JD) noexcept;
   static double UT12TT(double JD) noexcept;
   static double UT1MinusUTC(double JD) noexcept;
+
+//Batch versions of the above which convert nCount values. The lookups are fastest when the values are in time order
+  static void DeltaT(const double* pJD, double* pDeltaT, size_t nCount) noexcept;
+  static void TT2UTC(const double* pJD, double* pResults, size_t nCount) noexcept;
+  static void UTC2TT(const double* pJD, double* pResults, size_t nCount) noexcept;
+  static void TT2UT1(const double* pJD, double* pResults, size_t nCount) noexcept;
+  static void UT12TT(const double* pJD, double* pResults, size_t nCount) noexcept;
+
+//Runtime loading of Earth orientation data from IERS / USNO files. Loaded values take precedence over the tables
+//compiled into AA+, which are still used outside the range of the loaded values. LoadDeltaTValues and LoadFinals both
+//replace any previously loaded DeltaT values, so LoadLeapSeconds should be called first as LoadFinals uses the leap
+//seconds to convert UT1-UTC to DeltaT. The tables can be loaded or reset at any time, including while other threads
+//are calling the methods of this class
+  static bool LoadDeltaTValues(const char* pszFilename);
+  static bool LoadLeapSeconds(const char* pszFilename);
+  static bool LoadFinals(const char* pszFilename);
+  static void ResetToCompiledTables();
 };
 
 
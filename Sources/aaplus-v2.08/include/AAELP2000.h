@@ -36,6 +36,7 @@ to maintain a single distribution point for the source code.
 /////////////////////// Includes //////////////////////////////////////////////
 
 #include "AA3DCoordinate.h"
+#include "AASeriesStepper.h"
 
 
 ////////////////////////////// Classes ////////////////////////////////////////
@@ -116,4 +117,27 @@ protected:
   static double Accumulate_3(const double* pT, int nTSize, const ELP2000EarthTidalMoonRelativisticSolarEccentricityCoefficient* pCoefficients, int nCoefficients, double fD, double fldash, double fl, double fF) noexcept;
 };
 
+//Evaluates the full ELP2000-82B theory at StartJD, StartJD + StepInterval, StartJD + 2*StepInterval etc by rotating
+//the terms of the series rather than calling sin or cos for each of them. The phases of the main problem are
+//quartic in time and are stepped using their forward differences. Dates which are off the grid are calculated
+//directly
+class AAPLUS_EXT_CLASS CAAELP2000Stepper
+{
+public:
+//Constructors / Destructors
+  CAAELP2000Stepper() = default;
+  CAAELP2000Stepper(double StartJD, double StepInterval, int nAnchorInterval = 64);
+
+//Methods
+  double EclipticLongitude(double JD);
+  double EclipticLatitude(double JD);
+  double RadiusVector(double JD);
+
+protected:
+//Member variables
+  CAASeriesStepper m_Longitude;
+  CAASeriesStepper m_Latitude;
+  CAASeriesStepper m_RadiusVector;
+};
+
 #endif //#ifndef __AAELP2000_H__
@@ -34,6 +34,43 @@ to maintain a single distribution point for the source code.
 
 //////////////////////// Classes //////////////////////////////////////////////
 
+//The heliocentric position of the Earth together with the obliquity and nutation at an instant. These are the
+//quantities which the physical ephemerides of the Sun and planets all start from, so one epoch can be calculated
+//and then shared between them rather than each rerunning the VSOP87 and nutation series for the same date
+class AAPLUS_EXT_CLASS CAAEarthEpoch
+{
+public:
+//Constructors / Destructors
+  CAAEarthEpoch() noexcept : JD(0),
+                             bHighPrecision(false),
+                             EclipticLongitude(0),
+                             EclipticLatitude(0),
+                             RadiusVector(0),
+                             MeanObliquity(0),
+                             NutationInLongitude(0),
+                             NutationInObliquity(0)
+  {
+  };
+  CAAEarthEpoch(double jd, bool highPrecision) noexcept;
+  CAAEarthEpoch(const CAAEarthEpoch&) = default;
+  CAAEarthEpoch(CAAEarthEpoch&&) = default;
+  ~CAAEarthEpoch() = default;
+
+//Methods
+  CAAEarthEpoch& operator=(const CAAEarthEpoch&) = default;
+  CAAEarthEpoch& operator=(CAAEarthEpoch&&) = default;
+
+//Member variables
+  double JD;
+  bool bHighPrecision;
+  double EclipticLongitude; //In degrees
+  double EclipticLatitude; //In degrees
+  double RadiusVector; //In AU
+  double MeanObliquity; //In degrees
+  double NutationInLongitude; //In arcseconds
+  double NutationInObliquity; //In arcseconds
+};
+
 class AAPLUS_EXT_CLASS CAAEarth
 {
 public:
@@ -39,6 +39,7 @@ class AAPLUS_EXT_CLASS CAAEquationOfTime
 public:
 //Static methods
   static double Calculate(double JD, bool bHighPrecision) noexcept;
+  static double Calculate(double JD, double SunApparentRightAscension, double NutationInLongitude, double TrueObliquity) noexcept;
 };
 
 
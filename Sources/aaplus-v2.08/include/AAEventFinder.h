@@ -0,0 +1,89 @@
+/*
+Module : AAEventFinder.h
+Purpose: Implementation for a generic root and extremum finder for functions of time
+Created: 18-10-2026
+History: None
+
+The function is sampled at a fixed step to bracket events, and each bracket is then refined to the requested
+tolerance. Roots are refined using Brent's method (or a safeguarded Newton-Raphson iteration if the derivative
+is supplied) and extrema are refined using Brent's parabolic minimization (or as roots of the derivative if it is
+supplied). Events which occur closer together than the step interval may be missed.
+
+*/
+
+
+/////////////////////// Macros / Defines //////////////////////////////////////
+
+#if _MSC_VER > 1000
+#pragma once
+#endif //#if _MSC_VER > 1000
+
+#ifndef __AAEVENTFINDER_H__
+#define __AAEVENTFINDER_H__
+
+#ifndef AAPLUS_EXT_CLASS
+#define AAPLUS_EXT_CLASS
+#endif //#ifndef AAPLUS_EXT_CLASS
+
+
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+#include <vector>
+#include <functional>
+
+
+/////////////////////// Classes ///////////////////////////////////////////////
+
+class AAPLUS_EXT_CLASS CAAEventFinderDetails
+{
+public:
+//Enums
+  enum class Type
+  {
+    NotDefined = 0,
+    AscendingRoot = 1,
+    DescendingRoot = 2,
+    Maximum = 3,
+    Minimum = 4
+  };
+
+//Constructors / Destructors
+  CAAEventFinderDetails() noexcept : type(Type::NotDefined),
+                                     JD(0),
+                                     Value(0)
+  {
+  };
+  CAAEventFinderDetails(const CAAEventFinderDetails&) = default;
+  CAAEventFinderDetails(CAAEventFinderDetails&&) = default;
+  ~CAAEventFinderDetails() = default;
+
+//Methods
+  CAAEventFinderDetails& operator=(const CAAEventFinderDetails&) = default;
+  CAAEventFinderDetails& operator=(CAAEventFinderDetails&&) = default;
+
+//Member variables
+  Type type; //The type of the event which has occurred
+  double JD; //When the event occurred
+  double Value; //The value of the function at the event
+};
+
+class AAPLUS_EXT_CLASS CAAEventFinder
+{
+public:
+//Typedefs
+  typedef std::function<double(double JD)> Function;
+  typedef std::function<void(const double* pJD, double* pValues, size_t nCount)> BatchFunction;
+
+//Static methods
+  static std::vector<CAAEventFinderDetails> Calculate(double StartJD, double EndJD, double StepInterval, const Function& function, bool bRoots = true, bool bExtrema = true, double Tolerance = 1e-6, const Function& derivative = nullptr);
+  static std::vector<CAAEventFinderDetails> Calculate(double StartJD, double EndJD, double StepInterval, const BatchFunction& function, bool bRoots = true, bool bExtrema = true, double Tolerance = 1e-6);
+  static double Root(const Function& function, double A, double B, double fA, double fB, double Tolerance = 1e-6, const Function& derivative = nullptr);
+  static double Extremum(const Function& function, double A, double B, double C, double fB, bool bMaximum, double& Value, double Tolerance = 1e-6, const Function& derivative = nullptr);
+
+protected:
+  static std::vector<CAAEventFinderDetails> Calculate(double StartJD, double EndJD, double StepInterval, const BatchFunction& sampler, const Function& function, bool bRoots, bool bExtrema, double Tolerance, const Function& derivative);
+};
+
+
+#endif //#ifndef __AAEVENTFINDER_H__
@@ -35,6 +35,8 @@ to maintain a single distribution point for the source code.
 /////////////////////// Includes //////////////////////////////////////////////
 
 #include "AA3DCoordinate.h"
+#include "AARotation.h"
+#include <cstddef>
 
 
 /////////////////////// Classes ///////////////////////////////////////////////
@@ -48,6 +50,8 @@ public:
   static CAA3DCoordinate ConvertVSOPToFK5J2000(const CAA3DCoordinate& value) noexcept;
   static CAA3DCoordinate ConvertVSOPToFK5B1950(const CAA3DCoordinate& value) noexcept;
   static CAA3DCoordinate ConvertVSOPToFK5AnyEquinox(const CAA3DCoordinate& value, double JDEquinox) noexcept;
+  static void            ConvertVSOPToFK5AnyEquinox(const CAA3DCoordinate* pValues, CAA3DCoordinate* pResults, size_t nCount, double JDEquinox) noexcept;
+  static CAARotationMatrix VSOPToFK5AnyEquinoxMatrix(double JDEquinox) noexcept;
 };
 
 
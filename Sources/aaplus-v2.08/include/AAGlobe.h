@@ -32,8 +32,43 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
+//A location on the Earth's surface together with its geocentric coordinates, which are calculated once when the
+//observer is created rather than on every topocentric conversion
+class AAPLUS_EXT_CLASS CAAObserver
+{
+public:
+//Constructors / Destructors
+  CAAObserver() noexcept : Longitude(0),
+                           Latitude(0),
+                           Height(0),
+                           RhoSinThetaPrime(0),
+                           RhoCosThetaPrime(1)
+  {
+  };
+  CAAObserver(double longitude, double latitude, double height) noexcept;
+  CAAObserver(const CAAObserver&) = default;
+  CAAObserver(CAAObserver&&) = default;
+  ~CAAObserver() = default;
+
+//Methods
+  CAAObserver& operator=(const CAAObserver&) = default;
+  CAAObserver& operator=(CAAObserver&&) = default;
+
+//Member variables
+  double Longitude;        //The geographical longitude in degrees, measured positively westwards
+  double Latitude;         //The geographical latitude in degrees
+  double Height;           //The height above sea level in metres
+  double RhoSinThetaPrime; //CAAGlobe::RhoSinThetaPrime(Latitude, Height)
+  double RhoCosThetaPrime; //CAAGlobe::RhoCosThetaPrime(Latitude, Height)
+};
+
 class AAPLUS_EXT_CLASS CAAGlobe
 {
 public:
@@ -43,6 +78,20 @@ public:
 	static double RadiusOfParallelOfLatitude(double GeographicalLatitude) noexcept;
 	static double RadiusOfCurvature(double GeographicalLatitude) noexcept;
 	static double DistanceBetweenPoints(double GeographicalLatitude1, double GeographicalLongitude1, double GeographicalLatitude2, double GeographicalLongitude2) noexcept;
+
+//Batch versions of the above which evaluate nCount values from separate arrays of inputs
+	static void RhoSinThetaPrime(const double* pGeographicalLatitude, const double* pHeight, double* pResults, size_t nCount) noexcept;
+	static void RhoCosThetaPrime(const double* pGeographicalLatitude, const double* pHeight, double* pResults, size_t nCount) noexcept;
+	static void RadiusOfParallelOfLatitude(const double* pGeographicalLatitude, double* pResults, size_t nCount) noexcept;
+	static void RadiusOfCurvature(const double* pGeographicalLatitude, double* pResults, size_t nCount) noexcept;
+	static void DistanceBetweenPoints(const double* pGeographicalLatitude1, const double* pGeographicalLongitude1, const double* pGeographicalLatitude2, const double* pGeographicalLongitude2, double* pResults, size_t nCount) noexcept;
+
+//Fills the nCount x nCount row major array pResults with the distance in kilometres between every pair of points. The
+//matrix is calculated in blocks over nThreads threads, where 0 uses one thread per hardware thread
+	static void DistanceMatrix(const double* pGeographicalLatitude, const double* pGeographicalLongitude, double* pResults, size_t nCount, unsigned int nThreads = 0);
+
+//Creates the observers for nCount stations, ready for use with the topocentric methods of CAAParallax
+	static void Observers(const double* pLongitude, const double* pLatitude, const double* pHeight, CAAObserver* pObservers, size_t nCount) noexcept;
 };
 
 
@@ -0,0 +1,112 @@
+/*
+Module : AAInstrumentation.h
+Purpose: Optional instrumentation counters for the hot paths of the AA+ framework
+Created: 18-10-2026
+History: None
+
+The counters are only compiled in when AAPLUS_INSTRUMENTATION is defined when building AA+. If in addition
+AAPLUS_INSTRUMENTATION_TIMING is defined, the time spent in each theory is also accumulated using the CPU timestamp
+counter (or std::chrono::steady_clock nanoseconds on platforms without one). When AAPLUS_INSTRUMENTATION is not
+defined the hooks expand to nothing and Snapshot always returns zeroed counters.
+
+*/
+
+
+/////////////////////// Macros / Defines //////////////////////////////////////
+
+#if _MSC_VER > 1000
+#pragma once
+#endif //#if _MSC_VER > 1000
+
+#ifndef __AAINSTRUMENTATION_H__
+#define __AAINSTRUMENTATION_H__
+
+#ifndef AAPLUS_EXT_CLASS
+#define AAPLUS_EXT_CLASS
+#endif //#ifndef AAPLUS_EXT_CLASS
+
+#if defined(AAPLUS_INSTRUMENTATION_TIMING) && !defined(AAPLUS_INSTRUMENTATION)
+#define AAPLUS_INSTRUMENTATION
+#endif //#if defined(AAPLUS_INSTRUMENTATION_TIMING) && !defined(AAPLUS_INSTRUMENTATION)
+
+
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstdint>
+
+
+/////////////////////// Classes ///////////////////////////////////////////////
+
+class AAPLUS_EXT_CLASS CAAInstrumentationCounter
+{
+public:
+//Member variables
+  std::uint64_t Calls{0}; //The number of calls into the theory
+  std::uint64_t Terms{0}; //The number of series terms (or solver iterations) evaluated
+  std::uint64_t Ticks{0}; //The elapsed timer ticks, only maintained when AAPLUS_INSTRUMENTATION_TIMING is defined
+};
+
+class AAPLUS_EXT_CLASS CAAInstrumentationCounters
+{
+public:
+//Member variables
+  CAAInstrumentationCounter VSOP87;              //CVSOP87::Calculate & CVSOP87::Calculate_Dash
+  CAAInstrumentationCounter ELP2000;             //CAAELP2000::EclipticLongitude, EclipticLatitude & RadiusVector
+  CAAInstrumentationCounter Nutation;            //CAANutation::NutationInLongitude & NutationInObliquity
+  CAAInstrumentationCounter EllipticalLightTime; //CAAElliptical::Calculate, with Terms being the light-time iterations
+  CAAInstrumentationCounter Kepler;              //CAAKepler::Calculate, with Terms being the iterations
+};
+
+class AAPLUS_EXT_CLASS CAAInstrumentation
+{
+public:
+//Static methods
+  static bool Enabled() noexcept; //Whether the library itself was built with AAPLUS_INSTRUMENTATION defined
+  static CAAInstrumentationCounters Snapshot() noexcept;
+  static void Reset() noexcept;
+  static CAAInstrumentationCounters& Current() noexcept;
+  static std::uint64_t ReadTimer() noexcept;
+};
+
+#ifdef AAPLUS_INSTRUMENTATION_TIMING
+class AAPLUS_EXT_CLASS CAAInstrumentationTimer
+{
+public:
+//Constructors / Destructors
+  explicit CAAInstrumentationTimer(CAAInstrumentationCounter& counter) noexcept : m_Counter(counter),
+                                                                                 m_nStart(CAAInstrumentation::ReadTimer())
+  {
+  }
+  CAAInstrumentationTimer(const CAAInstrumentationTimer&) = delete;
+  CAAInstrumentationTimer& operator=(const CAAInstrumentationTimer&) = delete;
+  ~CAAInstrumentationTimer()
+  {
+    m_Counter.Ticks += (CAAInstrumentation::ReadTimer() - m_nStart);
+  }
+
+protected:
+//Member variables
+  CAAInstrumentationCounter& m_Counter;
+  std::uint64_t m_nStart;
+};
+#endif //#ifdef AAPLUS_INSTRUMENTATION_TIMING
+
+
+/////////////////////// Hooks /////////////////////////////////////////////////
+
+#ifdef AAPLUS_INSTRUMENTATION
+#define AAPLUS_INSTRUMENT_CALL(THEORY) (CAAInstrumentation::Current().THEORY.Calls++)
+#define AAPLUS_INSTRUMENT_TERMS(THEORY, TERMS) (CAAInstrumentation::Current().THEORY.Terms += (TERMS))
+#else
+#define AAPLUS_INSTRUMENT_CALL(THEORY) ((void)0)
+#define AAPLUS_INSTRUMENT_TERMS(THEORY, TERMS) ((void)0)
+#endif //#ifdef AAPLUS_INSTRUMENTATION
+
+#ifdef AAPLUS_INSTRUMENTATION_TIMING
+#define AAPLUS_INSTRUMENT_SCOPE(THEORY) const CAAInstrumentationTimer _aaplusInstrumentationTimer(CAAInstrumentation::Current().THEORY)
+#else
+#define AAPLUS_INSTRUMENT_SCOPE(THEORY) ((void)0)
+#endif //#ifdef AAPLUS_INSTRUMENTATION_TIMING
+
+
+#endif //#ifndef __AAINSTRUMENTATION_H__
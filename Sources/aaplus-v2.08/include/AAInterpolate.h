@@ -32,6 +32,13 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+#include <vector>
+#include <functional>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAInterpolate
@@ -89,4 +96,111 @@ public:
 };
 
 
+//Polynomial interpolation through an arbitrary set of points using the barycentric form of the Lagrange polynomial.
+//The weights are computed once in O(n^2) and each evaluation is then O(n). The weights only depend on the X values,
+//so SetValues can be used to interpolate a different set of Y values at the same X values
+class AAPLUS_EXT_CLASS CAABarycentricInterpolator
+{
+public:
+//Constructors / Destructors
+  CAABarycentricInterpolator() = default;
+  CAABarycentricInterpolator(const double* pX, const double* pY, size_t n);
+
+//Methods
+  void SetValues(const double* pY);
+  double Evaluate(double X) const noexcept;
+  void Evaluate(const double* pX, double* pResults, size_t nCount) const noexcept;
+  size_t Size() const noexcept
+  {
+    return m_X.size();
+  }
+
+protected:
+//Member variables
+  std::vector<double> m_X;
+  std::vector<double> m_Y;
+  std::vector<double> m_Weights;
+};
+
+
+//A Chebyshev series approximation of a function on the interval [A, B] as described in "Numerical Recipes",
+//section 5.8. The series can be evaluated, differentiated and integrated without further calls to the function
+class AAPLUS_EXT_CLASS CAAChebyshevSeries
+{
+public:
+//Constructors / Destructors
+  CAAChebyshevSeries() noexcept : m_A(-1),
+                                  m_B(1)
+  {
+  }
+  CAAChebyshevSeries(double A, double B, std::vector<double> coefficients);
+
+//Static methods
+  static std::vector<double> Nodes(double A, double B, size_t n);
+  static CAAChebyshevSeries Fit(double A, double B, const double* pValuesAtNodes, size_t n);
+  static CAAChebyshevSeries Fit(const std::function<double(double)>& function, double A, double B, size_t n);
+
+//Methods
+  double Evaluate(double X) const noexcept;
+  void Evaluate(const double* pX, double* pResults, size_t nCount) const noexcept;
+  CAAChebyshevSeries Derivative() const;
+  CAAChebyshevSeries Integral() const;
+  double A() const noexcept
+  {
+    return m_A;
+  }
+  double B() const noexcept
+  {
+    return m_B;
+  }
+  const std::vector<double>& Coefficients() const noexcept
+  {
+    return m_Coefficients;
+  }
+
+protected:
+//Member variables
+  double m_A;
+  double m_B;
+  std::vector<double> m_Coefficients;
+};
+
+
+//Piecewise cubic Hermite interpolation through a set of points where both the values and their first derivatives
+//are known, such as a VSOP87 series and its analytic rate from CVSOP87::Calculate_Dash. If bAngle is true the Y
+//values are taken to be angles in radians which are unwrapped before interpolating and the interpolated values are
+//returned in the range 0 to 2PI
+class AAPLUS_EXT_CLASS CAACubicHermiteInterpolator
+{
+public:
+//Constructors / Destructors
+  CAACubicHermiteInterpolator() noexcept : m_bAngle(false)
+  {
+  }
+  CAACubicHermiteInterpolator(const double* pX, const double* pY, const double* pYDash, size_t n, bool bAngle = false);
+
+//Static methods
+  static CAACubicHermiteInterpolator Sample(double StartJD, double EndJD, double StepInterval, double (*pFunction)(double JD), double (*pFunctionDash)(double JD), bool bAngle = false);
+
+//Methods
+  double Evaluate(double X) const noexcept;
+  double EvaluateDash(double X) const noexcept;
+  void Evaluate(const double* pX, double* pResults, size_t nCount) const noexcept;
+  size_t Size() const noexcept
+  {
+    return m_X.size();
+  }
+
+protected:
+//Methods
+  size_t FindInterval(double X) const noexcept;
+
+//Member variables
+  std::vector<double> m_X;
+  std::vector<double> m_Y;
+  std::vector<double> m_YDash;
+  bool m_bAngle;
+};
+
+
 #endif //#ifndef __AAINTERPOLATE_H__
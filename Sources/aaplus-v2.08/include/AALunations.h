@@ -0,0 +1,88 @@
+/*
+Module : AALunations.h
+Purpose: Implementation for a catalogue of the phases, apsides and nodal passages of the Moon over a range of dates
+Created: 18-10-2026
+History: None
+
+The events are found by enumerating the k values of Meeus's chapters 49, 50 & 51 which fall in the requested
+range and evaluating each family of events with the batch versions of CAAMoonPhases::TruePhase,
+CAAMoonPerigeeApogee::TruePerigee / TrueApogee and CAAMoonNodes::PassageThroNode. The results are merged into a
+single array sorted by date. If bHighPrecision is true, the phases and apsides are refined against CAAELP2000 and
+VSOP87 as described in CAAMoonPhases::RefinePhase and CAAMoonPerigeeApogee::RefineApsis, while the nodal passages
+are always those of Meeus's periodic terms.
+
+*/
+
+
+/////////////////////// Macros / Defines //////////////////////////////////////
+
+#if _MSC_VER > 1000
+#pragma once
+#endif //#if _MSC_VER > 1000
+
+#ifndef __AALUNATIONS_H__
+#define __AALUNATIONS_H__
+
+#ifndef AAPLUS_EXT_CLASS
+#define AAPLUS_EXT_CLASS
+#endif //#ifndef AAPLUS_EXT_CLASS
+
+
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <vector>
+
+
+/////////////////////// Classes ///////////////////////////////////////////////
+
+class AAPLUS_EXT_CLASS CAALunationEventDetails
+{
+public:
+//Enums
+  enum class Type
+  {
+    NotDefined = 0,
+    NewMoon = 1,
+    FirstQuarter = 2,
+    FullMoon = 3,
+    LastQuarter = 4,
+    Perigee = 5,
+    Apogee = 6,
+    AscendingNode = 7,
+    DescendingNode = 8
+  };
+
+//Constructors / Destructors
+  CAALunationEventDetails() noexcept : type(Type::NotDefined),
+                                       k(0),
+                                       JD(0)
+  {
+  };
+  CAALunationEventDetails(Type eventType, double K, double jd) noexcept : type(eventType),
+                                                                          k(K),
+                                                                          JD(jd)
+  {
+  };
+  CAALunationEventDetails(const CAALunationEventDetails&) = default;
+  CAALunationEventDetails(CAALunationEventDetails&&) = default;
+  ~CAALunationEventDetails() = default;
+
+//Methods
+  CAALunationEventDetails& operator=(const CAALunationEventDetails&) = default;
+  CAALunationEventDetails& operator=(CAALunationEventDetails&&) = default;
+
+//Member variables
+  Type type; //The type of the event
+  double k; //The k value of the event in the chapter of Meeus which covers it
+  double JD; //When the event occurs (TT)
+};
+
+class AAPLUS_EXT_CLASS CAALunations
+{
+public:
+//Static methods
+  static std::vector<CAALunationEventDetails> Calculate(double StartJD, double EndJD, bool bPhases = true, bool bApsides = true, bool bNodes = true, bool bHighPrecision = false);
+};
+
+
+#endif //#ifndef __AALUNATIONS_H__
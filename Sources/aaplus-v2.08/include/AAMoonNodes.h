@@ -32,6 +32,11 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAMoonNodes
@@ -44,6 +49,10 @@ public:
   }
 
   static double PassageThroNode(double k) noexcept;
+
+  //Evaluates PassageThroNode for many values of k, building up the sines of the multiples of D, M & M' using the
+  //angle addition formulae rather than calling sin for every term
+  static void PassageThroNode(const double* pK, double* pResults, size_t nCount) noexcept;
 };
 
 
@@ -32,6 +32,11 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAMoonPerigeeApogee
@@ -65,6 +70,18 @@ public:
 
   static double TruePerigee(double k) noexcept;
   static double TrueApogee(double k) noexcept;
+
+  //If bHighPrecision is true, the date from Meeus's periodic terms is refined using a Newton iteration on the rate
+  //of change of the distance of the Moon from CAAELP2000, whose derivatives are found from central differences
+  static double TruePerigee(double k, bool bHighPrecision) noexcept;
+  static double TrueApogee(double k, bool bHighPrecision) noexcept;
+  static double RefineApsis(double JD) noexcept;
+
+  //Evaluate TruePerigee & TrueApogee for many values of k, building up the sines of the multiples of D, M & F
+  //using the angle addition formulae rather than calling sin for every term. If pFastResults is not null it receives
+  //the dates from Meeus's periodic terms alongside any refined dates returned in pResults
+  static void TruePerigee(const double* pK, double* pResults, size_t nCount, bool bHighPrecision = false, double* pFastResults = nullptr) noexcept;
+  static void TrueApogee(const double* pK, double* pResults, size_t nCount, bool bHighPrecision = false, double* pFastResults = nullptr) noexcept;
   static double PerigeeParallax(double k) noexcept;
   static double ApogeeParallax(double k) noexcept;
 };
@@ -32,6 +32,11 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAMoonPhases
@@ -58,6 +63,18 @@ public:
   }
 
   static double TruePhase(double k) noexcept;
+
+  //If bHighPrecision is true, the date from Meeus's periodic terms is refined using a secant iteration on the
+  //difference in geocentric longitude of the Moon (from CAAELP2000) and the Sun (from VSOP87)
+  static double TruePhase(double k, bool bHighPrecision) noexcept;
+  static double RefinePhase(double JD, double Phase) noexcept;
+
+  //Evaluates TruePhase for many values of k. The sines and cosines of the multiples of M, M', F & omega are built
+  //up using the angle addition formulae, and when consecutive values of k are equally spaced the planetary
+  //arguments A2 to A14 (which are linear in k) are advanced by rotation rather than recomputed. If pFastResults is
+  //not null it receives the dates from Meeus's periodic terms, which when bHighPrecision is true are the estimates
+  //that the refined dates in pResults started from
+  static void TruePhase(const double* pK, double* pResults, size_t nCount, bool bHighPrecision = false, double* pFastResults = nullptr) noexcept;
 };
 
 
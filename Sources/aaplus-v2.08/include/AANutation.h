@@ -32,6 +32,11 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AASeriesStepper.h"
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAANutation
@@ -46,5 +51,31 @@ public:
   static double TrueObliquityOfEcliptic(double JD) noexcept;
 };
 
+//Evaluates the nutation at StartJD, StartJD + StepInterval, StartJD + 2*StepInterval etc by rotating the terms of
+//the series rather than calling sin or cos for each of them. Dates which are off the grid are calculated directly
+class AAPLUS_EXT_CLASS CAANutationStepper
+{
+public:
+//Constructors / Destructors
+  CAANutationStepper() = default;
+  CAANutationStepper(double StartJD, double StepInterval, int nAnchorInterval = 64);
+
+//Methods
+  double NutationInLongitude(double JD)
+  {
+    return m_Longitude.Calculate(JD);
+  }
+  double NutationInObliquity(double JD)
+  {
+    return m_Obliquity.Calculate(JD);
+  }
+  double TrueObliquityOfEcliptic(double JD);
+
+protected:
+//Member variables
+  CAASeriesStepper m_Longitude;
+  CAASeriesStepper m_Obliquity;
+};
+
 
 #endif //#ifndef __AANUTATION_H__
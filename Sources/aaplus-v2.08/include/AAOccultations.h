@@ -0,0 +1,117 @@
+/*
+Module : AAOccultations.h
+Purpose: Implementation for the prediction of the occultations of the stars of a catalogue by the Moon
+Created: 18-10-2026
+History: None
+
+The stars are held in a CAAStarIndex, which divides the sky into bands of declination and sorts the stars of
+each band by right ascension, so that the stars near a point can be found by a binary search in the few bands
+which the point's neighbourhood covers. The geocentric path of the Moon is tabulated at a coarse step and each
+step of the path is swept through the index, so only the stars which the Moon could occult from somewhere on
+the Earth are considered further. For each such star and observer, the closest approach of the topocentric Moon
+is first found from positions of the Moon interpolated from the tabulated path using CAAParallax, and only the
+stars which the Moon's limb could reach are then refined to the times of disappearance and reappearance using
+the full positions of the Moon. The limb of the Moon is taken as a circle, so the times near grazes (where the
+irregular limb profile matters) are only approximate, and the positions of the stars do not include proper
+motion.
+
+*/
+
+
+/////////////////////// Macros / Defines //////////////////////////////////////
+
+#if _MSC_VER > 1000
+#pragma once
+#endif //#if _MSC_VER > 1000
+
+#ifndef __AAOCCULTATIONS_H__
+#define __AAOCCULTATIONS_H__
+
+#ifndef AAPLUS_EXT_CLASS
+#define AAPLUS_EXT_CLASS
+#endif //#ifndef AAPLUS_EXT_CLASS
+
+
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AA3DCoordinate.h"
+#include "AAGlobe.h"
+#include <cstddef>
+#include <vector>
+
+
+/////////////////////// Classes ///////////////////////////////////////////////
+
+class AAPLUS_EXT_CLASS CAAStarIndex
+{
+public:
+//Constructors / Destructors
+  CAAStarIndex() = default;
+  CAAStarIndex(const double* pAlpha, const double* pDelta, size_t nCount, double BandWidth = 0.25); //The positions are for the mean equator and equinox of J2000.0, in hours and degrees
+
+//Methods
+  size_t Size() const noexcept
+  {
+    return m_X.size();
+  }
+  CAA3DCoordinate UnitVector(size_t nStar) const noexcept;
+  void Query(double Alpha, double Delta, double Radius, std::vector<size_t>& Stars) const; //Appends the index of each star within Radius degrees of the J2000.0 position
+  void Query(const CAA3DCoordinate& UnitVector, double Radius, std::vector<size_t>& Stars) const;
+
+protected:
+//Member variables
+  double m_BandWidth{0.25};               //The width of each band of declination in degrees
+  std::vector<size_t> m_BandStart;        //The first entry of each band, with a final element holding the number of entries
+  std::vector<double> m_Alpha;            //The right ascension of each entry in radians, in order within each band
+  std::vector<size_t> m_Star;             //The catalogue index of each entry
+  std::vector<double> m_X;                //The unit vector of each star, in catalogue order
+  std::vector<double> m_Y;
+  std::vector<double> m_Z;
+};
+
+class AAPLUS_EXT_CLASS CAAOccultationDetails
+{
+public:
+//Enums
+  enum class Type
+  {
+    NotDefined,
+    Disappearance,
+    Reappearance
+  };
+
+//Constructors / Destructors
+  CAAOccultationDetails() noexcept : type(Type::NotDefined),
+                                     Star(0),
+                                     Observer(0),
+                                     JD(0),
+                                     PositionAngle(0),
+                                     MoonAltitude(0)
+  {
+  };
+  CAAOccultationDetails(const CAAOccultationDetails&) = default;
+  CAAOccultationDetails(CAAOccultationDetails&&) = default;
+  ~CAAOccultationDetails() = default;
+
+//Methods
+  CAAOccultationDetails& operator=(const CAAOccultationDetails&) = default;
+  CAAOccultationDetails& operator=(CAAOccultationDetails&&) = default;
+
+//Member variables
+  Type type;            //Whether the star disappears behind or reappears from the limb of the Moon
+  size_t Star;          //The catalogue index of the star
+  size_t Observer;      //The index of the observer in the array of observers
+  double JD;            //When the contact occurs in TT
+  double PositionAngle; //The position angle of the star from the centre of the Moon, measured eastwards from north in degrees
+  double MoonAltitude;  //The topocentric altitude of the centre of the Moon in degrees, without refraction
+};
+
+class AAPLUS_EXT_CLASS CAAOccultations
+{
+public:
+//Static methods
+  static std::vector<CAAOccultationDetails> Calculate(double StartJD, double EndJD, const CAAStarIndex& stars, const std::vector<CAAObserver>& observers, bool bHighPrecision = false, double StepInterval = 0.125);
+};
+
+
+#endif //#ifndef __AAOCCULTATIONS_H__
@@ -35,6 +35,8 @@ to maintain a single distribution point for the source code.
 /////////////////////// Includes //////////////////////////////////////////////
 
 #include "AA2DCoordinate.h"
+#include "AAGlobe.h"
+#include <cstddef>
 
 
 /////////////////////// Classes ///////////////////////////////////////////////
@@ -55,12 +57,45 @@ public:
   double Semidiameter;
 };
 
+//The apparent sidereal time at an instant, which is shared by all of the topocentric conversions at that instant.
+//The sidereal time can be supplied by the caller (for example from a CAASiderealTime over a range of dates) to
+//avoid the nutation calculation which it would otherwise require
+class AAPLUS_EXT_CLASS CAATopocentricEpoch
+{
+public:
+//Constructors / Destructors
+  CAATopocentricEpoch() noexcept : JD(0),
+                                   ApparentGreenwichSiderealTime(0)
+  {
+  };
+  explicit CAATopocentricEpoch(double jd) noexcept;
+  CAATopocentricEpoch(double jd, double apparentGreenwichSiderealTime) noexcept : JD(jd),
+                                                                                   ApparentGreenwichSiderealTime(apparentGreenwichSiderealTime)
+  {
+  };
+  CAATopocentricEpoch(const CAATopocentricEpoch&) = default;
+  CAATopocentricEpoch(CAATopocentricEpoch&&) = default;
+  ~CAATopocentricEpoch() = default;
+
+//Methods
+  CAATopocentricEpoch& operator=(const CAATopocentricEpoch&) = default;
+  CAATopocentricEpoch& operator=(CAATopocentricEpoch&&) = default;
+
+//Member variables
+  double JD;
+  double ApparentGreenwichSiderealTime; //In hours
+};
+
 class AAPLUS_EXT_CLASS CAAParallax
 {
 public:
 //Conversion functions
   static CAA2DCoordinate Equatorial2TopocentricDelta(double Alpha, double Delta, double Distance, double Longitude, double Latitude, double Height, double JD) noexcept;
   static CAA2DCoordinate Equatorial2Topocentric(double Alpha, double Delta, double Distance, double Longitude, double Latitude, double Height, double JD) noexcept;
+  static CAA2DCoordinate Equatorial2TopocentricDelta(double Alpha, double Delta, double Distance, const CAAObserver& observer, const CAATopocentricEpoch& epoch) noexcept;
+  static CAA2DCoordinate Equatorial2Topocentric(double Alpha, double Delta, double Distance, const CAAObserver& observer, const CAATopocentricEpoch& epoch) noexcept;
+  static void Equatorial2Topocentric(double Alpha, double Delta, double Distance, const CAAObserver* pObservers, const CAATopocentricEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept;
+  static void Equatorial2Topocentric(const double* pAlpha, const double* pDelta, const double* pDistance, const CAAObserver& observer, const CAATopocentricEpoch& epoch, CAA2DCoordinate* pResults, size_t nCount) noexcept;
   static CAATopocentricEclipticDetails Ecliptic2Topocentric(double Lambda, double Beta, double Semidiameter, double Distance, double Epsilon, double Latitude, double Height, double JD) noexcept;
 
   static double ParallaxToDistance(double Parallax) noexcept;
@@ -32,6 +32,12 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AAEarth.h"
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAPhysicalJupiterDetails
@@ -63,6 +69,9 @@ class AAPLUS_EXT_CLASS CAAPhysicalJupiter
 public:
 //Static methods
   static CAAPhysicalJupiterDetails Calculate(double JD, bool bHighPrecision) noexcept;
+  static CAAPhysicalJupiterDetails Calculate(const CAAEarthEpoch& epoch) noexcept;
+  static void Calculate(const double* pJD, CAAPhysicalJupiterDetails* pResults, size_t nCount, bool bHighPrecision) noexcept;
+  static void Calculate(const CAAEarthEpoch* pEpochs, CAAPhysicalJupiterDetails* pResults, size_t nCount) noexcept;
 };
 
 #endif //#ifndef __AAPHYSICALJUPITER_H__
@@ -32,6 +32,12 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AAEarth.h"
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAPhysicalMarsDetails
@@ -64,6 +70,9 @@ class AAPLUS_EXT_CLASS CAAPhysicalMars
 public:
 //Static methods
   static CAAPhysicalMarsDetails Calculate(double JD, bool bHighPrecision) noexcept;
+  static CAAPhysicalMarsDetails Calculate(const CAAEarthEpoch& epoch) noexcept;
+  static void Calculate(const double* pJD, CAAPhysicalMarsDetails* pResults, size_t nCount, bool bHighPrecision) noexcept;
+  static void Calculate(const CAAEarthEpoch* pEpochs, CAAPhysicalMarsDetails* pResults, size_t nCount) noexcept;
 };
 
 
@@ -32,6 +32,12 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AAEarth.h"
+#include <cstddef>
+
+
 //////////////////////////// Classes //////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAPhysicalSunDetails
@@ -55,6 +61,9 @@ class AAPLUS_EXT_CLASS CAAPhysicalSun
 public:
 //Static methods
   static CAAPhysicalSunDetails Calculate(double JD, bool bHighPrecision) noexcept;
+  static CAAPhysicalSunDetails Calculate(const CAAEarthEpoch& epoch) noexcept;
+  static void Calculate(const double* pJD, CAAPhysicalSunDetails* pResults, size_t nCount, bool bHighPrecision) noexcept;
+  static void Calculate(const CAAEarthEpoch* pEpochs, CAAPhysicalSunDetails* pResults, size_t nCount) noexcept;
   static double TimeOfStartOfRotation(long C) noexcept;
 };
 
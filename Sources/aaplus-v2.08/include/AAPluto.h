@@ -32,8 +32,36 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
+class AAPLUS_EXT_CLASS CAAPlutoDetails
+{
+public:
+//Constructors / Destructors
+  CAAPlutoDetails() noexcept : EclipticLongitude(0),
+                               EclipticLatitude(0),
+                               RadiusVector(0)
+  {
+  };
+  CAAPlutoDetails(const CAAPlutoDetails&) = default;
+  CAAPlutoDetails(CAAPlutoDetails&&) = default;
+  ~CAAPlutoDetails() = default;
+
+//Methods
+  CAAPlutoDetails& operator=(const CAAPlutoDetails&) = default;
+  CAAPlutoDetails& operator=(CAAPlutoDetails&&) = default;
+
+//Member variables
+  double EclipticLongitude;
+  double EclipticLatitude;
+  double RadiusVector;
+};
+
 class AAPLUS_EXT_CLASS CAAPluto
 {
 public:
@@ -41,6 +69,8 @@ public:
   static double EclipticLongitude(double JD) noexcept;
   static double EclipticLatitude(double JD) noexcept;
   static double RadiusVector(double JD) noexcept;
+  static CAAPlutoDetails Position(double JD) noexcept;
+  static void Position(const double* pJD, CAAPlutoDetails* pResults, size_t nCount) noexcept;
 };
 
 
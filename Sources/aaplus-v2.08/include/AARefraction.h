@@ -32,6 +32,13 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+
 ////////////////////// Classes ////////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAARefraction
@@ -40,6 +47,75 @@ public:
 //Static methods
   static double RefractionFromApparent(double Altitude, double Pressure = 1010, double Temperature = 10) noexcept;
   static double RefractionFromTrue(double Altitude, double Pressure = 1010, double Temperature = 10) noexcept;
+
+//Batch versions of the above which calculate the refraction for nCount altitudes under the same conditions
+  static void RefractionFromApparent(const double* pAltitude, double* pResults, size_t nCount, double Pressure = 1010, double Temperature = 10) noexcept;
+  static void RefractionFromTrue(const double* pAltitude, double* pResults, size_t nCount, double Pressure = 1010, double Temperature = 10) noexcept;
+};
+
+
+//Tables of the refraction for a single pressure and temperature, which are interpolated using cubic Hermite
+//polynomials through values and derivatives sampled every 0.05 degrees up to an altitude of 10 degrees and every 0.5
+//degrees above it. The interpolated values are within 0.0001" of the formulae of CAARefraction at 1010 millibars and
+//10 degrees Celsius, and the error scales with the refraction for other conditions (so it remains below 0.0002" for
+//any pressure below 1100 millibars and temperature above -50 degrees Celsius). InverseRefractionFromTrue returns the
+//refraction R such that RefractionFromTrue(Altitude - R) is R, which converts an apparent altitude back to the true
+//altitude consistently with RefractionFromTrue. Altitudes outside the tables are passed to CAARefraction
+class AAPLUS_EXT_CLASS CAARefractionTable
+{
+public:
+//Constructors / Destructors
+  CAARefractionTable(double Pressure = 1010, double Temperature = 10);
+
+//Methods
+  double RefractionFromApparent(double Altitude) const noexcept;
+  double RefractionFromTrue(double Altitude) const noexcept;
+  double InverseRefractionFromTrue(double Altitude) const noexcept;
+  void RefractionFromApparent(const double* pAltitude, double* pResults, size_t nCount) const noexcept;
+  void RefractionFromTrue(const double* pAltitude, double* pResults, size_t nCount) const noexcept;
+  void InverseRefractionFromTrue(const double* pAltitude, double* pResults, size_t nCount) const noexcept;
+  double Pressure() const noexcept
+  {
+    return m_Pressure;
+  }
+  double Temperature() const noexcept
+  {
+    return m_Temperature;
+  }
+
+protected:
+//Classes
+  class CTable
+  {
+  public:
+  //Methods
+    void Sample(double Start, double End, const std::function<void(double X, double& Y, double& YDash)>& function);
+    bool Contains(double X) const noexcept
+    {
+      return (X >= m_Start) && (X <= m_End);
+    }
+    double Evaluate(double X) const noexcept;
+
+  protected:
+  //Member variables
+    double m_Start{0};
+    double m_Split{0};                //Where the step changes from the first to the second interval
+    double m_End{0};
+    double m_Step1{0};
+    double m_Step2{0};
+    double m_InverseStep1{0};
+    double m_InverseStep2{0};
+    size_t m_nSplit{0};               //The index of the node at m_Split
+    std::vector<double> m_Y;
+    std::vector<double> m_YDash;
+  };
+
+//Member variables
+  double m_Pressure;
+  double m_Temperature;
+  CTable m_FromApparent;
+  CTable m_FromTrue;
+  CTable m_InverseFromTrue;
 };
 
 
@@ -32,6 +32,14 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AA2DCoordinate.h"
+#include <cstddef>
+#include <vector>
+#include <functional>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAARiseTransitSetDetails
@@ -64,6 +72,8 @@ public:
 //Static methods
   static CAARiseTransitSetDetails Calculate(double JD, double Alpha1, double Delta1, double Alpha2, double Delta2, double Alpha3, double Delta3, double Longitude, double Latitude, double h0) noexcept;
   static void CorrectRAValuesForInterpolation(double& Alpha1, double& Alpha2, double& Alpha3) noexcept;
+  static void CalculateAlmanac(double JD, size_t nDays, const double* pAlpha, const double* pDelta, const double* pLongitudes, const double* pLatitudes, size_t nSites, double h0, CAARiseTransitSetDetails* pResults);
+  static std::vector<CAARiseTransitSetDetails> CalculateAlmanac(double JD, size_t nDays, const std::function<CAA2DCoordinate(double JD)>& position, const double* pLongitudes, const double* pLatitudes, size_t nSites, double h0);
 
 protected:
 //Static methods
@@ -75,6 +85,8 @@ protected:
                                  double Delta3, double Longitude, double Latitude, double LatitudeRad, double h0, double& M2) noexcept;
   static void CalculateTransitHelper(CAARiseTransitSetDetails& details, double theta0, double deltaT, double Alpha1, double Alpha2, double Alpha3, double Longitude, double& M0) noexcept;
   static void ConstraintM(double& M) noexcept;
+  static CAARiseTransitSetDetails CalculateDetails(double theta0, double deltaT, double cosH0, double M0, double Alpha1, double Delta1, double Alpha2, double Delta2, double Alpha3, double Delta3,
+                                                   double Longitude, double Latitude, double LatitudeRad, double h0) noexcept;
 };
 
 
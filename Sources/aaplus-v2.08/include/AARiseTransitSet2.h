@@ -36,6 +36,7 @@ to maintain a single distribution point for the source code.
 
 #include "AA2DCoordinate.h"
 #include <vector>
+#include <functional>
 
 
 /////////////////////// Classes ///////////////////////////////////////////////
@@ -56,7 +57,9 @@ public:
     EndAstronomicalTwilight = 7,
     StartAstronomicalTwilight = 8,
     StartNauticalTwilight = 9,
-    StartCivilTwilight = 10
+    StartCivilTwilight = 10,
+    AscendingAltitude = 11,
+    DescendingAltitude = 12
   };
 
 //Constructors / Destructors
@@ -64,7 +67,8 @@ public:
                                          JD(0),
                                          Bearing(0),
                                          GeometricAltitude(false),
-                                         bAboveHorizon(false)
+                                         bAboveHorizon(false),
+                                         Altitude(0)
   {
   };
   CAARiseTransitSetDetails2(const CAARiseTransitSetDetails2&) = default;
@@ -81,6 +85,7 @@ public:
   double Bearing; //Applicable for rise or sets only, this will be the bearing (degrees west of south) of the event
   double GeometricAltitude; //For transits only, this will contain the geometric altitude in degrees of the center of the object not including correction for refraction
   bool bAboveHorizon; //For transits only, this will be true if the transit is visible
+  double Altitude; //Not applicable for transits, this will be the geometric altitude threshold in degrees which was crossed. For rises and sets this is the "standard altitude" of the object
 };
 
 class AAPLUS_EXT_CLASS CAARiseTransitSet2
@@ -103,14 +108,27 @@ public:
   };
 
 //Static methods
-  static std::vector<CAARiseTransitSetDetails2> Calculate(double StartJD, double EndJD, Object object, double Longitude, double Latitude, double h0, double Height = 0, double StepInterval = 0.007, bool bHighPrecision = false);
-  static std::vector<CAARiseTransitSetDetails2> CalculateMoon(double StartJD, double EndJD, double Longitude, double Latitude, double Height = 0, double StepInterval = 0.007);
-  static std::vector<CAARiseTransitSetDetails2> CalculateStationary(double StartJD, double EndJD, double Alpha, double Delta, double Longitude, double Latitude, double h0 = -0.5667, double StepInterval = 0.007);
+  static std::vector<CAARiseTransitSetDetails2> Calculate(double StartJD, double EndJD, Object object, double Longitude, double Latitude, double h0, double Height = 0, double StepInterval = 0.007, bool bHighPrecision = false, const std::vector<double>& Altitudes = std::vector<double>());
+  static std::vector<CAARiseTransitSetDetails2> CalculateMoon(double StartJD, double EndJD, double Longitude, double Latitude, double Height = 0, double StepInterval = 0.007, const std::vector<double>& Altitudes = std::vector<double>());
+  static std::vector<CAARiseTransitSetDetails2> CalculateStationary(double StartJD, double EndJD, double Alpha, double Delta, double Longitude, double Latitude, double h0 = -0.5667, double StepInterval = 0.007, const std::vector<double>& Altitudes = std::vector<double>());
 
 protected:
-  static void AddEvents(std::vector<CAARiseTransitSetDetails2>& events, double LastAltitudeForDetectingRiseSet, double AltitudeForDetectingRiseSet,
-                        double LastAltitudeForInterpolation, double h0, const CAA2DCoordinate& Horizontal, double LastJD, double StepInterval, double LastBearing,
-                        Object object, double LastAltitudeForDetectingTwilight, double AltitudeForTwilight);
+//Typedefs
+  typedef std::function<CAA2DCoordinate(double JD, double& h0)> HorizontalFunction; //Returns the bearing and geometric altitude of the object as well as its "standard altitude"
+
+//Classes
+  struct AltitudeThreshold
+  {
+    double Altitude; //The geometric altitude in degrees, or the offset from the "standard altitude" if bRelativeToh0 is true
+    bool bRelativeToh0;
+    CAARiseTransitSetDetails2::Type AscendingType; //The event type when the object rises through the threshold
+    CAARiseTransitSetDetails2::Type DescendingType; //The event type when the object sinks through the threshold
+  };
+
+//Static methods
+  static std::vector<CAARiseTransitSetDetails2> CalculateEvents(double StartJD, double EndJD, double StepInterval, const HorizontalFunction& horizontal, bool bTwilight, const std::vector<double>& Altitudes);
+  static void AddEvents(std::vector<CAARiseTransitSetDetails2>& events, const HorizontalFunction& horizontal, const std::vector<AltitudeThreshold>& thresholds, double LastJD, const CAA2DCoordinate& LastHorizontal, double Lasth0,
+                        double JD, const CAA2DCoordinate& Horizontal, double h0);
 };
 
 
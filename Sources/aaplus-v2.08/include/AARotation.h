@@ -0,0 +1,162 @@
+/*
+Module : AARotation.h
+Purpose: Implementation for 3x3 rotation matrices and quaternions used to change between coordinate frames
+Created: 18-10-2026
+History: None
+
+A frame change such as frame bias followed by precession and nutation can be composed into a single matrix
+once per epoch and then applied to any number of rectangular coordinates with one matrix multiply each. The
+constant matrices for the J2000.0 frames are constexpr so that products of them are formed at compile time.
+
+*/
+
+
+/////////////////////// Macros / Defines //////////////////////////////////////
+
+#if _MSC_VER > 1000
+#pragma once
+#endif //#if _MSC_VER > 1000
+
+#ifndef __AAROTATION_H__
+#define __AAROTATION_H__
+
+#ifndef AAPLUS_EXT_CLASS
+#define AAPLUS_EXT_CLASS
+#endif //#ifndef AAPLUS_EXT_CLASS
+
+
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AA3DCoordinate.h"
+#include <cstddef>
+
+
+/////////////////////// Classes ///////////////////////////////////////////////
+
+class AAPLUS_EXT_CLASS CAARotationMatrix
+{
+public:
+//Constructors / Destructors
+  constexpr CAARotationMatrix() noexcept : M{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}
+  {
+  }
+  constexpr CAARotationMatrix(double XX, double XY, double XZ, double YX, double YY, double YZ, double ZX, double ZY, double ZZ) noexcept : M{{XX, XY, XZ}, {YX, YY, YZ}, {ZX, ZY, ZZ}}
+  {
+  }
+
+//Static methods
+  //The elementary rotations of the coordinate frame (rather than of the vector) about each axis, in radians
+  static CAARotationMatrix RotationX(double Angle) noexcept;
+  static CAARotationMatrix RotationY(double Angle) noexcept;
+  static CAARotationMatrix RotationZ(double Angle) noexcept;
+  static CAARotationMatrix Precession(double JD0, double JD) noexcept;
+  static CAARotationMatrix Nutation(double JD) noexcept;
+
+  //The rotation from the mean equator and equinox of J2000.0 to the mean ecliptic and equinox of J2000.0, using
+  //the IAU 1976 obliquity of 84381.448 arcseconds
+  static constexpr CAARotationMatrix EquatorialToEclipticJ2000() noexcept
+  {
+    return CAARotationMatrix(1, 0, 0, 0, 0.9174820620691818, 0.3977771559319137, 0, -0.3977771559319137, 0.9174820620691818);
+  }
+  static constexpr CAARotationMatrix EclipticToEquatorialJ2000() noexcept
+  {
+    return EquatorialToEclipticJ2000().Transpose();
+  }
+
+  //The conversion from the dynamical ecliptic and equinox of J2000.0 used by VSOP87 to the FK5 equatorial frame
+  //of J2000.0 and B1950.0 (Meeus's formulae 32.3 & 32.4)
+  static constexpr CAARotationMatrix VSOPToFK5J2000() noexcept
+  {
+    return CAARotationMatrix(1, 0.000000440360, -0.000000190919, -0.000000479966, 0.917482137087, -0.397776982902, 0, 0.397776982902, 0.917482137087);
+  }
+  static constexpr CAARotationMatrix VSOPToFK5B1950() noexcept
+  {
+    return CAARotationMatrix(0.999925702634, 0.012189716217, 0.000011134016, -0.011179418036, 0.917413998946, -0.397777041885, -0.004859003787, 0.397747363646, 0.917482111428);
+  }
+
+  //The small frame bias between the VSOP87 and FK5 ecliptics of J2000.0, which is VSOPToFK5J2000 with the
+  //rotation to the equator removed
+  static constexpr CAARotationMatrix VSOPToFK5Bias() noexcept
+  {
+    return EquatorialToEclipticJ2000() * VSOPToFK5J2000();
+  }
+
+//Methods
+  constexpr CAARotationMatrix operator*(const CAARotationMatrix& other) const noexcept
+  {
+    return CAARotationMatrix((M[0][0]*other.M[0][0]) + (M[0][1]*other.M[1][0]) + (M[0][2]*other.M[2][0]),
+                             (M[0][0]*other.M[0][1]) + (M[0][1]*other.M[1][1]) + (M[0][2]*other.M[2][1]),
+                             (M[0][0]*other.M[0][2]) + (M[0][1]*other.M[1][2]) + (M[0][2]*other.M[2][2]),
+                             (M[1][0]*other.M[0][0]) + (M[1][1]*other.M[1][0]) + (M[1][2]*other.M[2][0]),
+                             (M[1][0]*other.M[0][1]) + (M[1][1]*other.M[1][1]) + (M[1][2]*other.M[2][1]),
+                             (M[1][0]*other.M[0][2]) + (M[1][1]*other.M[1][2]) + (M[1][2]*other.M[2][2]),
+                             (M[2][0]*other.M[0][0]) + (M[2][1]*other.M[1][0]) + (M[2][2]*other.M[2][0]),
+                             (M[2][0]*other.M[0][1]) + (M[2][1]*other.M[1][1]) + (M[2][2]*other.M[2][1]),
+                             (M[2][0]*other.M[0][2]) + (M[2][1]*other.M[1][2]) + (M[2][2]*other.M[2][2]));
+  }
+  constexpr CAARotationMatrix Transpose() const noexcept
+  {
+    return CAARotationMatrix(M[0][0], M[1][0], M[2][0], M[0][1], M[1][1], M[2][1], M[0][2], M[1][2], M[2][2]);
+  }
+  CAA3DCoordinate operator*(const CAA3DCoordinate& value) const noexcept
+  {
+    CAA3DCoordinate result;
+    result.X = M[0][0] * value.X + M[0][1] * value.Y + M[0][2] * value.Z;
+    result.Y = M[1][0] * value.X + M[1][1] * value.Y + M[1][2] * value.Z;
+    result.Z = M[2][0] * value.X + M[2][1] * value.Y + M[2][2] * value.Z;
+    return result;
+  }
+  void Apply(const CAA3DCoordinate* pValues, CAA3DCoordinate* pResults, size_t nCount) const noexcept;
+  void Apply(const double* pX, const double* pY, const double* pZ, double* pXResult, double* pYResult, double* pZResult, size_t nCount) const noexcept;
+
+//Member variables
+  double M[3][3]; //The matrix elements as M[row][column]
+};
+
+class AAPLUS_EXT_CLASS CAAQuaternion
+{
+public:
+//Constructors / Destructors
+  constexpr CAAQuaternion() noexcept : W(1),
+                                       X(0),
+                                       Y(0),
+                                       Z(0)
+  {
+  }
+  constexpr CAAQuaternion(double w, double x, double y, double z) noexcept : W(w),
+                                                                             X(x),
+                                                                             Y(y),
+                                                                             Z(z)
+  {
+  }
+
+//Static methods
+  static CAAQuaternion FromAxisAngle(const CAA3DCoordinate& Axis, double Angle) noexcept;
+  static CAAQuaternion FromRotationMatrix(const CAARotationMatrix& matrix) noexcept;
+
+//Methods
+  constexpr CAAQuaternion operator*(const CAAQuaternion& other) const noexcept
+  {
+    return CAAQuaternion((W*other.W) - (X*other.X) - (Y*other.Y) - (Z*other.Z),
+                         (W*other.X) + (X*other.W) + (Y*other.Z) - (Z*other.Y),
+                         (W*other.Y) - (X*other.Z) + (Y*other.W) + (Z*other.X),
+                         (W*other.Z) + (X*other.Y) - (Y*other.X) + (Z*other.W));
+  }
+  constexpr CAAQuaternion Conjugate() const noexcept
+  {
+    return CAAQuaternion(W, -X, -Y, -Z);
+  }
+  CAAQuaternion Normalize() const noexcept;
+  CAARotationMatrix ToRotationMatrix() const noexcept;
+  CAA3DCoordinate Rotate(const CAA3DCoordinate& value) const noexcept;
+  CAAQuaternion Slerp(const CAAQuaternion& other, double t) const noexcept;
+
+//Member variables
+  double W;
+  double X;
+  double Y;
+  double Z;
+};
+
+
+#endif //#ifndef __AAROTATION_H__
@@ -32,6 +32,11 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AAEarth.h"
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAASaturn
@@ -43,5 +48,46 @@ public:
   static double RadiusVector(double JD, bool bHighPrecision) noexcept;
 };
 
+//The position of Saturn corrected for the light travel time to the Earth at an instant, together with the
+//CAAEarthEpoch it was calculated from. Both the rings and the satellites start from this position, so one epoch can
+//be calculated and then shared between CAASaturnRings and CAASaturnMoons rather than each rerunning the light time
+//iteration over the VSOP87 series of Saturn for the same date. The iteration can be started from the light time of
+//a nearby epoch, which for closely spaced dates usually means Saturn is only evaluated once
+class AAPLUS_EXT_CLASS CAASaturnEpoch
+{
+public:
+//Constructors / Destructors
+  CAASaturnEpoch() noexcept : LightTravelTime(0),
+                              SaturnJD(0),
+                              EclipticLongitude(0),
+                              EclipticLatitude(0),
+                              RadiusVector(0),
+                              X(0),
+                              Y(0),
+                              Z(0)
+  {
+  };
+  CAASaturnEpoch(double jd, bool highPrecision) noexcept;
+  CAASaturnEpoch(const CAAEarthEpoch& earthEpoch, double PreviousLightTravelTime = 0) noexcept;
+  CAASaturnEpoch(const CAASaturnEpoch&) = default;
+  CAASaturnEpoch(CAASaturnEpoch&&) = default;
+  ~CAASaturnEpoch() = default;
+
+//Methods
+  CAASaturnEpoch& operator=(const CAASaturnEpoch&) = default;
+  CAASaturnEpoch& operator=(CAASaturnEpoch&&) = default;
+
+//Member variables
+  CAAEarthEpoch Earth;
+  double LightTravelTime; //The light travel time from Saturn to the Earth in days
+  double SaturnJD; //The instant at which the position of Saturn was evaluated, which is JD less the light time to within 2e-6 days
+  double EclipticLongitude; //The heliocentric longitude of Saturn at SaturnJD in degrees, without the FK5 correction
+  double EclipticLatitude; //The heliocentric latitude of Saturn at SaturnJD in degrees, without the FK5 correction
+  double RadiusVector; //The heliocentric distance of Saturn at SaturnJD in AU
+  double X; //The geocentric rectangular ecliptic coordinates of Saturn in AU
+  double Y;
+  double Z;
+};
+
 
 #endif //#ifndef __AASATURN_H__
@@ -35,6 +35,8 @@ to maintain a single distribution point for the source code.
 ////////////////////// Includes ///////////////////////////////////////////////
 
 #include "AA3DCoordinate.h"
+#include "AASaturn.h"
+#include <cstddef>
 
 
 ////////////////////// Classes ////////////////////////////////////////////////
@@ -78,9 +80,14 @@ class AAPLUS_EXT_CLASS CAASaturnMoons
 public:
 //Static methods
   static CAASaturnMoonsDetails Calculate(double JD, bool bHighPrecision) noexcept;
+  static CAASaturnMoonsDetails Calculate(const CAAEarthEpoch& epoch) noexcept;
+  static CAASaturnMoonsDetails Calculate(const CAASaturnEpoch& epoch) noexcept;
+  static void Calculate(const double* pJD, CAASaturnMoonsDetails* pResults, size_t nCount, bool bHighPrecision) noexcept;
+  static void Calculate(const CAAEarthEpoch* pEpochs, CAASaturnMoonsDetails* pResults, size_t nCount) noexcept;
+  static void Calculate(const CAASaturnEpoch* pEpochs, CAASaturnMoonsDetails* pResults, size_t nCount) noexcept;
 
 protected:
-  static CAASaturnMoonsDetails CalculateHelper(double JD, double sunlongrad, double betarad, double R, bool bHighPrecision) noexcept;
+  static CAASaturnMoonsDetails CalculateHelper(double JD, double x, double y, double z, double LightTravelTime) noexcept;
   static void HelperSubroutine(double e, double lambdadash, double p, double a, double omega, double i, double c1, double s1, double& r, double& lambda, double& gamma, double& w) noexcept;
   static void Rotations(double X, double Y, double Z, double c1, double s1, double c2, double s2, double lambda0, double beta0, double& A4, double& B4, double& C4) noexcept;
   static void FillInPhenomenaDetails(CAASaturnMoonDetail& detail) noexcept;
@@ -32,6 +32,13 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include "AASaturn.h"
+#include <cstddef>
+#include <vector>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAASaturnRingDetails
@@ -60,11 +67,56 @@ public:
   double U2;
 };
 
+class AAPLUS_EXT_CLASS CAASaturnRingEventDetails
+{
+public:
+//Enums
+  enum class Type
+  {
+    NotDefined = 0,
+    EarthCrossingNorthward = 1, //B increases through zero, so the Earth passes to the north side of the ring plane
+    EarthCrossingSouthward = 2, //B decreases through zero
+    SunCrossingNorthward = 3, //Bdash increases through zero, which is Saturn's northern spring equinox
+    SunCrossingSouthward = 4, //Bdash decreases through zero
+    EarthMaximum = 5, //A maximum of B
+    EarthMinimum = 6, //A minimum of B
+    SunMaximum = 7, //A maximum of Bdash
+    SunMinimum = 8 //A minimum of Bdash
+  };
+
+//Constructors / Destructors
+  CAASaturnRingEventDetails() noexcept : type(Type::NotDefined),
+                                         JD(0),
+                                         B(0),
+                                         Bdash(0)
+  {
+  };
+  CAASaturnRingEventDetails(const CAASaturnRingEventDetails&) = default;
+  CAASaturnRingEventDetails(CAASaturnRingEventDetails&&) = default;
+  ~CAASaturnRingEventDetails() = default;
+
+//Methods
+  CAASaturnRingEventDetails& operator=(const CAASaturnRingEventDetails&) = default;
+  CAASaturnRingEventDetails& operator=(CAASaturnRingEventDetails&&) = default;
+
+//Member variables
+  Type type; //The type of the event which has occurred
+  double JD; //When the event occurred in TT
+  double B; //The tilt of the rings towards the Earth at the event in degrees
+  double Bdash; //The tilt of the rings towards the Sun at the event in degrees
+};
+
 class AAPLUS_EXT_CLASS CAASaturnRings
 {
 public:
 //Static methods
   static CAASaturnRingDetails Calculate(double JD, bool bHighPrecision) noexcept;
+  static CAASaturnRingDetails Calculate(const CAAEarthEpoch& epoch) noexcept;
+  static CAASaturnRingDetails Calculate(const CAASaturnEpoch& epoch) noexcept;
+  static void Calculate(const double* pJD, CAASaturnRingDetails* pResults, size_t nCount, bool bHighPrecision) noexcept;
+  static void Calculate(const CAAEarthEpoch* pEpochs, CAASaturnRingDetails* pResults, size_t nCount) noexcept;
+  static void Calculate(const CAASaturnEpoch* pEpochs, CAASaturnRingDetails* pResults, size_t nCount) noexcept;
+  static std::vector<CAASaturnRingEventDetails> CalculateEvents(double StartJD, double EndJD, double StepInterval = 10, bool bCrossings = true, bool bExtrema = true, bool bHighPrecision = false);
 };
 
 
@@ -0,0 +1,87 @@
+/*
+Module : AASeriesStepper.h
+Purpose: Implementation for the incremental evaluation of trigonometric series at equally spaced times
+Created: 18-10-2026
+History: None
+
+The series handled are sums of terms of the form A * T^n * sin(phi(T)) or A * T^n * cos(phi(T)), where phi is a
+polynomial of up to the fourth degree in the time argument T. When such a series is evaluated at a fixed step, the
+phase of each term and its forward differences are held as unit complex numbers, so that each step only needs a
+few complex multiplies per term rather than a call to sin or cos. For the linear phases of VSOP87 this is just a
+rotation by C * DeltaT. Every so many steps the rotors are recomputed exactly from the phase polynomials, which
+bounds the rounding drift which accumulates from the repeated multiplications.
+
+*/
+
+
+/////////////////////// Macros / Defines //////////////////////////////////////
+
+#if _MSC_VER > 1000
+#pragma once
+#endif //#if _MSC_VER > 1000
+
+#ifndef __AASERIESSTEPPER_H__
+#define __AASERIESSTEPPER_H__
+
+#ifndef AAPLUS_EXT_CLASS
+#define AAPLUS_EXT_CLASS
+#endif //#ifndef AAPLUS_EXT_CLASS
+
+
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <vector>
+
+
+/////////////////////// Classes ///////////////////////////////////////////////
+
+class AAPLUS_EXT_CLASS CAASeriesStepper
+{
+public:
+//Constructors / Destructors
+  CAASeriesStepper() = default;
+  CAASeriesStepper(double TimeUnit, double StepInterval, int nAnchorInterval = 64) noexcept;
+
+//Methods
+  //Adds a term A * T^nPower * sin(phase) (or cos(phase) if bSine is false), where the phase in radians is the
+  //polynomial pPhase[0] + pPhase[1]*T + ... of up to the fourth degree. T is measured from J2000.0 in units of
+  //TimeUnit days. All the terms must be added before the series is anchored
+  void AddTerm(double Amplitude, bool bSine, int nPower, const double* pPhase, int nPhaseSize);
+  void Anchor(double JD);
+  void Step() noexcept;
+  double Value() const noexcept;
+  double Evaluate(double JD) const noexcept;
+  double Calculate(double JD);
+  double JD() const noexcept
+  {
+    return m_StartJD + (m_nStep * m_StepInterval);
+  }
+
+protected:
+//Structs
+  struct Block
+  {
+    int nPower;
+    int nOrder;
+    bool bSine;
+    std::vector<double> Amplitudes;
+    std::vector<double> Phases; //The nOrder+1 phase polynomial coefficients of each term
+    std::vector<double> Rotors; //The cos & sin of the phase and its nOrder forward differences for each term
+  };
+
+//Methods
+  void AnchorAtStep(long nStep) noexcept;
+
+//Member variables
+  double m_TimeUnit{1};
+  double m_StepInterval{1};
+  int m_nAnchorInterval{64};
+  double m_StartJD{0};
+  long m_nStep{0};
+  long m_nAnchorStep{0};
+  bool m_bAnchored{false};
+  std::vector<Block> m_Blocks;
+};
+
+
+#endif //#ifndef __AASERIESSTEPPER_H__
@@ -32,6 +32,12 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+/////////////////////// Includes //////////////////////////////////////////////
+
+#include <cstddef>
+#include <vector>
+
+
 /////////////////////// Classes ///////////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAASidereal
@@ -40,6 +46,39 @@ public:
 //Static methods
   static double MeanGreenwichSiderealTime(double JD) noexcept;
   static double ApparentGreenwichSiderealTime(double JD) noexcept;
+  static double EquationOfTheEquinoxes(double JD) noexcept;
+  static void MeanGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) noexcept;
+  static void ApparentGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) noexcept;
+};
+
+//A fast path for apparent sidereal time over a range of dates. The mean sidereal time is evaluated directly using
+//Meeus's formula 12.4 with the whole and fractional days since J2000 handled separately, so that no precision is
+//lost for large JD values. The equation of the equinoxes, which needs the nutation series, is cached on a coarse
+//grid and interpolated with a 4 point Lagrange polynomial. Over 1900 - 2100 the maximum interpolation error
+//is 0.2 microseconds of time with a 0.25 day grid, 2.5 microseconds with the default 0.5 day grid and 40
+//microseconds with a 1 day grid. The mean sidereal time agrees with CAASidereal::MeanGreenwichSiderealTime to
+//better than 40 microseconds of time. Dates outside of the range fall back to the full calculation
+class AAPLUS_EXT_CLASS CAASiderealTime
+{
+public:
+//Constructors / Destructors
+  CAASiderealTime() = default;
+  CAASiderealTime(double StartJD, double EndJD, double GridInterval = 0.5);
+
+//Static methods
+  static double MeanGreenwichSiderealTime(double JD) noexcept;
+  static void MeanGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) noexcept;
+
+//Methods
+  double EquationOfTheEquinoxes(double JD) const noexcept;
+  double ApparentGreenwichSiderealTime(double JD) const noexcept;
+  void ApparentGreenwichSiderealTime(const double* pJD, double* pResults, size_t nCount) const noexcept;
+
+protected:
+//Member variables
+  double m_StartJD{0};
+  double m_GridInterval{0};
+  std::vector<double> m_EquationOfTheEquinoxes;
 };
 
 
@@ -35,10 +35,47 @@ to maintain a single distribution point for the source code.
 /////////////////////// Includes //////////////////////////////////////////////
 
 #include "AA3DCoordinate.h"
+#include <cstddef>
+#include "AASeriesStepper.h"
+#include "AAVSOP87.h"
+#include "AANutation.h"
 
 
 /////////////////////// Classes ///////////////////////////////////////////////
 
+class AAPLUS_EXT_CLASS CAASunApparentPositionDetails
+{
+public:
+//Constructors / Destructors
+  CAASunApparentPositionDetails() noexcept : ApparentEclipticLongitude(0),
+                                             ApparentEclipticLatitude(0),
+                                             RadiusVector(0),
+                                             ApparentRightAscension(0),
+                                             ApparentDeclination(0),
+                                             TrueObliquity(0),
+                                             NutationInLongitude(0),
+                                             EquationOfTime(0)
+  {
+  };
+  CAASunApparentPositionDetails(const CAASunApparentPositionDetails&) = default;
+  CAASunApparentPositionDetails(CAASunApparentPositionDetails&&) = default;
+  ~CAASunApparentPositionDetails() = default;
+
+//Methods
+  CAASunApparentPositionDetails& operator=(const CAASunApparentPositionDetails&) = default;
+  CAASunApparentPositionDetails& operator=(CAASunApparentPositionDetails&&) = default;
+
+//Member variables
+  double ApparentEclipticLongitude; //In degrees
+  double ApparentEclipticLatitude;  //In degrees
+  double RadiusVector;              //In astronomical units
+  double ApparentRightAscension;    //In hours
+  double ApparentDeclination;       //In degrees
+  double TrueObliquity;             //In degrees
+  double NutationInLongitude;       //In arcseconds
+  double EquationOfTime;            //In minutes of time
+};
+
 class AAPLUS_EXT_CLASS CAASun
 {
 public:
@@ -57,6 +94,36 @@ public:
   static CAA3DCoordinate EquatorialRectangularCoordinatesJ2000(double JD, bool bHighPrecision) noexcept;
   static CAA3DCoordinate EquatorialRectangularCoordinatesB1950(double JD, bool bHighPrecision) noexcept;
   static CAA3DCoordinate EquatorialRectangularCoordinatesAnyEquinox(double JD, double JDEquinox, bool bHighPrecision) noexcept;
+
+  //The same values as ApparentEclipticLongitude, ApparentEclipticLatitude, CAAEarth::RadiusVector,
+  //CAANutation::TrueObliquityOfEcliptic & CAAEquationOfTime::Calculate, but evaluating each of the Earth and
+  //nutation series only once rather than once per value
+  static CAASunApparentPositionDetails ApparentPosition(double JD, bool bHighPrecision) noexcept;
+  static void ApparentPosition(const double* pJD, CAASunApparentPositionDetails* pResults, size_t nCount, bool bHighPrecision) noexcept;
+};
+
+//Evaluates the apparent position of the Sun at StartJD, StartJD + StepInterval, StartJD + 2*StepInterval etc as
+//calculated by CAASun::ApparentPosition. The nutation, and if
+//bHighPrecision is true the full VSOP87 series for the Earth and the variation of the longitude used for the
+//aberration, are stepped by rotating their terms. Dates which are off the grid are calculated directly
+class AAPLUS_EXT_CLASS CAASunStepper
+{
+public:
+//Constructors / Destructors
+  CAASunStepper() = default;
+  CAASunStepper(double StartJD, double StepInterval, bool bHighPrecision);
+
+//Methods
+  CAASunApparentPositionDetails Calculate(double JD);
+
+protected:
+//Member variables
+  bool m_bHighPrecision{false};
+  CVSOP87Stepper m_L;
+  CVSOP87Stepper m_B;
+  CVSOP87Stepper m_R;
+  CAASeriesStepper m_Variation;
+  CAANutationStepper m_Nutation;
 };
 
 
@@ -33,6 +33,11 @@ to maintain a single distribution point for the source code.
 #endif //#ifndef AAPLUS_EXT_CLASS
 
 
+////////////////////////////// Includes ///////////////////////////////////////
+
+#include "AASeriesStepper.h"
+
+
 ////////////////////////////// Classes ////////////////////////////////////////
 
 struct VSOP87Coefficient
@@ -54,6 +59,38 @@ public:
 //Static methods
   static double Calculate(double JD, const VSOP87Coefficient2* pTable, int nTableSize, bool bAngle) noexcept;
   static double Calculate_Dash(double JD, const VSOP87Coefficient2* pTable, int nTableSize) noexcept;
+
+  //Calculates both the value (as Calculate with bAngle false) and its rate per day (as Calculate_Dash) in one pass
+  //over the series, sharing the sine and cosine of each term
+  static void Calculate_Dash(double JD, const VSOP87Coefficient2* pTable, int nTableSize, double& Value, double& Dash) noexcept;
+};
+
+//Evaluates a VSOP87 series at StartJD, StartJD + StepInterval, StartJD + 2*StepInterval etc by rotating the
+//trigonometric terms rather than calling cos for each of them. Between anchors the values agree with
+//CVSOP87::Calculate to about 1E-12 radians (or AU), and dates which are off the grid are calculated directly
+class AAPLUS_EXT_CLASS CVSOP87Stepper
+{
+public:
+//Constructors / Destructors
+  CVSOP87Stepper() = default;
+  CVSOP87Stepper(const VSOP87Coefficient2* pTable, int nTableSize, bool bAngle, double StartJD, double StepInterval, int nAnchorInterval = 64);
+
+//Methods
+  double Calculate(double JD);
+  double Value() const noexcept;
+  void Step() noexcept
+  {
+    m_Series.Step();
+  }
+  double JD() const noexcept
+  {
+    return m_Series.JD();
+  }
+
+protected:
+//Member variables
+  CAASeriesStepper m_Series;
+  bool m_bAngle{false};
 };
 
 
@@ -33,6 +33,11 @@ to maintain a single distribution point for the source code.
 #endif
 
 
+////////////////////////////// Includes ///////////////////////////////////////
+
+#include "AA3DCoordinate.h"
+
+
 ////////////////////////////// Classes ////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAVSOP87A_Earth
@@ -44,6 +49,9 @@ public:
   static double Y_DASH(double JD) noexcept;
   static double Z(double JD) noexcept;
   static double Z_DASH(double JD) noexcept;
+
+  //The heliocentric position (in AU) and velocity (in AU per day) from one pass over each of the X, Y & Z series
+  static void PositionAndVelocity(double JD, CAA3DCoordinate& Position, CAA3DCoordinate& Velocity) noexcept;
 };
 
 
@@ -33,6 +33,11 @@ to maintain a single distribution point for the source code.
 #endif
 
 
+////////////////////////////// Includes ///////////////////////////////////////
+
+#include "AAVSOP87.h"
+
+
 ////////////////////////////// Classes ////////////////////////////////////////
 
 class AAPLUS_EXT_CLASS CAAVSOP87D_Earth
@@ -44,6 +49,9 @@ public:
   static double B_DASH(double JD) noexcept;
   static double R(double JD) noexcept;
   static double R_DASH(double JD) noexcept;
+  static CVSOP87Stepper L_Stepper(double StartJD, double StepInterval);
+  static CVSOP87Stepper B_Stepper(double StartJD, double StepInterval);
+  static CVSOP87Stepper R_Stepper(double StartJD, double StepInterval);
 };
 
 
@@ -39,6 +39,7 @@ to maintain a single distribution point for the source code.
 #include "AAAberration.h"
 #include "AAAngularSeparation.h"
 #include "AABinaryStar.h"
+#include "AAConjunctions.h"
 #include "AACoordinateTransformation.h"
 #include "AADate.h"
 #include "AADiameters.h"
@@ -58,14 +59,17 @@ to maintain a single distribution point for the source code.
 #include "AAEquationOfTime.h"
 #include "AAEquinoxesAndSolstices.h"
 #include "AAEquinoxesAndSolstices2.h"
+#include "AAEventFinder.h"
 #include "AAFK5.h"
 #include "AAGalileanMoons.h"
 #include "AAGlobe.h"
 #include "AAIlluminatedFraction.h"
+#include "AAInstrumentation.h"
 #include "AAInterpolate.h"
 #include "AAJewishCalendar.h"
 #include "AAJupiter.h"
 #include "AAKepler.h"
+#include "AALunations.h"
 #include "AAMars.h"
 #include "AAMercury.h"
 #include "AAMoon.h"
@@ -80,6 +84,7 @@ to maintain a single distribution point for the source code.
 #include "AANeptune.h"
 #include "AANodes.h"
 #include "AANutation.h"
+#include "AAOccultations.h"
 #include "AAParabolic.h"
 #include "AAParallactic.h"
 #include "AAParallax.h"
@@ -94,9 +99,11 @@ to maintain a single distribution point for the source code.
 #include "AARefraction.h"
 #include "AARiseTransitSet.h"
 #include "AARiseTransitSet2.h"
+#include "AARotation.h"
 #include "AASaturn.h"
 #include "AASaturnMoons.h"
 #include "AASaturnRings.h"
+#include "AASeriesStepper.h"
 #include "AASidereal.h"
 #include "AAStellarMagnitudes.h"
 #include "AASun.h"